@@ -0,0 +1,90 @@
+/**
+ * @author Brendan Doherty (2bndy5)
+ * @date Created 2026-10-19
+ * @copyright Copyright (C) <br> <br>
+ *    2026        Brendan Doherty (2bndy5) <br>
+ * This General Public License does not permit incorporating your program into
+ * proprietary programs.  If your program is a subroutine library, you may
+ * consider it more useful to permit linking proprietary applications with the
+ * library.  If this is what you want to do, use the GNU Lesser General
+ * Public License instead of this License.
+ */
+
+#include <chrono>  // std::chrono::steady_clock
+#include <cstdio>  // printf(), fwrite()
+#include <thread>  // std::this_thread::sleep_until()
+#include <RF24Log/RF24Logging.h>
+#include <RF24Log/RF24LogParts/Sink.h>
+#include <RF24Log/RF24Loggers/SinkLogger.h>
+#include <RF24Log/handler_ext/RF24LogGovernorHandler.h>
+
+// Define global vendor id
+const char vendorID[] = "RF24LogExample";
+
+// a slow output (like a serial console) that shows the errors and warnings, and counts the rest
+class ConsoleSink : public RF24LogSink
+{
+public:
+    unsigned long lines[3] = {0, 0, 0}; // info, info sublevels, debug (and its sublevels)
+
+    void write(const char *data, size_t length, uint8_t logLevel)
+    {
+        if (logLevel <= RF24LogLevel::WARN + 7)
+        {
+            fwrite(data, 1, length, stdout);
+        }
+        else if (logLevel == RF24LogLevel::INFO)
+        {
+            ++lines[0];
+        }
+        else if (logLevel < RF24LogLevel::DEBUG)
+        {
+            ++lines[1];
+        }
+        else
+        {
+            ++lines[2];
+        }
+    }
+};
+
+ConsoleSink console;
+SinkLogger consoleLogHandler(&console);
+
+// the console can take 4000 lines per second; the messages are counted over 100 ms
+RF24LogGovernorHandler governor(&consoleLogHandler, 4000, 100);
+
+// log 1 info message and 2 traces every 2 milliseconds (or as fast as possible during a storm)
+void traffic(const char *phase, int milliseconds, bool storm)
+{
+    auto start = std::chrono::steady_clock::now();
+    auto end = start + std::chrono::milliseconds(milliseconds);
+    unsigned long before[3] = {console.lines[0], console.lines[1], console.lines[2]};
+    for (int i = 0; std::chrono::steady_clock::now() < end; ++i)
+    {
+        RF24Log_info(vendorID, "received payload #%d", i);
+        RF24Log_log(RF24LogLevel::INFO + 1, vendorID, "payload #%d has %d bytes", i, 32 - i % 8);
+        RF24Log_log(RF24LogLevel::DEBUG + 1, vendorID, "payload #%d: ack %s", i, i % 7 ? "sent" : "lost");
+        if (!storm)
+        {
+            std::this_thread::sleep_until(start + std::chrono::milliseconds(2 * (i + 1)));
+        }
+    }
+    printf("-- %s: the console got %lu info, %lu info sublevel, %lu debug lines (level threshold 0%o)\n",
+           phase, console.lines[0] - before[0], console.lines[1] - before[1], console.lines[2] - before[2],
+           governor.threshold());
+}
+
+int main()
+{
+    governor.setLogLevel(RF24LogLevel::ALL);
+    rf24Logging.setHandler(&governor);
+
+    RF24Log_info(vendorID, "RF24Log/examples/AdaptiveVerbosity");
+    traffic("calm", 500, false);
+    RF24Log_error(vendorID, "the radio stopped responding; retrying in a tight loop");
+    traffic("log storm", 500, true);
+    RF24Log_warn(vendorID, "the radio responds again");
+    traffic("recovery", 1000, false);
+    return 0;
+}
@@ -0,0 +1,58 @@
+/**
+ * @author Brendan Doherty (2bndy5)
+ * @date Created 2026-10-19
+ * @copyright Copyright (C) <br> <br>
+ *    2026        Brendan Doherty (2bndy5) <br>
+ * This General Public License does not permit incorporating your program into
+ * proprietary programs.  If your program is a subroutine library, you may
+ * consider it more useful to permit linking proprietary applications with the
+ * library.  If this is what you want to do, use the GNU Lesser General
+ * Public License instead of this License.
+ */
+
+#include <cstdio> // printf()
+#include <RF24Log/RF24Logging.h>
+#include <RF24Log/RF24Loggers/NativePrintLogger.h>
+
+// Create a stdout log handler
+NativePrintLogger stdoutLogHandler;
+
+// Define global vendor id
+const char vendorID[] = "RF24LogExample";
+const char DisableVendor[] = "";
+
+// print a call site (this is called for every call site, including the ones that haven't run yet)
+void printSite(RF24LogSite *site, void *)
+{
+    printf("    %s:%u level %u \"%s\"\n", site->file, site->line, site->logLevel, site->message);
+}
+
+void radioStatus(int retries)
+{
+    RF24Log_debug(vendorID, "radio status: %d retries", retries);   // switched on below
+    RF24Log_info(vendorID, "radio status: payload sent");           // switched off below
+    RF24Log_debug(vendorID, "radio status: nothing else to report"); // filtered by the log level
+}
+
+int main()
+{
+    stdoutLogHandler.setLogLevel(RF24LogLevel::INFO);
+    rf24Logging.setHandler(&stdoutLogHandler);
+
+    RF24Log_info(vendorID, "RF24Log/examples/CallSites");
+
+    printf("registered call sites:\n");
+    uint16_t count = RF24LogSites::forEach(printSite);
+    printf("%u call sites (0 means RF24LOG_SITES is not defined for this build)\n", count);
+
+    RF24Log_info(vendorID, "before switching the call sites:");
+    radioStatus(3);
+
+    // find the call sites by file and line; line 0 would switch every call site in the file
+    RF24LogSites::setMode("CallSites.cpp", 32, RF24LOG_SITE_ENABLED);
+    RF24LogSites::setMode("CallSites.cpp", 33, RF24LOG_SITE_DISABLED);
+
+    RF24Log_info(vendorID, "after switching the call sites:");
+    radioStatus(3);
+    return 0;
+}
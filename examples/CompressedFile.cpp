@@ -0,0 +1,64 @@
+/**
+ * @author Brendan Doherty (2bndy5)
+ * @date Created 2026-10-19
+ * @copyright Copyright (C) <br> <br>
+ *    2026        Brendan Doherty (2bndy5) <br>
+ * This General Public License does not permit incorporating your program into
+ * proprietary programs.  If your program is a subroutine library, you may
+ * consider it more useful to permit linking proprietary applications with the
+ * library.  If this is what you want to do, use the GNU Lesser General
+ * Public License instead of this License.
+ *
+ * Read the log with the rf24log-unlz tool:
+ *     rf24log-unlz /tmp/rf24log.lz
+ */
+
+#include <cstdio>   // fprintf()
+#include <fcntl.h>  // open()
+#include <unistd.h> // close(), usleep()
+#include <RF24Log/RF24Logging.h>
+#include <RF24Log/RF24Loggers/SinkLogger.h>
+#include <RF24Log/RF24LogSinks/CompressSink.h>
+#include <RF24Log/RF24LogSinks/WritevSink.h>
+
+// Define global vendor id
+const char vendorID[] = "RF24LogExample";
+
+int main(int argc, char **argv)
+{
+    const char *path = argc > 1 ? argv[1] : "/tmp/rf24log.lz";
+    int fd = open(path, O_WRONLY | O_CREAT | O_APPEND, 0644);
+    if (fd < 0)
+    {
+        fprintf(stderr, "could not open %s\n", path);
+        return 1;
+    }
+    {
+        // the compressed blocks go to the file (1 write() per block); nothing else writes the file
+        RF24LogWritevSink fileSink(fd, 65536, 16, 0);
+        RF24LogCompressSink compressSink(&fileSink, 65536, 4, 1000);
+        SinkLogger fileLogHandler(&compressSink);
+        fileLogHandler.setLogLevel(RF24LogLevel::INFO);
+        rf24Logging.setHandler(&fileLogHandler);
+
+        RF24Log_info(vendorID, "RF24Log/examples/CompressedFile");
+        for (int i = 0; i < 100000; ++i)
+        {
+            RF24Log_info(vendorID, "received payload #%d on pipe %d", i, i % 6);
+            if (i % 1000 == 999)
+            {
+                usleep(1000); // the radio traffic comes in bursts
+            }
+        }
+        RF24Log_error(vendorID, "an error is compressed and written without waiting for a full block");
+
+        rf24Logging.setHandler(nullptr);
+        compressSink.flush();
+        fprintf(stderr, "%llu bytes of text were written to %s as %llu bytes (%.1f%%), %llu messages dropped\n",
+                (unsigned long long)compressSink.bytesIn(), path, (unsigned long long)compressSink.bytesOut(),
+                100.0 * (double)compressSink.bytesOut() / (double)compressSink.bytesIn(),
+                (unsigned long long)compressSink.dropped());
+    }
+    close(fd);
+    return 0;
+}
@@ -0,0 +1,110 @@
+/**
+ * @author Brendan Doherty (2bndy5)
+ * @date Created 2026-10-19
+ * @copyright Copyright (C) <br> <br>
+ *    2026        Brendan Doherty (2bndy5) <br>
+ * This General Public License does not permit incorporating your program into
+ * proprietary programs.  If your program is a subroutine library, you may
+ * consider it more useful to permit linking proprietary applications with the
+ * library.  If this is what you want to do, use the GNU Lesser General
+ * Public License instead of this License.
+ */
+
+#include <cstdio>        // printf(), fwrite()
+#include <fcntl.h>       // pipe2(), O_NONBLOCK
+#include <sys/epoll.h>   // epoll_create1(), epoll_ctl(), epoll_wait()
+#include <sys/timerfd.h> // timerfd_create(), timerfd_settime()
+#include <unistd.h>      // read(), close()
+#include <RF24Log/RF24Logging.h>
+#include <RF24Log/handler_ext/RF24LogEventHandler.h>
+
+// Define global vendor id
+const char vendorID[] = "RF24LogExample";
+
+// register (or change) the events of a file descriptor
+void watch(int epoll, int fd, uint32_t events, bool add)
+{
+    struct epoll_event event = {};
+    event.events = events;
+    event.data.fd = fd;
+    epoll_ctl(epoll, add ? EPOLL_CTL_ADD : EPOLL_CTL_MOD, fd, &event);
+}
+
+int main()
+{
+    // the log messages are written to a pipe, whose other end is read slowly by this loop too:
+    // 1 KB every millisecond is less than what is logged, so the pipe fills up
+    int ends[2];
+    if (pipe2(ends, O_NONBLOCK))
+    {
+        return 1;
+    }
+    RF24LogEventHandler handler(ends[1], 16384);
+    handler.setLogLevel(RF24LogLevel::ALL);
+    rf24Logging.setHandler(&handler);
+
+    // a timer logs a burst of messages (and reads the pipe) every millisecond
+    int timer = timerfd_create(CLOCK_MONOTONIC, TFD_NONBLOCK);
+    struct itimerspec interval = {{0, 1000000}, {0, 1000000}};
+    timerfd_settime(timer, 0, &interval, nullptr);
+
+    int epoll = epoll_create1(0);
+    watch(epoll, timer, EPOLLIN, true);
+    watch(epoll, handler.eventFd(), EPOLLIN, true);
+    watch(epoll, handler.fd(), 0, true); // only watched while the pipe is full
+
+    int ticks = 0;
+    unsigned long drains = 0, blocked = 0, lines = 0;
+    char text[1024];
+    while (ticks < 1000)
+    {
+        struct epoll_event events[3];
+        int count = epoll_wait(epoll, events, 3, -1);
+        for (int i = 0; i < count; ++i)
+        {
+            int fd = events[i].data.fd;
+            if (fd == timer)
+            {
+                uint64_t expirations;
+                if (read(timer, &expirations, sizeof(expirations)) > 0)
+                {
+                    ++ticks;
+                    for (int j = 0; j < 20; ++j)
+                    {
+                        RF24Log_info(vendorID, "tick %d: received payload #%d", ticks, j);
+                    }
+                }
+                ssize_t length = read(ends[0], text, sizeof(text));
+                for (ssize_t j = 0; j < length; ++j)
+                {
+                    if (text[j] == '\n' && ++lines == 1)
+                    {
+                        fwrite(text, 1, static_cast<size_t>(j + 1), stdout);
+                    }
+                }
+            }
+            else if (fd == handler.eventFd() || fd == handler.fd())
+            {
+                // write at most 8 KB (or 200 microseconds) per turn of the loop
+                handler.drain(8192, 200);
+                ++drains;
+                if (handler.isBlocked())
+                {
+                    ++blocked;
+                }
+                watch(epoll, handler.fd(), handler.isBlocked() ? static_cast<uint32_t>(EPOLLOUT) : 0, false);
+            }
+        }
+    }
+    rf24Logging.setHandler(nullptr);
+    printf("%lu messages buffered, %lu dropped; %lu lines read from the pipe\n",
+           static_cast<unsigned long>(handler.records()), static_cast<unsigned long>(handler.dropped()), lines);
+    printf("%lu drains (%lu stopped by the full pipe), %lu bytes written, %lu pending\n",
+           drains, blocked, static_cast<unsigned long>(handler.written()),
+           static_cast<unsigned long>(handler.pending()));
+    close(epoll);
+    close(timer);
+    close(ends[0]);
+    close(ends[1]);
+    return 0;
+}
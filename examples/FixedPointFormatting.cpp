@@ -0,0 +1,151 @@
+/**
+ * @author Brendan Doherty (2bndy5)
+ * @date Created 2026-10-19
+ * @copyright Copyright (C) <br> <br>
+ *    2026        Brendan Doherty (2bndy5) <br>
+ * This General Public License does not permit incorporating your program into
+ * proprietary programs.  If your program is a subroutine library, you may
+ * consider it more useful to permit linking proprietary applications with the
+ * library.  If this is what you want to do, use the GNU Lesser General
+ * Public License instead of this License.
+ */
+
+#include <chrono>  // std::chrono::steady_clock
+#include <cmath>   // std::ldexp()
+#include <cstdio>  // printf(), snprintf()
+#include <cstring> // strcmp(), strcspn()
+#include <random>  // std::mt19937_64
+#include <RF24Log/RF24Logging.h>
+#include <RF24Log/RF24Loggers/NativePrintLogger.h>
+#include <RF24Log/RF24LogParts/FixedPoint.h>
+
+// Create a stdout log handler
+NativePrintLogger stdoutLogHandler;
+
+// Define global vendor id
+const char vendorID[] = "RF24LogExample";
+
+// render a split number like the loggers do (digits only, no floating point arithmetic)
+size_t render(const RF24LogFixed &number, char *buffer)
+{
+    static const char names[][4] = {"", "nan", "inf", "ovf"};
+    char *out = buffer;
+    if (number.negative)
+    {
+        *out++ = '-';
+    }
+    if (number.special)
+    {
+        memcpy(out, names[number.special], 4);
+        return static_cast<size_t>(out - buffer) + 3;
+    }
+    char digits[10];
+    int count = 0;
+    uint32_t integer = number.integer;
+    do
+    {
+        digits[count++] = static_cast<char>('0' + integer % 10);
+        integer /= 10;
+    } while (integer);
+    while (count)
+    {
+        *out++ = digits[--count];
+    }
+    if (number.precision)
+    {
+        *out++ = '.';
+        uint32_t fraction = number.fraction;
+        for (int i = number.precision - 1; i >= 0; --i)
+        {
+            out[i] = static_cast<char>('0' + fraction % 10);
+            fraction /= 10;
+        }
+        out += number.precision;
+    }
+    *out = 0;
+    return static_cast<size_t>(out - buffer);
+}
+
+// compare the integer-only rendering with printf() for many values
+unsigned long check(double value, uint8_t precision)
+{
+    char expected[64], actual[64];
+    snprintf(expected, sizeof(expected), "%.*f", precision, value);
+    RF24LogFixed number;
+    number.split(value, precision);
+    render(number, actual);
+    // "ovf" is expected when printf() shows more than 10 integer digits (2^32 or more)
+    size_t integerDigits = strcspn(expected, ".") - number.negative;
+    if (strcmp(expected, actual) && !(number.special == RF24LOG_FIXED_OVF && integerDigits > 10))
+    {
+        printf("mismatch for %a with %d decimals: printf() shows %s, RF24LogFixed shows %s\n",
+               value, precision, expected, actual);
+        return 1;
+    }
+    return 0;
+}
+
+int main()
+{
+    stdoutLogHandler.setLogLevel(RF24LogLevel::ALL);
+    rf24Logging.setHandler(&stdoutLogHandler);
+
+    // numbers that are already stored as scaled integers need no floating point arithmetic at all
+    int temperature = 2153; // hundredths of a degree
+    RF24Log_info(vendorID, "temperature: %.2k C, supply: %.3k V, offset: %6.1k", temperature, 3297, -35);
+
+    // floating point numbers are rendered with integer arithmetic only if RF24LOG_FIXED_POINT is defined
+    RF24Log_info(vendorID, "pi: %.4f, drift: %8.2f, uptime: %f", 3.14159265, -2.5, 1e12);
+
+    // accuracy: ties, carries, tiny, subnormal and large values, then random ones
+    // (a value that rounds to 2^32 or more is output as "ovf", so those aren't compared)
+    const double edges[] = {0.0, -0.0, 0.5, 1.5, 2.5, 0.125, 0.375, 9.995, 0.0049999999999999, 99.99999,
+                            1e-10, 4.9e-324, 2.2250738585072014e-308, 4294967295.0, 4294967295.4,
+                            4294967294.5, 123456.789, -0.001, 1.0 / 3, 2.0 / 3};
+    unsigned long checks = 0, mismatches = 0;
+    for (double value : edges)
+    {
+        for (uint8_t precision = 0; precision <= RF24LOG_FIXED_PRECISION; ++precision)
+        {
+            mismatches += check(value, precision);
+            mismatches += check(-value, precision);
+            checks += 2;
+        }
+    }
+    std::mt19937_64 random(24);
+    for (int i = 0; i < 2000000; ++i)
+    {
+        // random mantissas over a wide range of exponents (most of them fit in 32 bits)
+        double value = std::ldexp(static_cast<double>(random() >> 11), static_cast<int>(random() % 100) - 120);
+        mismatches += check(random() & 1 ? -value : value, static_cast<uint8_t>(random() % 10));
+        ++checks;
+    }
+    printf("%lu values compared with printf(\"%%.*f\"): %lu mismatches\n", checks, mismatches);
+
+    // speed: the integer-only rendering against snprintf()
+    const int count = 1000000;
+    double values[256];
+    for (double &value : values)
+    {
+        value = std::ldexp(static_cast<double>(random() >> 11), -40); // 0 to 8192
+    }
+    char text[64];
+    size_t bytes = 0;
+    auto start = std::chrono::steady_clock::now();
+    for (int i = 0; i < count; ++i)
+    {
+        bytes += static_cast<size_t>(snprintf(text, sizeof(text), "%.3f", values[i & 255]));
+    }
+    double printfTime = std::chrono::duration<double, std::nano>(std::chrono::steady_clock::now() - start).count() / count;
+    start = std::chrono::steady_clock::now();
+    for (int i = 0; i < count; ++i)
+    {
+        RF24LogFixed number;
+        number.split(values[i & 255], 3);
+        bytes += render(number, text);
+    }
+    double fixedTime = std::chrono::duration<double, std::nano>(std::chrono::steady_clock::now() - start).count() / count;
+    printf("%%.3f: snprintf() takes %.0f ns, RF24LogFixed takes %.0f ns (%lu bytes)\n",
+           printfTime, fixedTime, static_cast<unsigned long>(bytes));
+    return 0;
+}
@@ -0,0 +1,61 @@
+/**
+ * @author Brendan Doherty (2bndy5)
+ * @date Created 2026-10-19
+ * @copyright Copyright (C) <br> <br>
+ *    2026        Brendan Doherty (2bndy5) <br>
+ * This General Public License does not permit incorporating your program into
+ * proprietary programs.  If your program is a subroutine library, you may
+ * consider it more useful to permit linking proprietary applications with the
+ * library.  If this is what you want to do, use the GNU Lesser General
+ * Public License instead of this License.
+ */
+
+#include <iostream>
+#include <thread> // std::thread
+#include <RF24Log/RF24Logging.h>
+#include <RF24Log/RF24Loggers/OStreamLogger.h>
+
+// Create hardware serial port log handler
+OStreamLogger serialLogHandler((std::ostream*)&std::cout);
+
+// The header layout is compiled once; logging only walks its list of fields
+RF24LogHeaderPattern threadedHeader("%T.%u %L %V [%N:%t] #%4n: ");
+
+// Define global vendor id
+const char vendorID[] = "RF24LogExample";
+
+void worker(const char *name, int channel)
+{
+    // name the thread for the `%N` field
+    RF24LogHeaderPattern::setThreadName(name);
+    for (int i = 0; i < 3; ++i)
+    {
+        RF24Log_info(vendorID, "listening on channel %d (attempt %d)", channel, i);
+    }
+    RF24Log_warn(vendorID, "giving up on channel %d", channel);
+}
+
+int main()
+{
+    serialLogHandler.setLogLevel(RF24LogLevel::ALL);
+    rf24Logging.setHandler(&serialLogHandler);
+
+    RF24Log_info(vendorID, "the default header");
+
+    serialLogHandler.setHeaderPattern(&threadedHeader);
+    RF24Log_info(vendorID, "a multiline message:\nthe header is repeated on every line");
+
+    std::thread radio0(worker, "radio0", 76);
+    std::thread radio1(worker, "radio1", 110);
+    radio0.join();
+    radio1.join();
+
+    // a pattern can also drop fields from the header
+    RF24LogHeaderPattern terseHeader("%l %V: ");
+    serialLogHandler.setHeaderPattern(&terseHeader);
+    RF24Log_error(vendorID, "a terse header");
+
+    serialLogHandler.setHeaderPattern(nullptr);
+    RF24Log_info(vendorID, "the default header again");
+    return 0;
+}
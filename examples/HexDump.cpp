@@ -0,0 +1,94 @@
+/**
+ * @author Brendan Doherty (2bndy5)
+ * @date Created 2026-10-19
+ * @copyright Copyright (C) <br> <br>
+ *    2026        Brendan Doherty (2bndy5) <br>
+ * This General Public License does not permit incorporating your program into
+ * proprietary programs.  If your program is a subroutine library, you may
+ * consider it more useful to permit linking proprietary applications with the
+ * library.  If this is what you want to do, use the GNU Lesser General
+ * Public License instead of this License.
+ */
+
+#include <chrono> // std::chrono::steady_clock
+#include <cstdio> // printf()
+#include <RF24Log/RF24Logging.h>
+#include <RF24Log/RF24Loggers/NativePrintLogger.h>
+#include <RF24Log/RF24LogParts/LineFormatter.h>
+#include <RF24Log/handler_ext/RF24LogIsrHandler.h>
+
+// Create a stdout log handler
+NativePrintLogger stdoutLogHandler;
+
+// Create a handler that captures the messages (copying the payloads) to output them later
+RF24LogRecordSlot slots[8];
+RF24LogIsrHandler captureLogHandler(&stdoutLogHandler, slots, 8);
+
+// formats the messages without outputting them (to measure the formatting only)
+class CountingFormatter : public RF24LogLineFormatter
+{
+public:
+    size_t bytes = 0;
+
+protected:
+    void writeLine(const char *, size_t length, uint8_t) { bytes += length; }
+};
+CountingFormatter countingLogHandler;
+
+// Define global vendor id
+const char vendorID[] = "RF24LogExample";
+
+// the time to log a 32-byte payload (in nanoseconds)
+template <typename LogPayload>
+double logTime(const uint8_t *payload, LogPayload logPayload)
+{
+    const int count = 200000;
+    auto start = std::chrono::steady_clock::now();
+    for (int i = 0; i < count; ++i)
+    {
+        logPayload(payload);
+    }
+    return std::chrono::duration<double, std::nano>(std::chrono::steady_clock::now() - start).count() / count;
+}
+
+int main()
+{
+    stdoutLogHandler.setLogLevel(RF24LogLevel::ALL);
+    captureLogHandler.setLogLevel(RF24LogLevel::ALL);
+    countingLogHandler.setLogLevel(RF24LogLevel::ALL);
+    rf24Logging.setHandler(&stdoutLogHandler);
+
+    uint8_t payload[32];
+    for (int i = 0; i < 32; ++i)
+    {
+        payload[i] = static_cast<uint8_t>(i < 8 ? "RF24Log!"[i] : i * 7);
+    }
+
+    // a pointer and a length replace the `H` specifier
+    RF24Log_info(vendorID, "payload: %H", payload, 8);
+    RF24Log_info(vendorID, "grouped by 1 byte: %1H", payload, 8);
+    RF24Log_info(vendorID, "grouped by 8 bytes: %8H", payload, 32);
+    RF24Log_info(vendorID, "with an ASCII column: %#4H", payload, 16);
+    RF24Log_hexdump(RF24LogLevel::DEBUG, vendorID, payload, sizeof(payload));
+
+    // a captured message holds a copy of the payload, so the payload can change before the output
+    rf24Logging.setHandler(&captureLogHandler);
+    RF24Log_info(vendorID, "captured payload: %1H", payload, 8);
+    payload[0] = 0;
+    captureLogHandler.poll();
+
+    // formatting a payload with 1 specifier per byte, and with 1 `H` specifier
+    rf24Logging.setHandler(&countingLogHandler);
+    double perByte = logTime(payload, [](const uint8_t *p) {
+        RF24Log_info(vendorID,
+                     "payload: %02X%02X%02X%02X%02X%02X%02X%02X%02X%02X%02X%02X%02X%02X%02X%02X"
+                     "%02X%02X%02X%02X%02X%02X%02X%02X%02X%02X%02X%02X%02X%02X%02X%02X",
+                     p[0], p[1], p[2], p[3], p[4], p[5], p[6], p[7], p[8], p[9], p[10], p[11], p[12], p[13],
+                     p[14], p[15], p[16], p[17], p[18], p[19], p[20], p[21], p[22], p[23], p[24], p[25],
+                     p[26], p[27], p[28], p[29], p[30], p[31]);
+    });
+    double hexDump = logTime(payload, [](const uint8_t *p) { RF24Log_info(vendorID, "payload: %H", p, 32); });
+    printf("a 32-byte payload takes %.0f ns with 32 %%02X specifiers, %.0f ns with 1 %%H specifier\n",
+           perByte, hexDump);
+    return 0;
+}
@@ -0,0 +1,80 @@
+/**
+ * @author Brendan Doherty (2bndy5)
+ * @date Created 2026-10-19
+ * @copyright Copyright (C) <br> <br>
+ *    2026        Brendan Doherty (2bndy5) <br>
+ * This General Public License does not permit incorporating your program into
+ * proprietary programs.  If your program is a subroutine library, you may
+ * consider it more useful to permit linking proprietary applications with the
+ * library.  If this is what you want to do, use the GNU Lesser General
+ * Public License instead of this License.
+ */
+
+#include <cstdio>   // fprintf(), fwrite()
+#include <unistd.h> // unlink()
+#include <RF24Log/RF24Logging.h>
+#include <RF24Log/RF24LogParts/LineFormatter.h>
+#include <RF24Log/handler_ext/RF24LogIndexedHandler.h>
+
+// writes the messages to an indexed binary log file
+RF24LogIndexedHandler fileLogHandler(16384);
+
+// formats the messages that are read back
+class StdoutFormatter : public RF24LogLineFormatter
+{
+protected:
+    void writeLine(const char *data, size_t length, uint8_t) { fwrite(data, 1, length, stdout); }
+};
+
+const char networkID[] = "RF24Network";
+const char meshID[] = "RF24Mesh";
+const char path[] = "/tmp/rf24log-example.idx";
+
+int main()
+{
+    unlink(path);
+    fileLogHandler.setLogLevel(RF24LogLevel::ALL);
+    fileLogHandler.open(path);
+    rf24Logging.setHandler(&fileLogHandler);
+
+    // log a lot of traffic, with a few problems in the middle
+    RF24LogTime incident = 0;
+    for (int i = 0; i < 200000; ++i)
+    {
+        RF24Log_debug(meshID, "address request from node %d", i % 255);
+        RF24Log_info(networkID, "received payload #%d on pipe %d", i, i % 6);
+        if (i == 100000)
+        {
+            incident = rf24LogNow();
+            RF24Log_warn(networkID, "node %o is not responding", 011);
+            RF24Log_error(networkID, "route to node %o failed after %d retries", 011, 15);
+        }
+    }
+    rf24Logging.setHandler(nullptr);
+    fileLogHandler.close();
+
+    // find the errors & warnings of RF24Network around the incident
+    RF24LogIndexedReader reader;
+    if (!reader.open(path))
+    {
+        fprintf(stderr, "can't read %s\n", path);
+        return 1;
+    }
+    reader.setTimeRange(incident - 1000000, incident + 1000000);
+    reader.setLevelRange(RF24LogLevel::ERROR, RF24LogLevel::WARN + 7);
+    reader.setVendor(networkID);
+
+    StdoutFormatter formatter;
+    RF24LogIndexedMessage message;
+    char line[RF24LOG_LINE_SIZE];
+    while (reader.next(&message))
+    {
+        RF24LogArgList args(message.args, message.argsSize);
+        size_t length = formatter.format(line, sizeof(line), message.logLevel, message.vendorId,
+                                         message.message, &args, message.timestamp);
+        fwrite(line, 1, length, stdout);
+    }
+    fprintf(stderr, "read %zu of %zu blocks (%zu skipped thanks to the index)\n",
+            reader.blocksRead(), reader.blockCount(), reader.blocksSkipped());
+    return 0;
+}
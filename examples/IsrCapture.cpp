@@ -0,0 +1,71 @@
+/**
+ * @author Brendan Doherty (2bndy5)
+ * @date Created 2026-10-19
+ * @copyright Copyright (C) <br> <br>
+ *    2026        Brendan Doherty (2bndy5) <br>
+ * This General Public License does not permit incorporating your program into
+ * proprietary programs.  If your program is a subroutine library, you may
+ * consider it more useful to permit linking proprietary applications with the
+ * library.  If this is what you want to do, use the GNU Lesser General
+ * Public License instead of this License.
+ */
+
+#include <csignal>    // signal(), SIGALRM
+#include <sys/time.h> // setitimer()
+#include <unistd.h>   // usleep()
+#include <RF24Log/RF24Logging.h>
+#include <RF24Log/RF24Loggers/NativePrintLogger.h>
+#include <RF24Log/handler_ext/RF24LogIsrHandler.h>
+
+// Create a stdout log handler (used from the main program only)
+NativePrintLogger stdoutLogHandler;
+
+// Create the ISR-safe handler with static storage for 64 captured messages
+RF24LogRecordSlot isrSlots[64];
+RF24LogIsrHandler isrLogHandler(&stdoutLogHandler, isrSlots, 64);
+
+// Define global vendor id
+const char vendorID[] = "RF24LogExample";
+const char DisableVendor[] = "";
+
+volatile sig_atomic_t tick = 0;
+
+// A POSIX signal handler is the stand-in for a radio's IRQ handler on Linux.
+// It is not safe to call printf() here, but it is safe to log through isrLogHandler.
+void onAlarm(int)
+{
+    ++tick;
+    RF24Log_info(vendorID, "IRQ #%d fired (%s)", (int)tick, "captured in a signal handler");
+    if (tick % 10 == 0)
+    {
+        RF24Log_warn(vendorID, "IRQ #%d: every 10th IRQ has a temperature of %.2F", (int)tick, 21.5 + tick / 10);
+    }
+}
+
+int main()
+{
+    stdoutLogHandler.setLogLevel(RF24LogLevel::ALL);
+    isrLogHandler.setLogLevel(RF24LogLevel::ALL);
+    rf24Logging.setHandler(&isrLogHandler);
+
+    RF24Log_info(vendorID, "RF24Log/examples/IsrCapture");
+    isrLogHandler.poll();
+
+    signal(SIGALRM, onAlarm);
+    struct itimerval timer = {{0, 2000}, {0, 2000}}; // fire every 2 milliseconds
+    setitimer(ITIMER_REAL, &timer, nullptr);
+
+    while (tick < 100)
+    {
+        usleep(20000);
+        // drain the captured messages from normal context
+        isrLogHandler.poll();
+    }
+
+    timer = {{0, 0}, {0, 0}};
+    setitimer(ITIMER_REAL, &timer, nullptr);
+    isrLogHandler.poll();
+    RF24Log_log(0, DisableVendor, "%d messages were dropped because the queue was full", (int)isrLogHandler.dropped());
+    isrLogHandler.poll();
+    return 0;
+}
@@ -0,0 +1,79 @@
+/**
+ * @author Brendan Doherty (2bndy5)
+ * @date Created 2026-10-19
+ * @copyright Copyright (C) <br> <br>
+ *    2026        Brendan Doherty (2bndy5) <br>
+ * This General Public License does not permit incorporating your program into
+ * proprietary programs.  If your program is a subroutine library, you may
+ * consider it more useful to permit linking proprietary applications with the
+ * library.  If this is what you want to do, use the GNU Lesser General
+ * Public License instead of this License.
+ */
+
+#include <cstdio>   // fprintf()
+#include <iostream> // std::cerr
+#include <unistd.h> // STDOUT_FILENO
+#include <RF24Log/RF24Logging.h>
+#include <RF24Log/RF24Loggers/NativePrintLogger.h>
+#include <RF24Log/RF24Loggers/OStreamLogger.h>
+#include <RF24Log/RF24Loggers/SinkLogger.h>
+#include <RF24Log/RF24LogSinks/WritevSink.h>
+#include <RF24Log/handler_ext/RF24LogIsrHandler.h>
+#include <RF24Log/handler_ext/RF24LogRouterHandler.h>
+
+// route 0: errors and warnings are written to stderr immediately
+OStreamLogger stderrLogHandler((std::ostream*)&std::cerr);
+
+// route 1: info messages are batched to stdout
+RF24LogWritevSink stdoutSink(STDOUT_FILENO, 16384, 128, 50);
+SinkLogger stdoutLogHandler(&stdoutSink);
+
+// route 2: the debug sublevels are kept in memory, and only output when something goes wrong
+NativePrintLogger dumpLogHandler;
+RF24LogRecordSlot traceSlots[64];
+RF24LogIsrHandler traceLogHandler(&dumpLogHandler, traceSlots, 64);
+
+RF24LogBaseHandler *const handlers[] = {&stderrLogHandler, &stdoutLogHandler, &traceLogHandler};
+
+// the routes by level; a level routed to no handler (like DEBUG itself) is discarded
+RF24LogRouteTable normalRoutes;
+RF24LogRouteTable incidentRoutes;
+
+// Define global vendor id
+const char vendorID[] = "RF24LogExample";
+
+int main()
+{
+    normalRoutes.set(RF24LogLevel::ERROR, RF24LogLevel::WARN + 7, 0);
+    normalRoutes.set(RF24LogLevel::INFO, RF24LogLevel::INFO + 7, 1);
+    normalRoutes.set(RF24LogLevel::DEBUG + 1, RF24LogLevel::DEBUG + 7, 2);
+
+    // while investigating an incident, everything goes to stderr
+    incidentRoutes.set(RF24LogLevel::ERROR, RF24LogLevel::DEBUG + 7, 0);
+
+    RF24LogRouterHandler router(handlers, 3, &normalRoutes);
+    router.setLogLevel(RF24LogLevel::ALL);
+    dumpLogHandler.setLogLevel(RF24LogLevel::ALL);
+    rf24Logging.setHandler(&router);
+
+    RF24Log_info(vendorID, "RF24Log/examples/LevelRouting");
+    for (int i = 0; i < 100; ++i)
+    {
+        RF24Log_info(vendorID, "received payload #%d on pipe %d", i, i % 6);
+        RF24Log_log(RF24LogLevel::DEBUG + 1, vendorID, "payload #%d: %d bytes, ack %s", i, 32 - i % 8, i % 7 ? "sent" : "lost");
+        RF24Log_debug(vendorID, "this DEBUG message is routed nowhere");
+    }
+    RF24Log_warn(vendorID, "%d packets were lost", 15);
+    stdoutSink.flush();
+
+    // dump the traces (the ones that didn't fit in memory were dropped)
+    RF24Log_error(vendorID, "the radio stopped responding; the traces are:");
+    traceLogHandler.poll();
+    fprintf(stderr, "(%d traces did not fit in memory)\n", (int)traceLogHandler.dropped());
+
+    // the route table is swapped without stopping the loggers
+    router.setTable(&incidentRoutes);
+    RF24Log_info(vendorID, "the radio was reset");
+    RF24Log_debug(vendorID, "the radio's registers are reloaded");
+    return 0;
+}
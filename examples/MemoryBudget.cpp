@@ -0,0 +1,84 @@
+/**
+ * @author Brendan Doherty (2bndy5)
+ * @date Created 2026-10-19
+ * @copyright Copyright (C) <br> <br>
+ *    2026        Brendan Doherty (2bndy5) <br>
+ * This General Public License does not permit incorporating your program into
+ * proprietary programs.  If your program is a subroutine library, you may
+ * consider it more useful to permit linking proprietary applications with the
+ * library.  If this is what you want to do, use the GNU Lesser General
+ * Public License instead of this License.
+ */
+
+#include <cstdio> // printf(), fflush()
+#include <RF24Log/RF24Logging.h>
+#include <RF24Log/RF24LogParts/Memory.h>
+#include <RF24Log/RF24LogSinks/WritevSink.h>
+#include <RF24Log/handler_ext/RF24LogLaneHandler.h>
+
+// Define global vendor id
+const char vendorID[] = "RF24LogExample";
+
+void printMemory(const char *title)
+{
+    printf("%-40s used %7d, cached %7d, peak %7d bytes (%d shrunk, %d refused, %d overdrafts)\n", title,
+           static_cast<int>(RF24LogMemory::used()), static_cast<int>(RF24LogMemory::cached()),
+           static_cast<int>(RF24LogMemory::peak()), static_cast<int>(RF24LogMemory::shrunk()),
+           static_cast<int>(RF24LogMemory::refused()), static_cast<int>(RF24LogMemory::overdrafts()));
+    fflush(stdout); // the sink writes to the same file descriptor
+}
+
+// log a few messages through a lane handler that writes to stdout
+void logThrough(RF24LogLaneHandler &logHandler, const char *title)
+{
+    logHandler.setLogLevel(RF24LogLevel::ALL);
+    rf24Logging.setHandler(&logHandler);
+    RF24Log_info(vendorID, "%s: logging works", title);
+    RF24Log_warn(vendorID, "%s: still logging", title);
+    logHandler.flush();
+    rf24Logging.setHandler(nullptr);
+}
+
+int main()
+{
+    // all of the logging buffers share 512 KiB
+    RF24LogMemory::setBudget(512 * 1024);
+    printMemory("budget of 512 KiB");
+
+    RF24LogWritevSink stdoutSink(1); // 2 batches of 64 KiB
+    printMemory("after a RF24LogWritevSink");
+
+    {
+        RF24LogLaneHandler logHandler(&stdoutSink, 10, 256);
+        printMemory("after a RF24LogLaneHandler");
+        logThrough(logHandler, "fits");
+    }
+    printMemory("after destroying it (kept for reuse)");
+
+    {
+        // a handler of the same size reuses the blocks without allocating memory
+        RF24LogLaneHandler logHandler(&stdoutSink, 10, 256);
+        printMemory("after the same RF24LogLaneHandler again");
+
+        // 3 lanes of 1024 slots don't fit in the rest of the budget: the lanes get fewer slots
+        RF24LogLaneHandler shrunk(&stdoutSink, 10, 1024);
+        printMemory("after a RF24LogLaneHandler (shrunk)");
+        logThrough(shrunk, "shrunk");
+
+        // the remaining budget is too small: the lanes write synchronously
+        RF24LogMemory::setBudget(512 * 1024, RF24LOG_BUDGET_REFUSE);
+        RF24LogLaneHandler refused(&stdoutSink, 10, 1024);
+        printMemory("after a RF24LogLaneHandler (refused)");
+        logThrough(refused, "refused");
+
+        // sizing a budget: the buffers are allocated anyway, and the overdrafts are counted
+        RF24LogMemory::setBudget(512 * 1024, RF24LOG_BUDGET_OVERDRAFT);
+        RF24LogLaneHandler overdrawn(&stdoutSink, 10, 1024);
+        printMemory("after a RF24LogLaneHandler (overdraft)");
+        logThrough(overdrawn, "overdraft");
+    }
+    printMemory("after destroying them");
+    RF24LogMemory::trim();
+    printMemory("after RF24LogMemory::trim()");
+    return 0;
+}
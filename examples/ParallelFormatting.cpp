@@ -0,0 +1,104 @@
+/**
+ * @author Brendan Doherty (2bndy5)
+ * @date Created 2026-10-19
+ * @copyright Copyright (C) <br> <br>
+ *    2026        Brendan Doherty (2bndy5) <br>
+ * This General Public License does not permit incorporating your program into
+ * proprietary programs.  If your program is a subroutine library, you may
+ * consider it more useful to permit linking proprietary applications with the
+ * library.  If this is what you want to do, use the GNU Lesser General
+ * Public License instead of this License.
+ */
+
+#include <atomic>  // std::atomic
+#include <chrono>  // std::chrono::steady_clock
+#include <cstdio>  // fprintf()
+#include <cstdlib> // strtoul()
+#include <cstring> // strstr()
+#include <thread>  // std::thread
+#include <vector>
+#include <RF24Log/RF24Logging.h>
+#include <RF24Log/RF24LogParts/Sink.h>
+#include <RF24Log/handler_ext/RF24LogParallelHandler.h>
+
+// Define global vendor id
+const char vendorID[] = "RF24LogExample";
+
+const unsigned producers = 2;
+const int messages = 200000; // per producer
+
+// a sink that discards the messages, but checks that each producer's messages arrive in order
+class CheckingSink : public RF24LogSink
+{
+public:
+    unsigned long next[producers] = {};
+    unsigned long outOfOrder = 0;
+    unsigned long long bytes = 0;
+
+    void write(const char *data, size_t length, uint8_t)
+    {
+        // "... producer P message #N ..." (the sink is only called by 1 worker at a time)
+        const char *field = strstr(data, "producer ");
+        if (field != nullptr)
+        {
+            char *end;
+            unsigned long producer = strtoul(field + 9, &end, 10);
+            unsigned long number = strtoul(end + 10, nullptr, 10);
+            if (producer < producers && number != next[producer]++)
+            {
+                ++outOfOrder;
+            }
+        }
+        bytes += length;
+    }
+};
+
+void produce(int producer)
+{
+    for (int i = 0; i < messages; ++i)
+    {
+        RF24Log_info(vendorID, "producer %d message #%d from node 0%o, RSSI %.2D dBm, channel %d, %s",
+                     producer, i, i % 64, -40.0 - (double)(i % 50) / 4, i % 126, "ack");
+    }
+}
+
+// log the messages from the producer threads; returns the messages per second
+double measure(unsigned workers)
+{
+    CheckingSink sink;
+    RF24LogParallelHandler handler(&sink, workers, 8192, true);
+    handler.setLogLevel(RF24LogLevel::INFO);
+    rf24Logging.setHandler(&handler);
+
+    auto start = std::chrono::steady_clock::now();
+    std::vector<std::thread> threads;
+    for (unsigned i = 0; i < producers; ++i)
+    {
+        threads.emplace_back(produce, (int)i);
+    }
+    for (std::thread &thread : threads)
+    {
+        thread.join();
+    }
+    handler.flush();
+    auto end = std::chrono::steady_clock::now();
+    rf24Logging.setHandler(nullptr);
+
+    double seconds = std::chrono::duration<double>(end - start).count();
+    fprintf(stderr, "%2u workers: %9.0f messages/s (%llu bytes, %lu out of order, %llu dropped)\n",
+            workers, (double)handler.records() / seconds, sink.bytes, sink.outOfOrder,
+            (unsigned long long)handler.dropped());
+    return (double)handler.records() / seconds;
+}
+
+int main()
+{
+    unsigned cores = std::thread::hardware_concurrency();
+    fprintf(stderr, "%u producers log %d messages each; %u CPU cores\n", producers, messages, cores);
+    double single = measure(1);
+    for (unsigned workers = 2; workers <= (cores > 2 ? cores : 2); workers *= 2)
+    {
+        fprintf(stderr, "           %.2fx the throughput of 1 worker\n", measure(workers) / single);
+    }
+    return 0;
+}
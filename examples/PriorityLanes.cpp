@@ -0,0 +1,122 @@
+/**
+ * @author Brendan Doherty (2bndy5)
+ * @date Created 2026-10-19
+ * @copyright Copyright (C) <br> <br>
+ *    2026        Brendan Doherty (2bndy5) <br>
+ * This General Public License does not permit incorporating your program into
+ * proprietary programs.  If your program is a subroutine library, you may
+ * consider it more useful to permit linking proprietary applications with the
+ * library.  If this is what you want to do, use the GNU Lesser General
+ * Public License instead of this License.
+ */
+
+#include <chrono>  // std::chrono::steady_clock
+#include <cstdio>  // fprintf(), fwrite()
+#include <cstdlib> // strtol()
+#include <cstring> // strstr()
+#include <RF24Log/RF24Logging.h>
+#include <RF24Log/RF24LogParts/Sink.h>
+#include <RF24Log/handler_ext/RF24LogLaneHandler.h>
+
+// Define global vendor id
+const char vendorID[] = "RF24LogExample";
+
+const int errors = 200;
+std::chrono::steady_clock::time_point loggedAt[errors];
+
+// a slow sink (like a file on an SD card) that measures how long each error took to reach it
+class SlowSink : public RF24LogSink
+{
+public:
+    double worstLatency = 0; // microseconds
+    double totalLatency = 0;
+    int errorsSeen = 0;
+    FILE *echo = nullptr;
+
+    void write(const char *data, size_t length, uint8_t logLevel)
+    {
+        if (echo != nullptr)
+        {
+            fwrite(data, 1, length, echo);
+        }
+        if (logLevel == RF24LogLevel::ERROR)
+        {
+            const char *field = strstr(data, "error #");
+            int number = field != nullptr ? (int)strtol(field + 7, nullptr, 10) : -1;
+            if (number >= 0 && number < errors)
+            {
+                double latency = std::chrono::duration<double, std::micro>(std::chrono::steady_clock::now() - loggedAt[number]).count();
+                worstLatency = latency > worstLatency ? latency : worstLatency;
+                totalLatency += latency;
+                ++errorsSeen;
+            }
+        }
+        // every record costs 2 microseconds
+        auto until = std::chrono::steady_clock::now() + std::chrono::microseconds(2);
+        while (std::chrono::steady_clock::now() < until) {}
+    }
+};
+
+// a flood of debug traces, with an error every 500 messages
+void flood(RF24LogLaneHandler *handler)
+{
+    for (int i = 0; i < errors * 500; ++i)
+    {
+        if (i % 500 == 0)
+        {
+            loggedAt[i / 500] = std::chrono::steady_clock::now();
+            RF24Log_error(vendorID, "error #%d", i / 500);
+        }
+        else if (i % 50 == 0)
+        {
+            RF24Log_info(vendorID, "received payload #%d", i);
+        }
+        else
+        {
+            RF24Log_log(RF24LogLevel::DEBUG + 1, vendorID, "trace #%d: %d bytes on pipe %d", i, 32 - i % 8, i % 6);
+        }
+    }
+    handler->flush();
+}
+
+void measure(const char *name, uint8_t urgentPolicy)
+{
+    SlowSink sink;
+    RF24LogLaneHandler handler(&sink, 20, 4096);
+    handler.setPolicy(RF24LOG_LANE_URGENT, urgentPolicy);
+    handler.setLogLevel(RF24LogLevel::ALL);
+    rf24Logging.setHandler(&handler);
+    flood(&handler);
+    rf24Logging.setHandler(nullptr);
+    fprintf(stderr, "%-24s errors: %3d, mean latency %8.1f us, worst %8.1f us; info written %llu; debug written %llu, dropped %llu\n",
+            name, sink.errorsSeen, sink.totalLatency / (sink.errorsSeen ? sink.errorsSeen : 1), sink.worstLatency,
+            (unsigned long long)handler.written(RF24LOG_LANE_INFO),
+            (unsigned long long)handler.written(RF24LOG_LANE_DEBUG),
+            (unsigned long long)handler.dropped(RF24LOG_LANE_DEBUG));
+}
+
+int main()
+{
+    // errors and warnings overtake the queued messages; the debug traces are shed when they
+    // can't be written fast enough
+    measure("synchronous errors:", RF24LOG_LANE_SYNC);
+    measure("queued errors:", RF24LOG_LANE_BLOCK);
+
+    // the numbers in the header show the order in which the messages were logged
+    SlowSink sink;
+    sink.echo = stdout;
+    RF24LogHeaderPattern numbered("#%n %L %V: ");
+    RF24LogLaneHandler handler(&sink, 20, 16);
+    handler.setHeaderPattern(&numbered);
+    handler.setLogLevel(RF24LogLevel::ALL);
+    rf24Logging.setHandler(&handler);
+    for (int i = 0; i < 3; ++i)
+    {
+        RF24Log_info(vendorID, "received payload #%d", i);
+        RF24Log_log(RF24LogLevel::DEBUG + 1, vendorID, "trace #%d", i);
+    }
+    RF24Log_error(vendorID, "error #%d is written before the queued messages", errors);
+    handler.flush();
+    rf24Logging.setHandler(nullptr);
+    return 0;
+}
@@ -0,0 +1,77 @@
+/**
+ * @author Brendan Doherty (2bndy5)
+ * @date Created 2026-10-19
+ * @copyright Copyright (C) <br> <br>
+ *    2026        Brendan Doherty (2bndy5) <br>
+ * This General Public License does not permit incorporating your program into
+ * proprietary programs.  If your program is a subroutine library, you may
+ * consider it more useful to permit linking proprietary applications with the
+ * library.  If this is what you want to do, use the GNU Lesser General
+ * Public License instead of this License.
+ */
+
+#include <cstdio> // printf(), fopen(), freopen()
+#include <thread> // std::thread
+#include <RF24Log/RF24Logging.h>
+#include <RF24Log/RF24Loggers/NativePrintLogger.h>
+#include <RF24Log/RF24LogParts/Profiler.h>
+
+// Create a stdout log handler
+NativePrintLogger stdoutLogHandler;
+
+// Define global vendor id
+const char vendorID[] = "RF24LogExample";
+
+void worker(int id)
+{
+    for (int i = 0; i < 2000; ++i)
+    {
+        RF24Log_info(vendorID, "worker %d sent payload #%d (%.2D volts)", id, i, 3.3);
+        RF24Log_debug(vendorID, "worker %d is filtered by the log level", id);
+        if (i % 100 == 0)
+        {
+            RF24Log_warn(vendorID, "worker %d: %s", id, "a short message");
+        }
+    }
+}
+
+int main()
+{
+#if defined (RF24LOG_PROFILE)
+    stdoutLogHandler.setLogLevel(RF24LogLevel::INFO);
+    rf24Logging.setHandler(&stdoutLogHandler);
+
+    // the profiled messages go to /dev/null; the report goes to stderr
+    if (freopen("/dev/null", "w", stdout) == nullptr)
+    {
+        return 1;
+    }
+    std::thread first(worker, 1);
+    std::thread second(worker, 2);
+    first.join();
+    second.join();
+
+    RF24LogProfiler::Report reports[5];
+    uint16_t count = RF24LogProfiler::report(reports, 5);
+    fprintf(stderr, "%10s %10s %14s %14s  %s\n", "calls", "filtered", "format cycles", "sink cycles", "message");
+    for (uint16_t i = 0; i < count; ++i)
+    {
+        RF24LogProfiler::Report *r = &reports[i];
+        fprintf(stderr, "%10llu %10llu %14llu %14llu  \"%s\"",
+                (unsigned long long)r->calls, (unsigned long long)r->filtered,
+                (unsigned long long)r->formatCycles, (unsigned long long)r->sinkCycles,
+                r->message != nullptr ? r->message : "(other messages)");
+        // attribute the message back to its source line (when the call site registry is available)
+        RF24LogSite *site = RF24LogSites::find(r->message);
+        if (site != nullptr)
+        {
+            fprintf(stderr, " at %s:%u", site->file, site->line);
+        }
+        fprintf(stderr, "\n");
+    }
+#else
+    (void)worker;
+    printf("Build the RF24Log lib and this example with RF24LOG_PROFILE defined to run the profiler.\n");
+#endif
+    return 0;
+}
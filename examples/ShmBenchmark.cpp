@@ -0,0 +1,104 @@
+/**
+ * @author Brendan Doherty (2bndy5)
+ * @date Created 2026-10-19
+ * @copyright Copyright (C) <br> <br>
+ *    2026        Brendan Doherty (2bndy5) <br>
+ * This General Public License does not permit incorporating your program into
+ * proprietary programs.  If your program is a subroutine library, you may
+ * consider it more useful to permit linking proprietary applications with the
+ * library.  If this is what you want to do, use the GNU Lesser General
+ * Public License instead of this License.
+ */
+
+#include <atomic>  // std::atomic
+#include <chrono>  // std::chrono::steady_clock
+#include <cstdio>  // fprintf()
+#include <thread>  // std::thread
+#include <RF24Log/RF24Logging.h>
+#include <RF24Log/RF24Loggers/NativePrintLogger.h>
+#include <RF24Log/handler_ext/RF24LogShmHandler.h>
+
+// the stdout handler that is being compared to
+NativePrintLogger stdoutLogHandler;
+
+// the shared memory handlers (binary form & text form)
+RF24LogShmHandler binaryShmHandler;
+RF24LogShmHandler textShmHandler(false);
+
+const char vendorID[] = "RF24LogExample";
+const char ringName[] = "/rf24log-benchmark";
+const int messages = 200000;
+
+std::atomic<bool> consuming(false);
+
+// a stand-in for the rf24log-shmd daemon (discards the records)
+void consume()
+{
+    RF24LogShmRing ring;
+    while (!ring.attach(ringName))
+    {
+        std::this_thread::yield();
+    }
+    while (true)
+    {
+        bool stopping = !consuming.load();
+        while (ring.front() != nullptr)
+        {
+            ring.pop();
+        }
+        if (stopping)
+        {
+            break;
+        }
+        std::this_thread::yield();
+    }
+}
+
+// log the messages through a handler; returns the nanoseconds per message
+double measure(RF24LogBaseHandler *handler)
+{
+    rf24Logging.setHandler(handler);
+    auto start = std::chrono::steady_clock::now();
+    for (int i = 0; i < messages; ++i)
+    {
+        RF24Log_info(vendorID, "payload #%d from node %s, RSSI %.1D dBm", i, "alpha", -42.5);
+    }
+    auto end = std::chrono::steady_clock::now();
+    rf24Logging.setHandler(nullptr);
+    return std::chrono::duration<double, std::nano>(end - start).count() / messages;
+}
+
+// log the messages through a shared memory handler while another thread drains the ring
+double measureShm(RF24LogShmHandler *handler)
+{
+    RF24LogShmRing::unlink(ringName);
+    handler->open(ringName, 65536, 256);
+    consuming = true;
+    std::thread consumer(consume);
+    double result = measure(handler);
+    consuming = false;
+    consumer.join();
+    fprintf(stderr, "  (%llu messages dropped because the ring was full)\n", (unsigned long long)handler->dropped());
+    handler->close();
+    RF24LogShmRing::unlink(ringName);
+    return result;
+}
+
+int main()
+{
+    stdoutLogHandler.setLogLevel(RF24LogLevel::INFO);
+    binaryShmHandler.setLogLevel(RF24LogLevel::INFO);
+    textShmHandler.setLogLevel(RF24LogLevel::INFO);
+
+    // redirect stdout to a file or /dev/null to measure the stdout handler without a terminal
+    fprintf(stderr, "logging %d messages per handler\n", messages);
+    double stdoutNs = measure(&stdoutLogHandler);
+    fflush(stdout);
+    double binaryNs = measureShm(&binaryShmHandler);
+    double textNs = measureShm(&textShmHandler);
+
+    fprintf(stderr, "NativePrintLogger (stdout): %8.1f ns per message\n", stdoutNs);
+    fprintf(stderr, "RF24LogShmHandler (binary): %8.1f ns per message\n", binaryNs);
+    fprintf(stderr, "RF24LogShmHandler (text):   %8.1f ns per message\n", textNs);
+    return 0;
+}
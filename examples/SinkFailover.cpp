@@ -0,0 +1,134 @@
+/**
+ * @author Brendan Doherty (2bndy5)
+ * @date Created 2026-10-19
+ * @copyright Copyright (C) <br> <br>
+ *    2026        Brendan Doherty (2bndy5) <br>
+ * This General Public License does not permit incorporating your program into
+ * proprietary programs.  If your program is a subroutine library, you may
+ * consider it more useful to permit linking proprietary applications with the
+ * library.  If this is what you want to do, use the GNU Lesser General
+ * Public License instead of this License.
+ */
+
+#include <atomic>  // std::atomic
+#include <chrono>  // std::chrono::steady_clock
+#include <cstdio>  // printf(), fwrite()
+#include <thread>  // std::this_thread::sleep_for()
+#include <RF24Log/RF24Logging.h>
+#include <RF24Log/RF24Loggers/SinkLogger.h>
+#include <RF24Log/RF24LogSinks/WatchdogSink.h>
+
+using namespace std::chrono;
+
+// a sink that writes to stdout, and that can be stalled (like a wedged network mount)
+class StallingSink : public RF24LogSink
+{
+public:
+    std::atomic<bool> stalled{false};
+
+    void write(const char *data, size_t length, uint8_t)
+    {
+        waitWhileStalled();
+        fwrite(data, 1, length, stdout);
+    }
+
+    void flush()
+    {
+        waitWhileStalled();
+        fflush(stdout);
+    }
+
+private:
+    void waitWhileStalled()
+    {
+        while (stalled)
+        {
+            std::this_thread::sleep_for(milliseconds(10));
+        }
+    }
+};
+
+// the fallback sink marks the records that it receives
+class FallbackSink : public RF24LogSink
+{
+public:
+    void write(const char *data, size_t length, uint8_t)
+    {
+        fwrite("[fallback] ", 1, 11, stdout);
+        fwrite(data, 1, length, stdout);
+    }
+};
+
+// Define global vendor id
+const char vendorID[] = "RF24LogExample";
+
+void printStatus(const char *title, RF24LogWatchdogSink &watchdog)
+{
+    printf("%s: %s, %d records, %d written, %d redirected, %d lost, %d failovers, %d recoveries, "
+           "longest write %d ms\n",
+           title, watchdog.isHealthy() ? "healthy" : "unhealthy", static_cast<int>(watchdog.records()),
+           static_cast<int>(watchdog.written()), static_cast<int>(watchdog.redirected()),
+           static_cast<int>(watchdog.lost()), static_cast<int>(watchdog.failovers()),
+           static_cast<int>(watchdog.recoveries()), static_cast<int>(watchdog.maxLatency() / 1000));
+}
+
+// log a message every 20 ms while the sink is stalled; returns the longest log call (in microseconds)
+long logWhileStalled(StallingSink &sink, int count)
+{
+    sink.stalled = true;
+    long longest = 0;
+    for (int i = 0; i < count; ++i)
+    {
+        auto start = steady_clock::now();
+        RF24Log_info(vendorID, "message %d (logged while the sink is stalled)", i);
+        longest = std::max(longest, static_cast<long>(duration_cast<microseconds>(steady_clock::now() - start).count()));
+        std::this_thread::sleep_for(milliseconds(20));
+    }
+    sink.stalled = false;
+    return longest;
+}
+
+int main()
+{
+    StallingSink stdoutSink;
+    FallbackSink fallbackSink;
+
+    {
+        // the sink may take 50 ms per write, and is probed every 100 ms once it is unhealthy
+        RF24LogWatchdogSink watchdog(&stdoutSink, &fallbackSink, 50, 65536, 100);
+        SinkLogger logHandler(&watchdog);
+        logHandler.setLogLevel(RF24LogLevel::ALL);
+        rf24Logging.setHandler(&logHandler);
+
+        RF24Log_info(vendorID, "the sink is healthy");
+        watchdog.flush();
+        long longest = logWhileStalled(stdoutSink, 10);
+        printStatus("with a fallback sink", watchdog);
+        printf("the longest log call took %ld us while the sink was stalled\n", longest);
+
+        std::this_thread::sleep_for(milliseconds(250)); // long enough for a probe
+        RF24Log_info(vendorID, "the sink is re-attached");
+        watchdog.flush();
+        printStatus("with a fallback sink", watchdog);
+        rf24Logging.setHandler(nullptr);
+    }
+
+    {
+        // without a fallback sink, the records wait in a (small) buffer for the sink to recover
+        RF24LogWatchdogSink watchdog(&stdoutSink, nullptr, 50, 512, 100);
+        SinkLogger logHandler(&watchdog);
+        logHandler.setLogLevel(RF24LogLevel::ALL);
+        rf24Logging.setHandler(&logHandler);
+
+        long longest = logWhileStalled(stdoutSink, 10);
+        printStatus("without a fallback sink", watchdog);
+        printf("the longest log call took %ld us while the sink was stalled\n", longest);
+
+        std::this_thread::sleep_for(milliseconds(250));
+        RF24Log_info(vendorID, "the sink recovered");
+        watchdog.flush();
+        printStatus("without a fallback sink", watchdog);
+        rf24Logging.setHandler(nullptr);
+    }
+    return 0;
+}
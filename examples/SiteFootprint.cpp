@@ -0,0 +1,62 @@
+/**
+ * @author Brendan Doherty (2bndy5)
+ * @date Created 2026-10-19
+ * @copyright Copyright (C) <br> <br>
+ *    2026        Brendan Doherty (2bndy5) <br>
+ * This General Public License does not permit incorporating your program into
+ * proprietary programs.  If your program is a subroutine library, you may
+ * consider it more useful to permit linking proprietary applications with the
+ * library.  If this is what you want to do, use the GNU Lesser General
+ * Public License instead of this License.
+ */
+
+#include <cstdio> // printf()
+#include <RF24Log/RF24Logging.h>
+
+// Define global vendor id
+const char vendorID[] = "RF24LogExample";
+
+// the number of call sites measured per function
+#define SITES 16
+#define SITES_4(SITE) SITE SITE SITE SITE
+#define SITES_16(SITE) SITES_4(SITE) SITES_4(SITE) SITES_4(SITE) SITES_4(SITE)
+
+/**
+ * define a function made of @ref SITES call sites, between 2 labels (defined in assembly, so
+ * the compiler doesn't move them) that measure the call sites' code
+ */
+#define FOOTPRINT(name, site)                                                                   \
+    extern "C" const char name##_begin[], name##_end[];                                         \
+    __attribute__((noinline, noclone)) void name(int first, int second)                         \
+    {                                                                                           \
+        __asm__ __volatile__(".globl " #name "_begin\n" #name "_begin:" ::: "memory");          \
+        SITES_16(site)                                                                          \
+        __asm__ __volatile__(".globl " #name "_end\n" #name "_end:" ::: "memory");              \
+        (void)first;                                                                            \
+        (void)second;                                                                           \
+    }
+
+FOOTPRINT(infoSites, RF24Log_info(vendorID, "a message");)
+FOOTPRINT(infoArgsSites, RF24Log_info(vendorID, "a message with %d and %d", first, second);)
+FOOTPRINT(literalArgsSites, RF24Log_info("RF24LogExample", "a message with %d and %d", first, second);)
+FOOTPRINT(logArgsSites, RF24Log_log(RF24LogLevel::INFO, vendorID, "a message with %d and %d", first, second);)
+FOOTPRINT(directArgsSites, rf24Logging.log(RF24LogLevel::INFO, vendorID, "a message with %d and %d", first, second);)
+
+void printFootprint(const char *title, const char *begin, const char *end)
+{
+    printf("%-54s %5.1f bytes per call site\n", title, static_cast<double>(end - begin) / SITES);
+}
+
+int main()
+{
+    // (the messages go nowhere; no handler is set)
+    infoSites(1, 2);
+
+    printf("code of a call site (%s, %d call sites per function):\n", sizeof(void *) == 8 ? "64-bit" : "32-bit", SITES);
+    printFootprint("RF24Log_info() without arguments", infoSites_begin, infoSites_end);
+    printFootprint("RF24Log_info() with 2 arguments", infoArgsSites_begin, infoArgsSites_end);
+    printFootprint("RF24Log_info() with 2 arguments (a literal vendorId)", literalArgsSites_begin, literalArgsSites_end);
+    printFootprint("RF24Log_log() with 2 arguments (the level can change)", logArgsSites_begin, logArgsSites_end);
+    printFootprint("rf24Logging.log() with 2 arguments (no call site)", directArgsSites_begin, directArgsSites_end);
+    return 0;
+}
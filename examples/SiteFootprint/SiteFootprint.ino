@@ -0,0 +1,80 @@
+/**
+ * Created on: 19 Oct 2026
+ *     Author: Brendan Doherty (2bndy5)
+ *
+ * Copyright (C)
+ *    2026        Brendan Doherty (2bndy5) <br>
+ * This General Public License does not permit incorporating your program into
+ * proprietary programs.  If your program is a subroutine library, you may
+ * consider it more useful to permit linking proprietary applications with the
+ * library.  If this is what you want to do, use the GNU Lesser General
+ * Public License instead of this License.
+ */
+
+#include <Arduino.h>
+#include <RF24Logging.h>
+
+// Define global vendor id (it is stored in FLASH memory)
+const char PROGMEM vendorID[] = "RF24LogExample";
+
+// the number of call sites measured per function
+#define SITES 16
+#define SITES_4(SITE) SITE SITE SITE SITE
+#define SITES_16(SITE) SITES_4(SITE) SITES_4(SITE) SITES_4(SITE) SITES_4(SITE)
+
+// define a function made of SITES call sites, between 2 labels (defined in assembly, so the
+// compiler doesn't move them) that measure the call sites' code
+#define FOOTPRINT(name, site) \
+  extern "C" const char name##_begin[], name##_end[]; \
+  __attribute__((noinline, noclone)) void name(int first, int second) \
+  { \
+    __asm__ __volatile__(".globl " #name "_begin\n" #name "_begin:" ::: "memory"); \
+    SITES_16(site) \
+    __asm__ __volatile__(".globl " #name "_end\n" #name "_end:" ::: "memory"); \
+    (void)first; \
+    (void)second; \
+  }
+
+#if defined (ARDUINO_ARCH_AVR)
+#define DIRECT_MESSAGE F("a message with %d and %d")
+#define DIRECT_VENDOR (const __FlashStringHelper *)(vendorID)
+#else
+#define DIRECT_MESSAGE "a message with %d and %d"
+#define DIRECT_VENDOR vendorID
+#endif
+
+FOOTPRINT(infoSites, RF24Log_info(vendorID, "a message");)
+FOOTPRINT(infoArgsSites, RF24Log_info(vendorID, "a message with %d and %d", first, second);)
+FOOTPRINT(logArgsSites, RF24Log_log(RF24LogLevel::INFO, vendorID, "a message with %d and %d", first, second);)
+FOOTPRINT(directArgsSites, rf24Logging.log(RF24LogLevel::INFO, DIRECT_VENDOR, DIRECT_MESSAGE, first, second);)
+
+void printFootprint(const __FlashStringHelper *title, const char *begin, const char *end)
+{
+  Serial.print(title);
+  Serial.print(F(": "));
+  Serial.print((float)(end - begin) / SITES, 1);
+  Serial.println(F(" bytes per call site"));
+}
+
+void setup()
+{
+  // configure serial port baudrate
+  Serial.begin(115200);
+  while (!Serial) {/* some boards need this */}
+
+  // (the messages go nowhere; no handler is set)
+  infoSites(1, 2);
+
+  Serial.print(F("code of a call site ("));
+  Serial.print(SITES);
+  Serial.println(F(" call sites per function):"));
+  printFootprint(F("RF24Log_info() without arguments"), infoSites_begin, infoSites_end);
+  printFootprint(F("RF24Log_info() with 2 arguments"), infoArgsSites_begin, infoArgsSites_end);
+  printFootprint(F("RF24Log_log() with 2 arguments"), logArgsSites_begin, logArgsSites_end);
+  printFootprint(F("rf24Logging.log() with 2 arguments"), directArgsSites_begin, directArgsSites_end);
+}
+
+void loop()
+{
+  // nothing to do
+}
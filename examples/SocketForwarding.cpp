@@ -0,0 +1,50 @@
+/**
+ * @author Brendan Doherty (2bndy5)
+ * @date Created 2026-10-19
+ * @copyright Copyright (C) <br> <br>
+ *    2026        Brendan Doherty (2bndy5) <br>
+ * This General Public License does not permit incorporating your program into
+ * proprietary programs.  If your program is a subroutine library, you may
+ * consider it more useful to permit linking proprietary applications with the
+ * library.  If this is what you want to do, use the GNU Lesser General
+ * Public License instead of this License.
+ *
+ * Start the collector first (or later, or restart it while this runs):
+ *     rf24log-recv -o received.log /tmp/rf24log.sock
+ */
+
+#include <cstdio>   // fprintf()
+#include <unistd.h> // usleep()
+#include <RF24Log/RF24Logging.h>
+#include <RF24Log/RF24Loggers/SinkLogger.h>
+#include <RF24Log/RF24LogSinks/SocketSink.h>
+
+// Send the records to a local collector as a length-prefixed stream; retry the connection every 500 ms
+RF24LogSocketSink collectorSink("/tmp/rf24log.sock", false, 65536, 100, 500);
+SinkLogger collectorLogHandler(&collectorSink);
+
+// Define global vendor id
+const char vendorID[] = "RF24LogExample";
+
+int main()
+{
+    collectorLogHandler.setLogLevel(RF24LogLevel::INFO);
+    rf24Logging.setHandler(&collectorLogHandler);
+
+    RF24Log_info(vendorID, "RF24Log/examples/SocketForwarding");
+
+    // logging never waits for the collector, even while it isn't running
+    for (int second = 0; second < 20; ++second)
+    {
+        for (int i = 0; i < 1000; ++i)
+        {
+            RF24Log_info(vendorID, "received payload #%d on pipe %d", second * 1000 + i, i % 6);
+        }
+        usleep(1000000);
+        fprintf(stderr, "%s: %llu records sent in %llu send() calls, %llu dropped, %llu connections\n",
+                collectorSink.isConnected() ? "connected" : "waiting for the collector",
+                (unsigned long long)collectorSink.sent(), (unsigned long long)collectorSink.sendCalls(),
+                (unsigned long long)collectorSink.dropped(), (unsigned long long)collectorSink.connections());
+    }
+    return 0;
+}
@@ -0,0 +1,103 @@
+/**
+ * @author Brendan Doherty (2bndy5)
+ * @date Created 2026-10-19
+ * @copyright Copyright (C) <br> <br>
+ *    2026        Brendan Doherty (2bndy5) <br>
+ * This General Public License does not permit incorporating your program into
+ * proprietary programs.  If your program is a subroutine library, you may
+ * consider it more useful to permit linking proprietary applications with the
+ * library.  If this is what you want to do, use the GNU Lesser General
+ * Public License instead of this License.
+ */
+
+#include <chrono>  // std::chrono::steady_clock
+#include <cstdarg> // va_list
+#include <cstdio>  // printf()
+#include <RF24Log/RF24Logging.h>
+#include <RF24Log/RF24Loggers/NativePrintLogger.h>
+#include <RF24Log/RF24LogParts/StackTrace.h>
+#include <RF24Log/handler_ext/RF24LogIsrHandler.h>
+
+// Create a stdout log handler, fed by a handler that captures the messages (and their stack traces)
+NativePrintLogger stdoutLogHandler;
+RF24LogRecordSlot slots[64];
+RF24LogIsrHandler captureLogHandler(&stdoutLogHandler, slots, 64);
+
+// Define global vendor id
+const char vendorID[] = "RF24LogExample";
+
+// a few nested calls, so the stack trace has something to show
+// (link with -rdynamic to see these names instead of only their offsets)
+__attribute__((noinline)) bool checkPayload(int pipe, int checksum)
+{
+    if (checksum != 0x5A)
+    {
+        RF24Log_error(vendorID, "payload on pipe %d failed its checksum (0x%x)", pipe, checksum);
+        return false;
+    }
+    return true;
+}
+
+__attribute__((noinline)) int readPayloads(int pipe)
+{
+    RF24Log_info(vendorID, "reading the payloads on pipe %d", pipe);
+    int valid = 0;
+    for (int checksum = 0x58; checksum < 0x5B; ++checksum)
+    {
+        valid += checkPayload(pipe, checksum);
+    }
+    return valid;
+}
+
+#if defined (RF24LOG_STACK_TRACES)
+// capture an error the way a handler does
+__attribute__((noinline)) void captureError(RF24LogRecord *record, const char *message, ...)
+{
+    va_list args;
+    va_start(args, message);
+    record->capture(RF24LogLevel::ERROR, vendorID, message, &args);
+    va_end(args);
+}
+
+// the time to capture an error (in nanoseconds), with or without a stack trace
+double captureTime(uint8_t stackLevel)
+{
+    RF24LogStackTrace::setLevel(stackLevel, 8);
+    RF24LogRecord record;
+    const int count = 100000;
+    auto start = std::chrono::steady_clock::now();
+    for (int i = 0; i < count; ++i)
+    {
+        captureError(&record, "error #%d", i);
+    }
+    return std::chrono::duration<double, std::nano>(std::chrono::steady_clock::now() - start).count() / count;
+}
+
+#endif
+
+int main()
+{
+#if defined (RF24LOG_STACK_TRACES)
+    stdoutLogHandler.setLogLevel(RF24LogLevel::ALL);
+    captureLogHandler.setLogLevel(RF24LogLevel::ALL);
+    rf24Logging.setHandler(&captureLogHandler);
+
+    // errors (and their sublevels) are captured with up to 8 return addresses
+    RF24LogStackTrace::setLevel(RF24LogLevel::ERROR + 7, 8);
+    int valid = readPayloads(3);
+    RF24Log_info(vendorID, "%d of the payloads were valid", valid);
+
+    // the addresses are only symbolized when the messages are output
+    captureLogHandler.poll();
+
+    // a logger that outputs the messages at once symbolizes their stack traces at once
+    rf24Logging.setHandler(&stdoutLogHandler);
+    checkPayload(4, 0);
+
+    printf("capturing an error costs %.0f ns without a stack trace, %.0f ns with a stack trace\n",
+           captureTime(0), captureTime(RF24LogLevel::ERROR + 7));
+#else
+    printf("Build the RF24Log lib and this example with RF24LOG_STACK_TRACES defined to capture stack traces.\n");
+#endif
+    return 0;
+}
@@ -0,0 +1,130 @@
+/**
+ * @author Brendan Doherty (2bndy5)
+ * @date Created 2026-10-19
+ * @copyright Copyright (C) <br> <br>
+ *    2026        Brendan Doherty (2bndy5) <br>
+ * This General Public License does not permit incorporating your program into
+ * proprietary programs.  If your program is a subroutine library, you may
+ * consider it more useful to permit linking proprietary applications with the
+ * library.  If this is what you want to do, use the GNU Lesser General
+ * Public License instead of this License.
+ */
+
+#include <chrono>   // std::chrono::steady_clock
+#include <cstdio>   // fprintf()
+#include <cstring>  // memset()
+#include <thread>   // std::thread
+#include <vector>   // std::vector
+#include <fcntl.h>  // open()
+#include <unistd.h> // close(), pread()
+#include <RF24Log/RF24Logging.h>
+#include <RF24Log/RF24Loggers/SinkLogger.h>
+#include <RF24Log/RF24LogSinks/UringSink.h>
+
+// Define global vendor id
+const char vendorID[] = "RF24LogExample";
+const int messages = 200000;
+
+// log the messages to a file through a RF24LogUringSink
+void measure(const char *path, bool useUring)
+{
+    int fd = open(path, O_WRONLY | O_CREAT | O_TRUNC, 0644);
+    if (fd < 0)
+    {
+        fprintf(stderr, "could not open %s\n", path);
+        return;
+    }
+    RF24LogUringSink sink(fd, 65536, 8, 100, useUring);
+    SinkLogger fileLogHandler(&sink);
+    fileLogHandler.setLogLevel(RF24LogLevel::INFO);
+    rf24Logging.setHandler(&fileLogHandler);
+
+    auto start = std::chrono::steady_clock::now();
+    for (int i = 0; i < messages; ++i)
+    {
+        RF24Log_info(vendorID, "received payload #%d on pipe %d", i, i % 6);
+    }
+    auto end = std::chrono::steady_clock::now();
+    rf24Logging.setHandler(nullptr);
+    sink.flush();
+
+    fprintf(stderr, "%s: %6.1f ns per message, %llu buffers written (up to %d at once), "
+            "completion latency %u us on average (%u us at most), %llu errors\n",
+            sink.isAsync() ? "io_uring" : "pwrite()",
+            std::chrono::duration<double, std::nano>(end - start).count() / messages,
+            (unsigned long long)sink.completions(), sink.maxQueueDepth(),
+            sink.averageLatency(), sink.maxLatency(), (unsigned long long)sink.errors());
+    close(fd);
+}
+
+// write records of 1000 to 4000 bytes from 4 threads at once (each record holds its length, then
+// repeats 1 byte), then read the file back to check that no record was cut or overwritten
+void stress(const char *path, bool useUring)
+{
+    int fd = open(path, O_RDWR | O_CREAT | O_TRUNC, 0644);
+    if (fd < 0)
+    {
+        fprintf(stderr, "could not open %s\n", path);
+        return;
+    }
+    const int threads = 4, records = 2000;
+    {
+        // small buffers, so the records often don't fit in the buffer being filled
+        RF24LogUringSink sink(fd, 4096, 2, 0, useUring);
+        std::vector<std::thread> writers;
+        for (int t = 0; t < threads; ++t)
+        {
+            writers.emplace_back([&sink, t]() {
+                char record[4000];
+                for (int i = 0; i < records; ++i)
+                {
+                    uint16_t length = (uint16_t)(1000 + (i * 7919 + t * 104729) % 3001);
+                    memcpy(record, &length, sizeof(length));
+                    memset(record + sizeof(length), 'a' + t, length - sizeof(length));
+                    sink.write(record, length, RF24LogLevel::INFO);
+                }
+            });
+        }
+        for (std::thread &writer : writers)
+        {
+            writer.join();
+        }
+    } // the destructor writes the rest
+
+    int found = 0;
+    off_t offset = 0;
+    char record[4000];
+    uint16_t length;
+    while (pread(fd, &length, sizeof(length), offset) == (ssize_t)sizeof(length))
+    {
+        if (length < 1000 || length > 4000 || pread(fd, record, length, offset) != (ssize_t)length)
+        {
+            break;
+        }
+        bool intact = true;
+        for (uint16_t i = sizeof(length); i < length; ++i)
+        {
+            intact = intact && record[i] == record[sizeof(length)];
+        }
+        if (!intact)
+        {
+            break;
+        }
+        ++found;
+        offset += length;
+    }
+    fprintf(stderr, "%s from %d threads: %d of %d records intact\n",
+            useUring ? "io_uring" : "pwrite()", threads, found, threads * records);
+    close(fd);
+}
+
+int main(int argc, char **argv)
+{
+    const char *path = argc > 1 ? argv[1] : "/tmp/rf24log-uring.log";
+    fprintf(stderr, "logging %d messages to %s\n", messages, path);
+    measure(path, true);  // falls back to pwrite() if io_uring is unavailable
+    measure(path, false); // always pwrite()
+    stress(path, true);
+    stress(path, false);
+    return 0;
+}
@@ -0,0 +1,113 @@
+/**
+ * @author Brendan Doherty (2bndy5)
+ * @date Created 2026-10-19
+ * @copyright Copyright (C) <br> <br>
+ *    2026        Brendan Doherty (2bndy5) <br>
+ * This General Public License does not permit incorporating your program into
+ * proprietary programs.  If your program is a subroutine library, you may
+ * consider it more useful to permit linking proprietary applications with the
+ * library.  If this is what you want to do, use the GNU Lesser General
+ * Public License instead of this License.
+ */
+
+#include <algorithm> // std::sort()
+#include <chrono>    // std::chrono::steady_clock
+#include <cstdio>    // fprintf()
+#include <cstdlib>   // atoi()
+#include <ctime>     // clock_gettime()
+#include <thread>    // std::this_thread::sleep_for()
+#include <vector>
+#include <RF24Log/RF24Logging.h>
+#include <RF24Log/RF24LogParts/ArgList.h>
+#include <RF24Log/RF24LogParts/Record.h>
+#include <RF24Log/handler_ext/RF24LogIsrHandler.h>
+
+// Define global vendor id
+const char vendorID[] = "RF24LogExample";
+
+const int messages = 5000;
+std::chrono::steady_clock::time_point loggedAt[messages];
+double latencies[messages]; // microseconds
+
+// the consumer's output: measures how long each message took to arrive
+class LatencyHandler : public RF24LogBaseHandler
+{
+public:
+    int received = 0;
+
+    void log(uint8_t, const char *, const char *, va_list *) {}
+    void setLogLevel(uint8_t) {}
+
+    void logRecord(const RF24LogRecord *record)
+    {
+        auto now = std::chrono::steady_clock::now();
+        RF24LogArgList args(record->args, record->argsSize);
+        int number = args.nextInt();
+        if (number >= 0 && number < messages)
+        {
+            latencies[number] = std::chrono::duration<double, std::micro>(now - loggedAt[number]).count();
+            ++received;
+        }
+    }
+};
+
+double cpuSeconds()
+{
+    struct timespec now;
+    clock_gettime(CLOCK_PROCESS_CPUTIME_ID, &now);
+    return (double)now.tv_sec + (double)now.tv_nsec / 1e9;
+}
+
+void measure(const char *name, RF24LogWaiter *waiter, int cpu)
+{
+    LatencyHandler output;
+    static RF24LogRecordSlot slots[1024];
+    RF24LogIsrHandler handler(&output, slots, 1024);
+    handler.setLogLevel(RF24LogLevel::ALL);
+    rf24Logging.setHandler(&handler);
+    handler.start(waiter, cpu);
+
+    double cpuStart = cpuSeconds();
+    auto start = std::chrono::steady_clock::now();
+    for (int i = 0; i < messages; ++i)
+    {
+        // a message every 200 microseconds, so the consumer is idle in between
+        loggedAt[i] = std::chrono::steady_clock::now();
+        RF24Log_info(vendorID, "message #%d", i);
+        std::this_thread::sleep_until(start + std::chrono::microseconds(200 * (i + 1)));
+    }
+    handler.stop();
+    double cpuUsed = cpuSeconds() - cpuStart;
+    double seconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+    rf24Logging.setHandler(nullptr);
+
+    std::vector<double> sorted(latencies, latencies + output.received);
+    std::sort(sorted.begin(), sorted.end());
+    size_t count = sorted.size();
+    if (!count)
+    {
+        return;
+    }
+    fprintf(stderr, "%-28s p50 %8.1f us, p99 %8.1f us, p99.9 %8.1f us, max %8.1f us; CPU used %5.1f%%\n", name,
+            sorted[count / 2], sorted[count * 99 / 100], sorted[count * 999 / 1000], sorted[count - 1],
+            100 * cpuUsed / seconds);
+}
+
+int main(int argc, char **argv)
+{
+    // an optional argument pins the consumer thread to a CPU core
+    int cpu = argc > 1 ? atoi(argv[1]) : -1;
+    fprintf(stderr, "%d messages, 1 every 200 us; consumer pinned to CPU %d\n", messages, cpu);
+
+    RF24LogWaiter spin(RF24LOG_WAIT_SPIN);
+    RF24LogWaiter spinYield(RF24LOG_WAIT_SPIN_YIELD);
+    RF24LogWaiter sleep(RF24LOG_WAIT_SLEEP);
+    RF24LogWaiter batched(RF24LOG_WAIT_SLEEP, 10000, 16);
+    RF24LogWaiter poll(RF24LOG_WAIT_POLL, 1000);
+    measure("busy-spin:", &spin, cpu);
+    measure("spin then yield:", &spinYield, cpu);
+    measure("sleep (futex):", &sleep, cpu);
+    measure("sleep, batches of 16:", &batched, cpu);
+    measure("poll every 1 ms:", &poll, cpu);
+    return 0;
+}
@@ -0,0 +1,55 @@
+/**
+ * @author Brendan Doherty (2bndy5)
+ * @date Created 2026-10-19
+ * @copyright Copyright (C) <br> <br>
+ *    2026        Brendan Doherty (2bndy5) <br>
+ * This General Public License does not permit incorporating your program into
+ * proprietary programs.  If your program is a subroutine library, you may
+ * consider it more useful to permit linking proprietary applications with the
+ * library.  If this is what you want to do, use the GNU Lesser General
+ * Public License instead of this License.
+ */
+
+#include <cstdio>   // fprintf()
+#include <unistd.h> // STDOUT_FILENO, usleep()
+#include <RF24Log/RF24Logging.h>
+#include <RF24Log/RF24Loggers/SinkLogger.h>
+#include <RF24Log/RF24LogSinks/WritevSink.h>
+
+// Batch the records written to stdout: 16 KB or 128 records per writev(), or 50 ms at most
+RF24LogWritevSink stdoutSink(STDOUT_FILENO, 16384, 128, 50);
+SinkLogger stdoutLogHandler(&stdoutSink);
+
+// Define global vendor id
+const char vendorID[] = "RF24LogExample";
+
+void report(const char *stage)
+{
+    fprintf(stderr, "%-32s %6llu records in %5llu writev() calls\n", stage,
+            (unsigned long long)stdoutSink.records(), (unsigned long long)stdoutSink.writeCalls());
+}
+
+int main()
+{
+    stdoutLogHandler.setLogLevel(RF24LogLevel::INFO);
+    rf24Logging.setHandler(&stdoutLogHandler);
+
+    RF24Log_info(vendorID, "RF24Log/examples/WritevBatching");
+
+    // a burst of radio traffic is batched
+    for (int i = 0; i < 10000; ++i)
+    {
+        RF24Log_info(vendorID, "received payload #%d on pipe %d", i, i % 6);
+    }
+    report("after a burst of 10000 messages:");
+
+    // an error is written immediately (with the records batched before it)
+    RF24Log_error(vendorID, "the radio stopped responding");
+    report("after an error:");
+
+    // a lone message waits at most 50 ms
+    RF24Log_info(vendorID, "the radio was reset");
+    usleep(100000);
+    report("after 100 ms:");
+    return 0;
+}
@@ -23,6 +23,10 @@
 #endif
 #include <stdint.h>
 #include <stdarg.h>
+#include "RF24LogParts/Common.h" // RF24LOG_HOSTED
+#if defined (RF24LOG_HOSTED)
+#include <atomic>
+#endif
 
 /** @brief Change The Delimiter character used in the header prefix of log messages. */
 #if !defined(RF24LOG_DELIMITER)
@@ -50,6 +54,8 @@
 #define RF24LOG_TAB_SIZE 8
 #endif
 
+struct RF24LogRecord; // declared in RF24LogParts/Record.h
+
 /** @brief A base mechanism for handling log messages. */
 class RF24LogBaseHandler
 {
@@ -74,6 +80,30 @@ public:
                      va_list *args) = 0;
 #endif
 
+    /**
+     * @brief log a message that was captured earlier (see RF24LogRecord::capture()).
+     *
+     * The handlers of this library output (or forward) the captured messages, so they can be
+     * used behind one that defers the output (like RF24LogIsrHandler). A handler that doesn't
+     * override this drops the captured messages, and counts them in droppedRecords().
+     * @param record The captured message
+     */
+    virtual void logRecord(const RF24LogRecord *record)
+    {
+        (void)record;
+#if defined (RF24LOG_HOSTED)
+        droppedRecordCount().fetch_add(1, std::memory_order_relaxed);
+#else
+        ++droppedRecordCount();
+#endif
+    }
+
+    /**
+     * @brief the number of captured messages dropped by the handlers that don't override
+     * logRecord() (see [How to create your own handler](md_docs_roll_your_logger.html))
+     */
+    static uint32_t droppedRecords() { return droppedRecordCount(); }
+
     /**
      * set the maximal level of the logged messages.
      * @param logLevel The verbosity level used to filter which of the logged messages
@@ -81,6 +111,23 @@ public:
      * @see Review the descriptions in the @ref logLevels
      */
     virtual void setLogLevel(uint8_t logLevel) = 0;
+
+private:
+
+    /** @brief the counter of droppedRecords() (shared by all the handlers) */
+#if defined (RF24LOG_HOSTED)
+    static std::atomic<uint32_t> &droppedRecordCount()
+    {
+        static std::atomic<uint32_t> count(0);
+        return count;
+    }
+#else
+    static uint32_t &droppedRecordCount()
+    {
+        static uint32_t count = 0;
+        return count;
+    }
+#endif
 };
 
 #endif /* SRC_RF24LOGBASEHANDLER_H_ */
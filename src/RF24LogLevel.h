@@ -51,6 +51,16 @@ enum RF24LogLevel : uint8_t
     ALL   = 0xFF
 };
 
+/**
+ * @brief is a message urgent enough to be output at once (rather than batched)?
+ * @param logLevel The level of the logging message
+ * @return `true` for @ref ERROR (and its sublevels) or more severe
+ */
+inline bool rf24LogIsUrgent(uint8_t logLevel)
+{
+    return logLevel && logLevel < RF24LogLevel::WARN;
+}
+
 /**@} */
 
 #endif /* SRC_RF24LOGLEVEL_H_ */
@@ -13,6 +13,8 @@
  */
 
 #include "AbstractHandler.h"
+#include "CallSite.h" // RF24LogSites::isForced()
+#include "Profiler.h" // RF24LogProfiler (when RF24LOG_PROFILE is defined)
 
 /****************************************************************************/
 
@@ -30,6 +32,9 @@ void RF24LogAbstractHandler::log(uint8_t logLevel,
 {
     if (isLevelEnabled(logLevel))
     {
+#if defined (RF24LOG_PROFILE)
+        RF24LogProfiler::accept();
+#endif
         write(logLevel, vendorId, message, args);
     }
 }
@@ -53,12 +58,20 @@ void RF24LogAbstractHandler::log(uint8_t logLevel,
 
 void RF24LogAbstractHandler::setLogLevel(uint8_t logLevel)
 {
+#if defined (RF24LOG_HOSTED)
+    _logLevel.store(logLevel, std::memory_order_relaxed);
+#else
     _logLevel = logLevel;
+#endif
 }
 
 /****************************************************************************/
 
 bool RF24LogAbstractHandler::isLevelEnabled(uint8_t logLevel)
 {
+#if defined (RF24LOG_HOSTED)
+    return logLevel <= _logLevel.load(std::memory_order_relaxed) || RF24LogSites::isForced();
+#else
     return logLevel <= _logLevel;
+#endif
 }
@@ -27,20 +27,15 @@
 
 #include "../RF24LogBaseHandler.h"
 #include "../RF24LogLevel.h"
+#include "Common.h" // RF24LOG_HOSTED
+#if defined (RF24LOG_HOSTED)
+#include <atomic>
+#endif
 
 
 /** @brief An abstract base class for handling log messages. */
 class RF24LogAbstractHandler : public RF24LogBaseHandler
 {
-private:
-
-    /**
-     * @brief is logging enabled for a certain level?
-     * @param logLevel The Log level to test if enabled.
-     * @return true if the log messages are enabled for the specified @p logLevel ; false otherwise.
-     */
-    bool isLevelEnabled(uint8_t logLevel);
-
 public:
 
     /** @brief Sets log level to @ref INFO upon instantiation. */
@@ -62,8 +57,24 @@ public:
 
 protected:
 
-    /** The configured log level used to filter which messages are output. */
+    /**
+     * The configured log level used to filter which messages are output.
+     *
+     * On hosted platforms, this is atomic so that the level can be changed while
+     * other threads are logging (a relaxed load is as cheap as a plain load).
+     */
+#if defined (RF24LOG_HOSTED)
+    std::atomic<uint8_t> _logLevel;
+#else
     uint8_t _logLevel;
+#endif
+
+    /**
+     * @brief is logging enabled for a certain level?
+     * @param logLevel The Log level to test if enabled.
+     * @return true if the log messages are enabled for the specified @p logLevel ; false otherwise.
+     */
+    bool isLevelEnabled(uint8_t logLevel);
 
     /**
      * write log message to its destination
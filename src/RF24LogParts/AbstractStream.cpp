@@ -31,6 +31,14 @@ void RF24LogAbstractStream::descTimeLevel(uint8_t logLevel)
 /****************************************************************************/
 
 void RF24LogAbstractStream::appendLogLevel(uint8_t logLevel)
+{
+    appendLevelName(logLevel);
+    appendChar(RF24LOG_DELIMITER);
+}
+
+/****************************************************************************/
+
+void RF24LogAbstractStream::appendLevelName(uint8_t logLevel)
 {
     uint8_t subLevel = logLevel & 0x07;
     if (logLevel >= RF24LogLevel::ERROR && logLevel <= RF24LogLevel::DEBUG + 7)
@@ -59,31 +67,123 @@ void RF24LogAbstractStream::appendLogLevel(uint8_t logLevel)
         appendChar(' ', logLevel < 010 ? 2 : (logLevel < 0100));
         appendUInt(logLevel, 8);
     }
-    appendChar(RF24LOG_DELIMITER);
 }
 
 /****************************************************************************/
 
-void RF24LogAbstractStream::appendFormat(FormatSpecifier* fmt_parser, va_list *args)
+void RF24LogAbstractStream::appendHeader(const RF24LogHeaderPattern *pattern,
+                                         uint8_t logLevel,
+                                         uint32_t sequence,
+                                         const char *vendorId)
+{
+    for (uint8_t i = 0; i < pattern->count; ++i)
+    {
+        const RF24LogHeaderPattern::Field *field = &pattern->fields[i];
+        if (field->code == RF24LogHeaderPattern::VENDOR) { appendStr(vendorId); }
+        else { appendHeaderField(pattern, field, logLevel, sequence); }
+    }
+}
+
+/****************************************************************************/
+
+#if defined (ARDUINO_ARCH_AVR)
+void RF24LogAbstractStream::appendHeader(const RF24LogHeaderPattern *pattern,
+                                         uint8_t logLevel,
+                                         uint32_t sequence,
+                                         const __FlashStringHelper *vendorId)
+{
+    for (uint8_t i = 0; i < pattern->count; ++i)
+    {
+        const RF24LogHeaderPattern::Field *field = &pattern->fields[i];
+        if (field->code == RF24LogHeaderPattern::VENDOR) { appendStr(vendorId); }
+        else { appendHeaderField(pattern, field, logLevel, sequence); }
+    }
+}
+#endif
+
+/****************************************************************************/
+
+void RF24LogAbstractStream::appendHeaderField(const RF24LogHeaderPattern *pattern,
+                                              const RF24LogHeaderPattern::Field *field,
+                                              uint8_t logLevel,
+                                              uint32_t sequence)
+{
+    unsigned long number;
+    switch (field->code)
+    {
+        case RF24LogHeaderPattern::TEXT:
+            appendStr(pattern->text + field->offset);
+            return;
+        case RF24LogHeaderPattern::TIME:
+#if defined (RF24LOG_HOSTED)
+            appendStr(RF24LogHeaderPattern::dateTime(headerTime()));
+#else
+            appendUInt(headerTime());
+#endif
+            return;
+        case RF24LogHeaderPattern::MILLIS:
+        case RF24LogHeaderPattern::MICROS:
+        {
+#if defined (RF24LOG_HOSTED)
+            unsigned long micros = (unsigned long)(headerTime() % 1000000);
+#else
+            unsigned long micros = (unsigned long)(headerTime() % 1000) * 1000;
+#endif
+            bool millis = field->code == RF24LogHeaderPattern::MILLIS;
+            number = millis ? micros / 1000 : micros;
+            uint16_t digits = numbCharsToPrint(number);
+            appendChar('0', (millis ? 3 : 6) - digits);
+            appendUInt(number);
+            return;
+        }
+        case RF24LogHeaderPattern::LEVEL:
+            appendLevelName(logLevel);
+            return;
+        case RF24LogHeaderPattern::LEVEL_NUMBER:
+            appendChar('0', 3 - numbCharsToPrint(logLevel, 8));
+            appendUInt(logLevel, 8);
+            return;
+#if defined (RF24LOG_HOSTED)
+        case RF24LogHeaderPattern::THREAD_NAME:
+        {
+            const RF24LogThread *thread = headerThread();
+            if (*thread->name)
+            {
+                appendStr(thread->name);
+                return;
+            }
+            number = thread->id;
+            break;
+        }
+        case RF24LogHeaderPattern::THREAD_ID:  number = headerThread()->id; break;
+        case RF24LogHeaderPattern::PROCESS_ID: number = RF24LogHeaderPattern::processId(); break;
+#endif
+        case RF24LogHeaderPattern::SEQUENCE:   number = sequence; break;
+        default: number = 0; break;
+    }
+    uint16_t digits = numbCharsToPrint(number);
+    if (field->width > digits)
+    {
+        appendChar(' ', field->width - digits);
+    }
+    appendUInt(number);
+}
+
+/****************************************************************************/
+
+void RF24LogAbstractStream::appendFormat(FormatSpecifier* fmt_parser, RF24LogArgList *args)
 {
     if (fmt_parser->specifier == 's')
     {
         // print text from RAM
-        #ifdef Arduino
-        // warning: ISO C++17 does not allow 'register' storage class specifier [-Wregister]
-        register char *str_p = (char *)va_arg(*args, int);
-        #else
-        const char *str_p = va_arg(*args, char *);
-        #endif
-        appendStr(str_p);
+        appendStr(args->nextStr());
     }
 
 #ifdef ARDUINO_ARCH_AVR
     else if (fmt_parser->specifier == 'S')
     {
         // print text from FLASH
-        register __FlashStringHelper *s = (__FlashStringHelper *)va_arg(*args, int);
-        appendStr(s);
+        appendStr(args->nextFlashStr());
     }
 #endif
 
@@ -94,18 +194,23 @@ void RF24LogAbstractStream::appendFormat(FormatSpecifier* fmt_parser, va_list *a
         {
             appendChar(fmt_parser->fill, fmt_parser->width - 1);
         }
-        appendChar((char)va_arg(*args, int));
+        appendChar((char)args->nextInt());
     }
 
     else if (fmt_parser->specifier == 'D' || fmt_parser->specifier == 'F' || fmt_parser->specifier == 'f')
     {
         // print as double
-        double temp = va_arg(*args, double);
+        double temp = args->nextDouble();
 
         // printf() traditionally reserves a precision of 0 to avoid printing a value of 0
         // so, if precision is 0 and value is 0.0, then don't print and just consume arg
         if (fmt_parser->precis == 0 && temp == 0.0) { return; }
 
+#if defined (RF24LOG_FIXED_POINT)
+        RF24LogFixed number;
+        number.split(temp, (uint8_t)(fmt_parser->precis >= 0 ? fmt_parser->precis : 2));
+        appendFixed(&number, fmt_parser);
+#else
         if (fmt_parser->precis >= 0)
         {
             appendDouble(temp, fmt_parser->precis);
@@ -114,6 +219,23 @@ void RF24LogAbstractStream::appendFormat(FormatSpecifier* fmt_parser, va_list *a
         {
             appendDouble(temp);
         }
+#endif
+    }
+
+    else if (fmt_parser->specifier == 'H')
+    {
+        // print a buffer of bytes (a pointer followed by the number of bytes)
+        const uint8_t *data;
+        uint16_t size = args->nextBytes(&data);
+        appendBytes(data, size, fmt_parser);
+    }
+
+    else if (fmt_parser->specifier == 'k')
+    {
+        // print an integer that holds a number scaled by 10^precision (like 1234 for "12.34")
+        RF24LogFixed number;
+        number.split((long)args->nextInt(), (uint8_t)(fmt_parser->precis >= 0 ? fmt_parser->precis : 2));
+        appendFixed(&number, fmt_parser);
     }
 
     else
@@ -126,7 +248,7 @@ void RF24LogAbstractStream::appendFormat(FormatSpecifier* fmt_parser, va_list *a
         else if (fmt_parser->specifier == 'b') { base = 2; }
         if (base != 3) // if it was a supported char
         {
-            int temp = va_arg(*args, int);
+            int temp = args->nextInt();
             if (fmt_parser->width)
             {
                 uint16_t w = numbCharsToPrint(temp, base);
@@ -153,3 +275,97 @@ void RF24LogAbstractStream::appendFormat(FormatSpecifier* fmt_parser, va_list *a
         }
     }
 }
+
+/****************************************************************************/
+
+void RF24LogAbstractStream::appendFixed(const RF24LogFixed *number, FormatSpecifier *fmt_parser)
+{
+    static const char names[][4] = {"", "nan", "inf", "ovf"};
+    uint16_t length = number->negative ? 1 : 0;
+    if (number->special)
+    {
+        length += 3;
+    }
+    else
+    {
+        length += numbCharsToPrint(number->integer);
+        length += number->precision ? number->precision + 1 : 0;
+    }
+    if (fmt_parser->width > length)
+    {
+        appendChar(fmt_parser->fill, fmt_parser->width - length);
+    }
+
+    if (number->negative)
+    {
+        appendChar('-');
+    }
+    if (number->special)
+    {
+        appendStr(names[number->special]);
+        return;
+    }
+    appendUInt(number->integer);
+    if (number->precision)
+    {
+        appendChar('.');
+        uint16_t digits = numbCharsToPrint(number->fraction);
+        if (number->precision > digits)
+        {
+            appendChar('0', number->precision - digits);
+        }
+        appendUInt(number->fraction);
+    }
+}
+
+/****************************************************************************/
+
+void RF24LogAbstractStream::appendBytes(const uint8_t *data, uint16_t size, FormatSpecifier *fmt_parser)
+{
+    static const char hexDigits[] = "0123456789ABCDEF";
+
+    // the text is encoded on the stack, so a whole payload takes 1 output to the stream (not 1 per byte)
+    char chunk[RF24LOG_HEXDUMP_CHUNK + 1];
+    uint16_t used = 0;
+    auto reserve = [&](uint16_t count) {
+        if (used + count > RF24LOG_HEXDUMP_CHUNK)
+        {
+            chunk[used] = 0;
+            appendStr(chunk);
+            used = 0;
+        }
+    };
+
+    uint16_t group = fmt_parser->width;
+    uint16_t left = group; // the number of bytes until the next group separator
+    for (uint16_t i = 0; i < size; ++i)
+    {
+        reserve(3);
+        if (group && !left)
+        {
+            chunk[used++] = ' ';
+            left = group;
+        }
+        chunk[used++] = hexDigits[data[i] >> 4];
+        chunk[used++] = hexDigits[data[i] & 0xF];
+        --left;
+    }
+
+    if (fmt_parser->alternate)
+    {
+        // the printable characters (any other byte is shown as '.'), like `hexdump -C` shows them
+        reserve(3);
+        chunk[used++] = ' ';
+        chunk[used++] = ' ';
+        chunk[used++] = '|';
+        for (uint16_t i = 0; i < size; ++i)
+        {
+            reserve(1);
+            chunk[used++] = data[i] >= ' ' && data[i] < 0x7F ? (char)data[i] : '.';
+        }
+        reserve(1);
+        chunk[used++] = '|';
+    }
+    chunk[used] = 0;
+    appendStr(chunk);
+}
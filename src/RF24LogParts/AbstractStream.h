@@ -24,7 +24,18 @@
 
 #include <stdint.h>
 #include "FormatSpecifier.h" // FormatSpecifier struct
+#include "ArgList.h" // RF24LogArgList class
 #include "Common.h" // numbCharsToPrint()
+#include "HeaderPattern.h" // RF24LogHeaderPattern class
+#include "FixedPoint.h" // RF24LogFixed struct
+
+/**
+ * @brief The number of characters that a hex dump (the `H` specifier) encodes on the stack
+ * before each output to the stream.
+ */
+#ifndef RF24LOG_HEXDUMP_CHUNK
+#define RF24LOG_HEXDUMP_CHUNK 100
+#endif
 
 /** @brief A `protected` collection of methods that output formatted data to a stream. */
 class RF24LogAbstractStream
@@ -36,23 +47,84 @@ protected:
     virtual void appendTimestamp() = 0;
 
     /**
-     * @brief output a description of the log level
+     * @brief the time shown by the time fields of a RF24LogHeaderPattern
+     * @return The current time (see rf24LogNow()), unless the stream formats messages
+     * that were logged earlier.
+     */
+    virtual RF24LogTime headerTime() { return rf24LogNow(); }
+
+#if defined (RF24LOG_HOSTED)
+    /**
+     * @brief the thread shown by the thread fields of a RF24LogHeaderPattern
+     * @return The calling thread, unless the stream formats messages that were logged earlier.
+     */
+    virtual const RF24LogThread *headerThread() { return RF24LogHeaderPattern::thisThread(); }
+#endif
+
+    /**
+     * @brief output a description of the log level (followed by the delimiter)
      * @param logLevel The level to describe.
      */
     void appendLogLevel(uint8_t logLevel);
 
+    /**
+     * @brief output a description of the log level (without the delimiter)
+     * @param logLevel The level to describe.
+     */
+    void appendLevelName(uint8_t logLevel);
+
     /**
      * @brief Automate the output of the header' timestamp and level description
      * @param logLevel The Log level to describe.
      */
     void descTimeLevel(uint8_t logLevel);
 
+    /**
+     * @brief output a header according to a compiled pattern
+     * @param pattern The compiled header layout
+     * @param logLevel The level of the logging message
+     * @param sequence The message's sequence number (see RF24LogHeaderPattern::nextSequence())
+     * @param vendorId The prefixed origin of the message
+     */
+    void appendHeader(const RF24LogHeaderPattern *pattern, uint8_t logLevel, uint32_t sequence, const char *vendorId);
+
+#if defined (ARDUINO_ARCH_AVR)
+    void appendHeader(const RF24LogHeaderPattern *pattern, uint8_t logLevel, uint32_t sequence,
+                      const __FlashStringHelper *vendorId);
+#endif
+
+    /**
+     * @brief output 1 field of a header pattern (except the vendorId)
+     * @param pattern The compiled header layout
+     * @param field The field to output
+     * @param logLevel The level of the logging message
+     * @param sequence The message's sequence number
+     */
+    void appendHeaderField(const RF24LogHeaderPattern *pattern, const RF24LogHeaderPattern::Field *field,
+                           uint8_t logLevel, uint32_t sequence);
+
     /**
      * @brief output a data according to the format specifier
      * @param fmt_parser The object of prefixed specifier options/flags
      * @param args The sequence of args
      */
-    void appendFormat(FormatSpecifier* fmt_parser, va_list *args);
+    void appendFormat(FormatSpecifier* fmt_parser, RF24LogArgList *args);
+
+    /**
+     * @brief output a decimal number that was split with integer arithmetic only
+     * @param number The split number
+     * @param fmt_parser The object of prefixed specifier options/flags (for the padding)
+     */
+    void appendFixed(const RF24LogFixed *number, FormatSpecifier *fmt_parser);
+
+    /**
+     * @brief output a buffer of bytes as pairs of hexadecimal digits
+     * @param data The bytes
+     * @param size The number of bytes in the @p data buffer
+     * @param fmt_parser The object of prefixed specifier options/flags (the `pad_quantity` is the
+     * number of bytes per space-separated group, and the `#` flag adds an ASCII column)
+     */
+    void appendBytes(const uint8_t *data, uint16_t size, FormatSpecifier *fmt_parser);
 
     /**
      * @brief append a character a number of times
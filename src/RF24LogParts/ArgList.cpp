@@ -0,0 +1,246 @@
+/**
+ * @file ArgList.cpp
+ * @date Created 19 Oct 2026
+ * @author Brendan Doherty (2bndy5)
+ * @copyright Copyright (C) <br>
+ *      2026        Brendan Doherty (2bndy5) <br>
+ * This General Public License does not permit incorporating your program into
+ * proprietary programs.  If your program is a subroutine library, you may
+ * consider it more useful to permit linking proprietary applications with the
+ * library.  If this is what you want to do, use the GNU Lesser General
+ * Public License instead of this License.
+ */
+
+#include "ArgList.h"
+#if defined(ARDUINO_ARCH_AVR)
+#include <avr/pgmspace.h> // pgm_read_byte()
+#endif
+
+#include "FormatSpecifier.h" // FormatSpecifier struct
+
+/****************************************************************************/
+
+RF24LogArgList::RF24LogArgList(va_list *args)
+    : _list(args), _packed(nullptr), _size(0), _pos(0)
+{
+}
+
+/****************************************************************************/
+
+RF24LogArgList::RF24LogArgList(const uint8_t *packed, uint16_t size)
+    : _list(nullptr), _packed(packed), _size(size), _pos(0)
+{
+}
+
+/****************************************************************************/
+
+void RF24LogArgList::unpack(void *dest, uint16_t len)
+{
+    if (_pos + len <= _size)
+    {
+        memcpy(dest, _packed + _pos, len);
+        _pos += len;
+    }
+    else
+    {
+        memset(dest, 0, len);
+        _pos = _size;
+    }
+}
+
+/****************************************************************************/
+
+int RF24LogArgList::nextInt()
+{
+    if (_list != nullptr)
+    {
+        return va_arg(*_list, int);
+    }
+    int data;
+    unpack(&data, sizeof(int));
+    return data;
+}
+
+/****************************************************************************/
+
+double RF24LogArgList::nextDouble()
+{
+    if (_list != nullptr)
+    {
+        return va_arg(*_list, double);
+    }
+    double data;
+    unpack(&data, sizeof(double));
+    return data;
+}
+
+/****************************************************************************/
+
+const char *RF24LogArgList::nextStr()
+{
+    if (_list != nullptr)
+    {
+        return va_arg(*_list, char *);
+    }
+    if (_pos >= _size)
+    {
+        return "";
+    }
+    const char *str = (const char *)(_packed + _pos);
+    _pos += strlen(str) + 1; // pack() always terminates a copied string
+    return str;
+}
+
+/****************************************************************************/
+
+uint16_t RF24LogArgList::nextBytes(const uint8_t **data)
+{
+    if (_list != nullptr)
+    {
+        *data = (const uint8_t *)va_arg(*_list, void *);
+        int len = va_arg(*_list, int);
+        return *data == nullptr || len < 0 ? 0 : (uint16_t)(len > 0xFFFF ? 0xFFFF : len);
+    }
+    uint16_t len;
+    unpack(&len, sizeof(len));
+    if (len > _size - _pos)
+    {
+        len = _size - _pos;
+    }
+    *data = _packed + _pos;
+    _pos += len; // pack() only stores the length of the bytes that it copied
+    return len;
+}
+
+/****************************************************************************/
+
+#if defined(ARDUINO_ARCH_AVR)
+const __FlashStringHelper *RF24LogArgList::nextFlashStr()
+{
+    if (_list != nullptr)
+    {
+        return (const __FlashStringHelper *)va_arg(*_list, int);
+    }
+    const __FlashStringHelper *data;
+    unpack(&data, sizeof(data));
+    return data == nullptr ? (const __FlashStringHelper *)PSTR("") : data;
+}
+#endif
+
+/****************************************************************************/
+
+/**
+ * @brief walk the format specifiers of a message and copy the corresponding arguments
+ * @tparam Reader a callable that returns the next char of the message
+ * (this mirrors the parsing done in RF24LogPrintfParser::write()).
+ */
+template <typename Reader>
+static uint16_t packArgs(uint8_t *dest, uint16_t size, Reader next, va_list *args)
+{
+    uint16_t pos = 0;
+    char c = next();
+    while (c)
+    {
+        if (c != '%')
+        {
+            c = next();
+            continue;
+        }
+        FormatSpecifier fmt_parser;
+        c = next();
+        while (c && fmt_parser.isFlagged(c))   { c = next(); }
+        while (c && fmt_parser.isPaddPrec(c))  { c = next(); }
+        bool consumed = true; // did isFmtOption() consume the char that `c` holds?
+        while (c && fmt_parser.isFmtOption(c)) { c = next(); }
+        if (fmt_parser.specifier && fmt_parser.specifier == c)
+        {
+            consumed = false; // the specifier itself is still held in `c`
+        }
+        if (!fmt_parser.specifier)
+        {
+            c = c ? next() : c; // an escaped char (like `%%`)
+            continue;
+        }
+
+        char s = fmt_parser.specifier;
+        if (s == 's')
+        {
+            const char *str = va_arg(*args, char *);
+            if (pos < size)
+            {
+                uint16_t len = str == nullptr ? 0 : strlen(str);
+                if (len > size - pos - 1) { len = size - pos - 1; }
+                memcpy(dest + pos, str, len);
+                dest[pos + len] = 0;
+                pos += len + 1;
+            }
+        }
+#if defined(ARDUINO_ARCH_AVR)
+        else if (s == 'S')
+        {
+            const __FlashStringHelper *str = (const __FlashStringHelper *)va_arg(*args, int);
+            if (pos + sizeof(str) <= size)
+            {
+                memcpy(dest + pos, &str, sizeof(str));
+                pos += sizeof(str);
+            }
+        }
+#endif
+        else if (s == 'H')
+        {
+            const void *data = va_arg(*args, void *);
+            int len = va_arg(*args, int);
+            if (pos + sizeof(uint16_t) <= size)
+            {
+                uint16_t copied = data == nullptr || len < 0 ? 0 : (uint16_t)(len > 0xFFFF ? 0xFFFF : len);
+                if (copied > size - pos - sizeof(uint16_t)) { copied = size - pos - sizeof(uint16_t); }
+                memcpy(dest + pos, &copied, sizeof(uint16_t));
+                if (copied) { memcpy(dest + pos + sizeof(uint16_t), data, copied); }
+                pos += sizeof(uint16_t) + copied;
+            }
+        }
+        else if (s == 'D' || s == 'F' || s == 'f')
+        {
+            double data = va_arg(*args, double);
+            if (pos + sizeof(double) <= size)
+            {
+                memcpy(dest + pos, &data, sizeof(double));
+                pos += sizeof(double);
+            }
+        }
+        else if (s == 'c' || s == 'd' || s == 'i' || s == 'u' || s == 'x' || s == 'X' || s == 'o' || s == 'b' || s == 'k')
+        {
+            int data = va_arg(*args, int);
+            if (pos + sizeof(int) <= size)
+            {
+                memcpy(dest + pos, &data, sizeof(int));
+                pos += sizeof(int);
+            }
+        }
+        // any other specifier is output literally and consumes no argument
+
+        if (!consumed && c)
+        {
+            c = next();
+        }
+    }
+    return pos;
+}
+
+/****************************************************************************/
+
+uint16_t RF24LogArgList::pack(uint8_t *dest, uint16_t size, const char *message, va_list *args)
+{
+    const char *p = message;
+    return packArgs(dest, size, [&p]() -> char { return *p ? *p++ : 0; }, args);
+}
+
+/****************************************************************************/
+
+#if defined(ARDUINO_ARCH_AVR)
+uint16_t RF24LogArgList::pack(uint8_t *dest, uint16_t size, const __FlashStringHelper *message, va_list *args)
+{
+    PGM_P p = reinterpret_cast<PGM_P>(message);
+    return packArgs(dest, size, [&p]() -> char { char c = pgm_read_byte(p); if (c) { ++p; } return c; }, args);
+}
+#endif
@@ -0,0 +1,108 @@
+/**
+ * @file ArgList.h
+ * @brief a uniform cursor over format arguments (live or captured)
+ * @date Created 19 Oct 2026
+ * @author Brendan Doherty (2bndy5)
+ * @copyright Copyright (C) <br>
+ *      2026        Brendan Doherty (2bndy5) <br>
+ * This General Public License does not permit incorporating your program into
+ * proprietary programs.  If your program is a subroutine library, you may
+ * consider it more useful to permit linking proprietary applications with the
+ * library.  If this is what you want to do, use the GNU Lesser General
+ * Public License instead of this License.
+ */
+
+#ifndef SRC_RF24LOGPARTS_ARGLIST_H_
+#define SRC_RF24LOGPARTS_ARGLIST_H_
+
+#if defined (ARDUINO_ARCH_AVR)
+#include <WString.h> // __FlashStringHelper
+#else
+#include <string.h>
+#endif
+
+#include <stdint.h>
+#include <stdarg.h>
+
+/**
+ * @brief A sequence of arguments used to replace the format specifiers of a message.
+ *
+ * The arguments either come from a live `va_list` (the normal logging path) or from a
+ * flat buffer that was previously filled by pack() (a captured RF24LogRecord).
+ * Packed arguments are consumed in the same order that the format specifiers appear in
+ * the message. Any argument that did not fit in the packed buffer reads as `0` (or an
+ * empty string).
+ */
+class RF24LogArgList
+{
+public:
+
+    /**
+     * @brief Instantiate a cursor over a live `va_list`
+     * @param args The sequence of variables passed to RF24Logging::log()
+     */
+    RF24LogArgList(va_list *args);
+
+    /**
+     * @brief Instantiate a cursor over arguments previously packed with pack()
+     * @param packed The buffer of packed arguments
+     * @param size The number of bytes used in the @p packed buffer
+     */
+    RF24LogArgList(const uint8_t *packed, uint16_t size);
+
+    /** @brief fetch the next argument as an `int` (used for integers and chars) */
+    int nextInt();
+
+    /** @brief fetch the next argument as a `double` */
+    double nextDouble();
+
+    /** @brief fetch the next argument as a c-string (from RAM) */
+    const char *nextStr();
+
+    /**
+     * @brief fetch the next 2 arguments as a buffer of bytes (a pointer followed by an `int` length)
+     * @param data Set to the first byte of the buffer
+     * @return The number of bytes in the buffer (this is less than the length that was logged if
+     * the packed copy of the buffer was truncated)
+     */
+    uint16_t nextBytes(const uint8_t **data);
+
+#if defined (ARDUINO_ARCH_AVR)
+    /** @brief fetch the next argument as a c-string stored in FLASH */
+    const __FlashStringHelper *nextFlashStr();
+#endif
+
+    /**
+     * @brief copy the arguments of a message into a flat buffer
+     *
+     * Strings (from RAM) and byte buffers (see the `H` specifier) are copied by value, so the buffer remains valid after the
+     * caller's variables go out of scope. This does not allocate memory and does not
+     * call any stdio functions, so it is safe to use in an interrupt (or signal) handler.
+     * @param dest The buffer to fill
+     * @param size The size of the @p dest buffer
+     * @param message The message format string that describes the @p args
+     * @param args The sequence of variables used to replace the format specifiers
+     * @return The number of bytes used in the @p dest buffer
+     */
+    static uint16_t pack(uint8_t *dest, uint16_t size, const char *message, va_list *args);
+
+#if defined (ARDUINO_ARCH_AVR)
+    static uint16_t pack(uint8_t *dest, uint16_t size, const __FlashStringHelper *message, va_list *args);
+#endif
+
+private:
+
+    /** @brief The live arguments (nullptr when reading packed arguments) */
+    va_list *_list;
+    /** @brief The packed arguments */
+    const uint8_t *_packed;
+    /** @brief The number of bytes in the @ref _packed buffer */
+    uint16_t _size;
+    /** @brief The read position in the @ref _packed buffer */
+    uint16_t _pos;
+
+    /** @brief copy the next @p len bytes of packed data into @p dest (or zeros if exhausted) */
+    void unpack(void *dest, uint16_t len);
+};
+
+#endif /* SRC_RF24LOGPARTS_ARGLIST_H_ */
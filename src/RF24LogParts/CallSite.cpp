@@ -0,0 +1,18 @@
+/**
+ * @file CallSite.cpp
+ * @date Created 19 Oct 2026
+ * @author Brendan Doherty (2bndy5)
+ * @copyright Copyright (C) <br>
+ *      2026        Brendan Doherty (2bndy5) <br>
+ * This General Public License does not permit incorporating your program into
+ * proprietary programs.  If your program is a subroutine library, you may
+ * consider it more useful to permit linking proprietary applications with the
+ * library.  If this is what you want to do, use the GNU Lesser General
+ * Public License instead of this License.
+ */
+
+#include "CallSite.h"
+
+#if defined (RF24LOG_HOSTED)
+thread_local bool RF24LogSites::t_forced RF24LOG_TLS_MODEL = false;
+#endif
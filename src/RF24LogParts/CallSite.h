@@ -0,0 +1,217 @@
+/**
+ * @file CallSite.h
+ * @brief A registry of the call sites that use the @ref LoggingAPI macros
+ * @date Created 19 Oct 2026
+ * @author Brendan Doherty (2bndy5)
+ * @copyright Copyright (C) <br>
+ *      2026        Brendan Doherty (2bndy5) <br>
+ * This General Public License does not permit incorporating your program into
+ * proprietary programs.  If your program is a subroutine library, you may
+ * consider it more useful to permit linking proprietary applications with the
+ * library.  If this is what you want to do, use the GNU Lesser General
+ * Public License instead of this License.
+ */
+
+#ifndef SRC_RF24LOGPARTS_CALLSITE_H_
+#define SRC_RF24LOGPARTS_CALLSITE_H_
+
+#include <stdint.h>
+#include "Common.h" // RF24LOG_HOSTED, RF24LOG_TLS_MODEL
+
+// The call site registry needs GCC-compatible inline assembly and an ELF linker (which
+// defines the __start_ & __stop_ symbols of a section). Static variables in inline functions
+// can't be referenced as assembler constants in shared library code (-fPIC without -fPIE).
+#if defined (RF24LOG_HOSTED) && defined (__GNUC__) && defined (__ELF__) \
+    && (!defined (__PIC__) || defined (__PIE__)) && !defined (RF24LOG_NO_SITES)
+/** @brief macro (automatically defined) when the call site registry is available */
+#define RF24LOG_SITES
+#endif
+
+#ifdef DOXYGEN_FORCED
+/** @brief macro (when defined) disables the call site registry (see RF24LogSites) */
+#define RF24LOG_NO_SITES
+#endif
+
+#if defined (RF24LOG_HOSTED)
+#include <atomic>
+#include <string.h> // strlen(), strcmp()
+
+/** @brief The per-call site switches (see RF24LogSite::mode) */
+enum RF24LogSiteMode : uint8_t
+{
+    /** the message is filtered by the handler's log level (as usual) */
+    RF24LOG_SITE_DEFAULT = 0,
+    /** the message is output regardless of the handler's log level */
+    RF24LOG_SITE_ENABLED = 1,
+    /** the message is never output (the handler is not even called) */
+    RF24LOG_SITE_DISABLED = 2
+};
+
+/**
+ * @brief A static description of a call to one of the @ref LoggingAPI macros.
+ *
+ * Each call site (whose message is a compile-time constant) owns one of these. It is always
+ * constant-initialized, so registering the call site has no runtime cost (and is safe in a
+ * signal handler).
+ */
+struct RF24LogSite
+{
+    /** @brief The level passed to the macro (`0` if it isn't a compile-time constant) */
+    uint8_t logLevel;
+    /** @brief The call site's switch (a RF24LogSiteMode value); checked by RF24Logging::logAt() and RF24Logging::logSite() */
+    std::atomic<uint8_t> mode;
+    /** @brief The line (in @ref file) of the call site */
+    uint16_t line;
+    /** @brief The vendorId passed to the macro (`nullptr` if it isn't a compile-time constant) */
+    const char *vendorId;
+    /** @brief The message format string passed to the macro */
+    const char *message;
+    /** @brief The source file of the call site */
+    const char *file;
+};
+
+#if defined (RF24LOG_SITES)
+// defined by the linker for the module (executable) that contains the call sites
+extern RF24LogSite *const __start_rf24log_sites[] __attribute__((weak, visibility("hidden")));
+extern RF24LogSite *const __stop_rf24log_sites[] __attribute__((weak, visibility("hidden")));
+#endif
+
+/**
+ * @brief Enumerate and switch the call sites of the @ref LoggingAPI macros.
+ *
+ * The address of every call site's RF24LogSite is placed in a dedicated linker section
+ * (named `rf24log_sites`), so the complete set can be enumerated at any time (even before the
+ * call sites have executed). Only the call sites of the module (executable) that calls these
+ * functions are enumerated.
+ *
+ * These functions are empty when @ref RF24LOG_SITES is not defined.
+ */
+class RF24LogSites
+{
+public:
+
+    /**
+     * @brief call a function for each call site
+     * @param callback The function to call (with the site and the @p context)
+     * @param context A pointer passed through to the @p callback
+     * @return The number of call sites
+     */
+    static inline uint16_t forEach(void (*callback)(RF24LogSite *site, void *context), void *context = nullptr)
+    {
+        uint16_t count = 0;
+#if defined (RF24LOG_SITES)
+        for (RF24LogSite *const *it = __start_rf24log_sites; it != __stop_rf24log_sites; ++it)
+        {
+            if (isDuplicate(it))
+            {
+                continue;
+            }
+            callback(*it, context);
+            ++count;
+        }
+#else
+        (void)callback;
+        (void)context;
+#endif
+        return count;
+    }
+
+    /**
+     * @brief find the call site of a message
+     * @param message The message format string (as passed to the macro)
+     * @return The first call site that logs the @p message, or `nullptr` if none do.
+     */
+    static inline RF24LogSite *find(const char *message)
+    {
+#if defined (RF24LOG_SITES)
+        for (RF24LogSite *const *it = __start_rf24log_sites; it != __stop_rf24log_sites; ++it)
+        {
+            if ((*it)->message == message)
+            {
+                return *it;
+            }
+        }
+#else
+        (void)message;
+#endif
+        return nullptr;
+    }
+
+    /**
+     * @brief switch the call sites in a source file
+     * @param file The source file's name (or a trailing part of its path, like `"main.cpp"`)
+     * @param line The line of the call site. Use `0` to switch all call sites in the @p file.
+     * @param mode The new RF24LogSiteMode
+     * @return The number of call sites that were switched
+     */
+    static inline uint16_t setMode(const char *file, uint16_t line, uint8_t mode)
+    {
+        uint16_t count = 0;
+#if defined (RF24LOG_SITES)
+        size_t len = strlen(file);
+        for (RF24LogSite *const *it = __start_rf24log_sites; it != __stop_rf24log_sites; ++it)
+        {
+            RF24LogSite *site = *it;
+            size_t siteLen = strlen(site->file);
+            if ((line == 0 || site->line == line)
+                && siteLen >= len
+                && strcmp(site->file + siteLen - len, file) == 0
+                && !isDuplicate(it))
+            {
+                site->mode.store(mode, std::memory_order_relaxed);
+                ++count;
+            }
+        }
+#else
+        (void)file;
+        (void)line;
+        (void)mode;
+#endif
+        return count;
+    }
+
+    /**
+     * @brief Is the calling thread logging from a call site that is switched to @ref RF24LOG_SITE_ENABLED?
+     *
+     * RF24LogAbstractHandler uses this to bypass its log level.
+     */
+    static inline bool isForced() { return t_forced; }
+
+    /** @brief set the value returned by isForced() (used by RF24Logging::logAt() and RF24Logging::logSite()) */
+    static inline void setForced(bool forced) { t_forced = forced; }
+
+private:
+
+#if defined (RF24LOG_SITES)
+    /** @brief a call site inlined into several functions is listed once per copy */
+    static inline bool isDuplicate(RF24LogSite *const *it)
+    {
+        for (RF24LogSite *const *prev = __start_rf24log_sites; prev != it; ++prev)
+        {
+            if (*prev == *it)
+            {
+                return true;
+            }
+        }
+        return false;
+    }
+#endif
+
+    /** @brief The calling thread is logging from a forced call site */
+    static thread_local bool t_forced RF24LOG_TLS_MODEL;
+};
+
+#if defined (RF24LOG_SITES)
+/**
+ * @brief output the address of a call site's RF24LogSite into the `rf24log_sites` section.
+ *
+ * This is done in assembly because GCC doesn't allow the `section` attribute on static
+ * variables of both inline and non-inline functions in the same translation unit.
+ */
+#define RF24LOG_SITE_REGISTER(site) __asm__ __volatile__(".pushsection rf24log_sites,\"aw\"\n\t" \
+                                                         ".balign %c1\n\t.dc.a %c0\n\t.popsection"    \
+                                                         :: "i"(&site), "i"(sizeof(void *)))
+#endif
+
+#endif // defined (RF24LOG_HOSTED)
+#endif /* SRC_RF24LOGPARTS_CALLSITE_H_ */
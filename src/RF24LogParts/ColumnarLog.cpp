@@ -0,0 +1,650 @@
+/**
+ * @file ColumnarLog.cpp
+ * @date Created 19 Oct 2026
+ * @author Brendan Doherty (2bndy5)
+ * @copyright Copyright (C) <br>
+ *      2026        Brendan Doherty (2bndy5) <br>
+ * This General Public License does not permit incorporating your program into
+ * proprietary programs.  If your program is a subroutine library, you may
+ * consider it more useful to permit linking proprietary applications with the
+ * library.  If this is what you want to do, use the GNU Lesser General
+ * Public License instead of this License.
+ */
+
+#include "ColumnarLog.h"
+
+#if defined (RF24LOG_POSIX)
+#include <algorithm>  // std::sort()
+#include <errno.h>    // errno, EINTR
+#include <fcntl.h>    // open()
+#include <string.h>   // memcpy(), memcmp(), memset(), strcmp(), strnlen()
+#include <sys/mman.h> // mmap(), munmap()
+#include <sys/stat.h> // fstat()
+#include <unistd.h>   // write(), close()
+
+/****************************************************************************/
+
+/** @brief append an unsigned LEB128 varint */
+static void putVarint(std::vector<uint8_t> *column, uint64_t value)
+{
+    while (value >= 0x80)
+    {
+        column->push_back((uint8_t)(value | 0x80));
+        value >>= 7;
+    }
+    column->push_back((uint8_t)value);
+}
+
+/****************************************************************************/
+
+/** @brief read an unsigned LEB128 varint; false at the end of the column (or if it is corrupt) */
+static inline bool getVarint(const uint8_t **position, const uint8_t *end, uint64_t *value)
+{
+    uint64_t result = 0;
+    for (uint8_t shift = 0; shift < 64 && *position < end; shift += 7)
+    {
+        uint8_t byte = *(*position)++;
+        result |= (uint64_t)(byte & 0x7F) << shift;
+        if (!(byte & 0x80))
+        {
+            *value = result;
+            return true;
+        }
+    }
+    return false;
+}
+
+/****************************************************************************/
+
+/** @brief the @ref RF24LogColumnarSegmentHeader::levels bits of the levels from @p minLevel to @p maxLevel */
+static uint32_t levelMask(uint8_t minLevel, uint8_t maxLevel)
+{
+    uint32_t mask = 0;
+    for (unsigned group = minLevel >> 3; group <= (unsigned)(maxLevel >> 3) && minLevel <= maxLevel; ++group)
+    {
+        mask |= 1UL << group;
+    }
+    return mask;
+}
+
+/****************************************************************************/
+
+RF24LogColumnarWriter::RF24LogColumnarWriter(uint32_t segmentRows)
+{
+    _fd = -1;
+    _failed = false;
+    _end = 0;
+    _rows = 0;
+    _segmentRows = segmentRows ? segmentRows : 1;
+    memset(&_segment, 0, sizeof(_segment));
+    _previous = 0;
+    memset(_levelIds, 0xFF, sizeof(_levelIds));
+}
+
+/****************************************************************************/
+
+RF24LogColumnarWriter::~RF24LogColumnarWriter()
+{
+    close();
+}
+
+/****************************************************************************/
+
+bool RF24LogColumnarWriter::open(const char *path)
+{
+    close();
+    _fd = ::open(path, O_WRONLY | O_CREAT | O_TRUNC | O_CLOEXEC, 0644);
+    if (_fd < 0)
+    {
+        return false;
+    }
+    _failed = false;
+    _end = 0;
+    _rows = 0;
+    _index.clear();
+    memset(_levelIds, 0xFF, sizeof(_levelIds));
+    _levels.clear();
+    _vendorIds.clear();
+    _vendors.clear();
+    _formatIds.clear();
+    _formats.clear();
+    for (std::vector<uint8_t> &column : _columns)
+    {
+        column.clear();
+    }
+    memset(&_segment, 0, sizeof(_segment));
+    _previous = 0;
+
+    RF24LogColumnarFileHeader header;
+    memset(&header, 0, sizeof(header));
+    memcpy(header.magic, RF24LOG_COLUMNAR_MAGIC, sizeof(RF24LOG_COLUMNAR_MAGIC));
+    header.version = RF24LOG_COLUMNAR_VERSION;
+    return append(&header, sizeof(header));
+}
+
+/****************************************************************************/
+
+bool RF24LogColumnarWriter::append(const void *data, size_t length)
+{
+    const char *bytes = static_cast<const char *>(data);
+    while (length && !_failed)
+    {
+        ssize_t written = ::write(_fd, bytes, length);
+        if (written <= 0)
+        {
+            if (written < 0 && errno == EINTR)
+            {
+                continue;
+            }
+            _failed = true;
+            break;
+        }
+        bytes += written;
+        length -= (size_t)written;
+        _end += (uint64_t)written;
+    }
+    return !_failed;
+}
+
+/****************************************************************************/
+
+uint32_t RF24LogColumnarWriter::lookup(std::unordered_map<std::string, uint32_t> *ids,
+                                       std::vector<std::string> *strings,
+                                       const char *value)
+{
+    auto found = ids->emplace(value, (uint32_t)strings->size());
+    if (found.second)
+    {
+        strings->push_back(found.first->first);
+    }
+    return found.first->second;
+}
+
+/****************************************************************************/
+
+bool RF24LogColumnarWriter::add(RF24LogTime timestamp,
+                                uint8_t logLevel,
+                                const char *vendorId,
+                                const char *message,
+                                const uint8_t *args,
+                                uint16_t argsSize)
+{
+    if (_fd < 0 || _failed)
+    {
+        return false;
+    }
+    if (_levelIds[logLevel] < 0)
+    {
+        _levelIds[logLevel] = (int16_t)_levels.size();
+        _levels.push_back(logLevel);
+    }
+
+    // zigzag encoding keeps small negative differences (between threads' timestamps) small
+    int64_t delta = (int64_t)(timestamp - _previous);
+    putVarint(&_columns[RF24LOG_COLUMN_TIME], ((uint64_t)delta << 1) ^ (uint64_t)(delta >> 63));
+    _previous = timestamp;
+    _columns[RF24LOG_COLUMN_LEVEL].push_back((uint8_t)_levelIds[logLevel]);
+    putVarint(&_columns[RF24LOG_COLUMN_VENDOR], lookup(&_vendorIds, &_vendors, vendorId));
+    putVarint(&_columns[RF24LOG_COLUMN_FORMAT], lookup(&_formatIds, &_formats, message));
+    putVarint(&_columns[RF24LOG_COLUMN_ARGS], argsSize);
+    _columns[RF24LOG_COLUMN_ARGS].insert(_columns[RF24LOG_COLUMN_ARGS].end(), args, args + argsSize);
+
+    if (_segment.rows == 0 || timestamp < _segment.firstTime)
+    {
+        _segment.firstTime = timestamp;
+    }
+    if (_segment.rows == 0 || timestamp > _segment.lastTime)
+    {
+        _segment.lastTime = timestamp;
+    }
+    _segment.levels |= 1UL << (logLevel >> 3);
+    ++_rows;
+    if (++_segment.rows == _segmentRows)
+    {
+        return writeSegment();
+    }
+    return true;
+}
+
+/****************************************************************************/
+
+bool RF24LogColumnarWriter::writeSegment()
+{
+    if (_segment.rows == 0)
+    {
+        return !_failed;
+    }
+    _segment.magic = RF24LOG_COLUMNAR_SEGMENT_MAGIC;
+    for (uint8_t i = 0; i < RF24LOG_COLUMNS; ++i)
+    {
+        _segment.columnSize[i] = (uint32_t)_columns[i].size();
+    }
+    _index.push_back({_end, _segment});
+    append(&_segment, sizeof(_segment));
+    for (std::vector<uint8_t> &column : _columns)
+    {
+        append(column.data(), column.size());
+        column.clear();
+    }
+    memset(&_segment, 0, sizeof(_segment));
+    _previous = 0;
+    return !_failed;
+}
+
+/****************************************************************************/
+
+bool RF24LogColumnarWriter::close()
+{
+    if (_fd < 0)
+    {
+        return false;
+    }
+    writeSegment();
+    RF24LogColumnarTrailer trailer;
+    memset(&trailer, 0, sizeof(trailer));
+    trailer.magic = RF24LOG_COLUMNAR_TRAILER_MAGIC;
+    trailer.segmentCount = (uint32_t)_index.size();
+    trailer.levelCount = (uint32_t)_levels.size();
+    trailer.vendorCount = (uint32_t)_vendors.size();
+    trailer.formatCount = (uint32_t)_formats.size();
+    trailer.footerOffset = _end;
+    append(_index.data(), _index.size() * sizeof(RF24LogColumnarIndexEntry));
+    append(_levels.data(), _levels.size());
+    for (const std::string &vendorId : _vendors)
+    {
+        append(vendorId.c_str(), vendorId.size() + 1);
+    }
+    for (const std::string &message : _formats)
+    {
+        append(message.c_str(), message.size() + 1);
+    }
+    trailer.footerSize = _end - trailer.footerOffset;
+    append(&trailer, sizeof(trailer));
+    bool result = !_failed && ::close(_fd) == 0;
+    _fd = -1;
+    return result;
+}
+
+/****************************************************************************/
+
+RF24LogColumnarArchive::RF24LogColumnarArchive()
+{
+    _data = nullptr;
+    _size = 0;
+}
+
+/****************************************************************************/
+
+RF24LogColumnarArchive::~RF24LogColumnarArchive()
+{
+    close();
+}
+
+/****************************************************************************/
+
+/** @brief collect @p count null-terminated strings; false if they overrun @p end */
+static bool readStrings(const char **position, const char *end, uint32_t count, std::vector<const char *> *strings)
+{
+    strings->clear();
+    strings->reserve(count);
+    for (uint32_t i = 0; i < count; ++i)
+    {
+        size_t length = strnlen(*position, (size_t)(end - *position));
+        if (*position + length >= end)
+        {
+            return false;
+        }
+        strings->push_back(*position);
+        *position += length + 1;
+    }
+    return true;
+}
+
+/****************************************************************************/
+
+bool RF24LogColumnarArchive::open(const char *path)
+{
+    close();
+    int fd = ::open(path, O_RDONLY | O_CLOEXEC);
+    if (fd < 0)
+    {
+        return false;
+    }
+    struct stat info;
+    void *map = MAP_FAILED;
+    if (fstat(fd, &info) == 0 && info.st_size > 0)
+    {
+        map = mmap(nullptr, (size_t)info.st_size, PROT_READ, MAP_PRIVATE, fd, 0);
+    }
+    ::close(fd);
+    if (map == MAP_FAILED)
+    {
+        return false;
+    }
+    _data = static_cast<const char *>(map);
+    _size = (size_t)info.st_size;
+
+    RF24LogColumnarFileHeader header;
+    RF24LogColumnarTrailer trailer;
+    if (_size < sizeof(header) + sizeof(trailer))
+    {
+        close();
+        return false;
+    }
+    memcpy(&header, _data, sizeof(header));
+    memcpy(&trailer, _data + _size - sizeof(trailer), sizeof(trailer));
+    size_t indexSize = (size_t)trailer.segmentCount * sizeof(RF24LogColumnarIndexEntry);
+    if (memcmp(header.magic, RF24LOG_COLUMNAR_MAGIC, sizeof(RF24LOG_COLUMNAR_MAGIC)) != 0
+        || header.version != RF24LOG_COLUMNAR_VERSION
+        || trailer.magic != RF24LOG_COLUMNAR_TRAILER_MAGIC
+        || trailer.footerOffset + trailer.footerSize + sizeof(trailer) != _size
+        || indexSize + trailer.levelCount > trailer.footerSize)
+    {
+        close();
+        return false;
+    }
+
+    const char *footer = _data + trailer.footerOffset;
+    const char *footerEnd = footer + trailer.footerSize;
+    _index.resize(trailer.segmentCount);
+    memcpy(_index.data(), footer, indexSize);
+    _levels.assign(footer + indexSize, footer + indexSize + trailer.levelCount);
+    const char *strings = footer + indexSize + trailer.levelCount;
+    if (!readStrings(&strings, footerEnd, trailer.vendorCount, &_vendors)
+        || !readStrings(&strings, footerEnd, trailer.formatCount, &_formats))
+    {
+        close();
+        return false;
+    }
+    for (const RF24LogColumnarIndexEntry &entry : _index)
+    {
+        uint64_t size = sizeof(RF24LogColumnarSegmentHeader);
+        for (uint8_t i = 0; i < RF24LOG_COLUMNS; ++i)
+        {
+            size += entry.header.columnSize[i];
+        }
+        if (entry.offset + size > trailer.footerOffset)
+        {
+            close();
+            return false;
+        }
+    }
+    return true;
+}
+
+/****************************************************************************/
+
+void RF24LogColumnarArchive::close()
+{
+    if (_data != nullptr)
+    {
+        munmap(const_cast<char *>(_data), _size);
+        _data = nullptr;
+        _size = 0;
+    }
+    _index.clear();
+    _levels.clear();
+    _vendors.clear();
+    _formats.clear();
+}
+
+/****************************************************************************/
+
+uint64_t RF24LogColumnarArchive::rows() const
+{
+    uint64_t rows = 0;
+    for (const RF24LogColumnarIndexEntry &entry : _index)
+    {
+        rows += entry.header.rows;
+    }
+    return rows;
+}
+
+/****************************************************************************/
+
+long RF24LogColumnarArchive::findVendor(const char *vendorId) const
+{
+    for (size_t i = 0; i < _vendors.size(); ++i)
+    {
+        if (strcmp(_vendors[i], vendorId) == 0)
+        {
+            return (long)i;
+        }
+    }
+    return -1;
+}
+
+/****************************************************************************/
+
+/** @brief find the columns of a segment */
+static void findColumns(const char *segment, const RF24LogColumnarSegmentHeader &header,
+                        const uint8_t **columns, const uint8_t **ends)
+{
+    const uint8_t *position = reinterpret_cast<const uint8_t *>(segment + sizeof(header));
+    for (uint8_t i = 0; i < RF24LOG_COLUMNS; ++i)
+    {
+        columns[i] = position;
+        position += header.columnSize[i];
+        ends[i] = position;
+    }
+}
+
+/****************************************************************************/
+
+bool RF24LogColumnarArchive::readSegment(size_t segment, std::vector<RF24LogColumnarRow> *rows) const
+{
+    rows->clear();
+    if (segment >= _index.size())
+    {
+        return false;
+    }
+    const RF24LogColumnarSegmentHeader &header = _index[segment].header;
+    const uint8_t *columns[RF24LOG_COLUMNS];
+    const uint8_t *ends[RF24LOG_COLUMNS];
+    findColumns(_data + _index[segment].offset, header, columns, ends);
+    if (header.columnSize[RF24LOG_COLUMN_LEVEL] < header.rows)
+    {
+        return false;
+    }
+    rows->resize(header.rows);
+    RF24LogTime timestamp = 0;
+    for (uint32_t i = 0; i < header.rows; ++i)
+    {
+        RF24LogColumnarRow &row = (*rows)[i];
+        uint64_t time, vendor, format, argsSize;
+        if (!getVarint(&columns[RF24LOG_COLUMN_TIME], ends[RF24LOG_COLUMN_TIME], &time)
+            || !getVarint(&columns[RF24LOG_COLUMN_VENDOR], ends[RF24LOG_COLUMN_VENDOR], &vendor)
+            || !getVarint(&columns[RF24LOG_COLUMN_FORMAT], ends[RF24LOG_COLUMN_FORMAT], &format)
+            || !getVarint(&columns[RF24LOG_COLUMN_ARGS], ends[RF24LOG_COLUMN_ARGS], &argsSize)
+            || argsSize > (uint64_t)(ends[RF24LOG_COLUMN_ARGS] - columns[RF24LOG_COLUMN_ARGS])
+            || argsSize > UINT16_MAX
+            || columns[RF24LOG_COLUMN_LEVEL][i] >= _levels.size())
+        {
+            rows->clear();
+            return false;
+        }
+        timestamp += (RF24LogTime)((time >> 1) ^ (~(time & 1) + 1));
+        row.timestamp = timestamp;
+        row.logLevel = _levels[columns[RF24LOG_COLUMN_LEVEL][i]];
+        row.vendor = (uint32_t)vendor;
+        row.format = (uint32_t)format;
+        row.args = columns[RF24LOG_COLUMN_ARGS];
+        row.argsSize = (uint16_t)argsSize;
+        columns[RF24LOG_COLUMN_ARGS] += argsSize;
+    }
+    return true;
+}
+
+/****************************************************************************/
+
+/** @brief the fields of a group of rows */
+struct RF24LogColumnarKey
+{
+    RF24LogTime time;
+    uint32_t vendor;
+    uint32_t format;
+    uint8_t logLevel;
+
+    inline bool operator==(const RF24LogColumnarKey &other) const
+    {
+        return time == other.time && vendor == other.vendor && format == other.format && logLevel == other.logLevel;
+    }
+};
+
+/** @brief hashes a RF24LogColumnarKey */
+struct RF24LogColumnarKeyHash
+{
+    inline size_t operator()(const RF24LogColumnarKey &key) const
+    {
+        uint64_t hash = key.time * 0x9E3779B97F4A7C15ULL;
+        hash ^= ((uint64_t)key.vendor << 40 | (uint64_t)key.format << 8 | key.logLevel) * 0xC2B2AE3D27D4EB4FULL;
+        return (size_t)(hash ^ (hash >> 29));
+    }
+};
+
+/****************************************************************************/
+
+bool RF24LogColumnarArchive::aggregate(const RF24LogColumnarQuery &query, std::vector<RF24LogColumnarCount> *result) const
+{
+    result->clear();
+    if (_data == nullptr)
+    {
+        return false;
+    }
+    // which level dictionary entries match
+    bool levelMatches[256];
+    bool allLevels = true;
+    for (size_t i = 0; i < 256; ++i)
+    {
+        levelMatches[i] = i < _levels.size() && _levels[i] >= query.minLevel && _levels[i] <= query.maxLevel;
+        allLevels &= i >= _levels.size() || levelMatches[i];
+    }
+    uint32_t levels = levelMask(query.minLevel, query.maxLevel);
+    bool byLevel = query.groupBy & RF24LOG_GROUP_LEVEL;
+    bool byVendor = query.groupBy & RF24LOG_GROUP_VENDOR;
+    bool byFormat = query.groupBy & RF24LOG_GROUP_FORMAT;
+
+    std::unordered_map<RF24LogColumnarKey, uint64_t, RF24LogColumnarKeyHash> counts;
+    RF24LogColumnarKey last = {0, 0, 0, 0};
+    uint64_t lastCount = 0; // consecutive rows of the same group are counted here first
+
+    for (const RF24LogColumnarIndexEntry &entry : _index)
+    {
+        const RF24LogColumnarSegmentHeader &segment = entry.header;
+        if (segment.rows == 0 || segment.firstTime > query.to || segment.lastTime < query.from
+            || !(segment.levels & levels))
+        {
+            continue;
+        }
+        // only decode the columns that the query needs
+        bool inWindow = segment.firstTime >= query.from && segment.lastTime <= query.to;
+        bool needTime = query.interval || !inWindow;
+        bool needLevel = byLevel || !allLevels;
+        bool needVendor = byVendor || query.vendor >= 0;
+        if (!needTime && !needLevel && !needVendor && !byFormat)
+        {
+            // the whole segment is 1 group
+            RF24LogColumnarKey whole = {0, 0, 0, 0};
+            if (!(last == whole))
+            {
+                if (lastCount)
+                {
+                    counts[last] += lastCount;
+                }
+                last = whole;
+                lastCount = 0;
+            }
+            lastCount += segment.rows;
+            continue;
+        }
+        const uint8_t *columns[RF24LOG_COLUMNS];
+        const uint8_t *ends[RF24LOG_COLUMNS];
+        findColumns(_data + entry.offset, segment, columns, ends);
+        if (needLevel && segment.columnSize[RF24LOG_COLUMN_LEVEL] < segment.rows)
+        {
+            return false;
+        }
+
+        RF24LogTime timestamp = 0;
+        for (uint32_t row = 0; row < segment.rows; ++row)
+        {
+            uint64_t value;
+            if (needTime)
+            {
+                if (!getVarint(&columns[RF24LOG_COLUMN_TIME], ends[RF24LOG_COLUMN_TIME], &value))
+                {
+                    return false;
+                }
+                timestamp += (RF24LogTime)((value >> 1) ^ (~(value & 1) + 1));
+            }
+            uint8_t levelId = needLevel ? columns[RF24LOG_COLUMN_LEVEL][row] : 0;
+            uint32_t vendor = 0;
+            if (needVendor)
+            {
+                if (!getVarint(&columns[RF24LOG_COLUMN_VENDOR], ends[RF24LOG_COLUMN_VENDOR], &value))
+                {
+                    return false;
+                }
+                vendor = (uint32_t)value;
+            }
+            uint32_t format = 0;
+            if (byFormat)
+            {
+                if (!getVarint(&columns[RF24LOG_COLUMN_FORMAT], ends[RF24LOG_COLUMN_FORMAT], &value))
+                {
+                    return false;
+                }
+                format = (uint32_t)value;
+            }
+            if ((!inWindow && (timestamp < query.from || timestamp > query.to))
+                || (needLevel && !levelMatches[levelId])
+                || (query.vendor >= 0 && vendor != (uint32_t)query.vendor))
+            {
+                continue;
+            }
+            RF24LogColumnarKey key = {
+                query.interval ? timestamp - timestamp % query.interval : 0,
+                byVendor ? vendor : 0,
+                format,
+                byLevel && levelId < _levels.size() ? _levels[levelId] : (uint8_t)0};
+            if (!(key == last))
+            {
+                if (lastCount)
+                {
+                    counts[last] += lastCount;
+                }
+                last = key;
+                lastCount = 0;
+            }
+            ++lastCount;
+        }
+    }
+    if (lastCount)
+    {
+        counts[last] += lastCount;
+    }
+
+    result->reserve(counts.size());
+    for (const auto &count : counts)
+    {
+        result->push_back({count.first.time, count.first.logLevel, count.first.vendor, count.first.format, count.second});
+    }
+    std::sort(result->begin(), result->end(), [](const RF24LogColumnarCount &a, const RF24LogColumnarCount &b) {
+        if (a.time != b.time)
+        {
+            return a.time < b.time;
+        }
+        if (a.logLevel != b.logLevel)
+        {
+            return a.logLevel < b.logLevel;
+        }
+        if (a.vendor != b.vendor)
+        {
+            return a.vendor < b.vendor;
+        }
+        return a.format < b.format;
+    });
+    return true;
+}
+
+#endif // defined (RF24LOG_POSIX)
@@ -0,0 +1,332 @@
+/**
+ * @file ColumnarLog.h
+ * @brief A columnar log archive (its writer, and its reader that aggregates over it)
+ * @date Created 19 Oct 2026
+ * @author Brendan Doherty (2bndy5)
+ * @copyright Copyright (C) <br>
+ *      2026        Brendan Doherty (2bndy5) <br>
+ * This General Public License does not permit incorporating your program into
+ * proprietary programs.  If your program is a subroutine library, you may
+ * consider it more useful to permit linking proprietary applications with the
+ * library.  If this is what you want to do, use the GNU Lesser General
+ * Public License instead of this License.
+ */
+
+#ifndef SRC_RF24LOGPARTS_COLUMNARLOG_H_
+#define SRC_RF24LOGPARTS_COLUMNARLOG_H_
+
+#include "Common.h" // RF24LOG_POSIX, RF24LogTime
+
+#if defined (RF24LOG_POSIX)
+#include <stddef.h>
+#include <stdint.h>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+/**
+ * @brief The first bytes of a columnar log archive.
+ *
+ * All the fixed size numbers in the file use the byte order of the machine that wrote it
+ * (little-endian on every platform this lib is built for).
+ */
+#define RF24LOG_COLUMNAR_MAGIC "RF24COL"
+/** @brief The version of the columnar log archive layout */
+#define RF24LOG_COLUMNAR_VERSION 1
+/** @brief RF24LogColumnarSegmentHeader::magic ("SEG1") */
+#define RF24LOG_COLUMNAR_SEGMENT_MAGIC 0x31474553
+/** @brief RF24LogColumnarTrailer::magic ("COL1") */
+#define RF24LOG_COLUMNAR_TRAILER_MAGIC 0x314C4F43
+
+/**
+ * @brief The columns of a segment (stored in this order).
+ *
+ * Each column holds 1 value per row:
+ * - @ref RF24LOG_COLUMN_TIME the difference to the previous row's timestamp (a zigzag varint;
+ *   the first row of a segment is relative to 0);
+ * - @ref RF24LOG_COLUMN_LEVEL the level's index in the archive's level dictionary (1 byte);
+ * - @ref RF24LOG_COLUMN_VENDOR the vendorId's index in the vendor dictionary (a varint);
+ * - @ref RF24LOG_COLUMN_FORMAT the message format string's index in the format dictionary (a varint);
+ * - @ref RF24LOG_COLUMN_ARGS the size of the packed arguments (a varint) then the arguments
+ *   (see RF24LogArgList::pack()).
+ */
+enum RF24LogColumnarColumn
+{
+    RF24LOG_COLUMN_TIME,
+    RF24LOG_COLUMN_LEVEL,
+    RF24LOG_COLUMN_VENDOR,
+    RF24LOG_COLUMN_FORMAT,
+    RF24LOG_COLUMN_ARGS,
+    RF24LOG_COLUMNS
+};
+
+/** @brief The start of a columnar log archive */
+struct RF24LogColumnarFileHeader
+{
+    /** @brief @ref RF24LOG_COLUMNAR_MAGIC (null-terminated) */
+    char magic[8];
+    /** @brief @ref RF24LOG_COLUMNAR_VERSION */
+    uint32_t version;
+    uint32_t reserved;
+};
+
+/** @brief The start of a segment (a group of rows), followed by its columns */
+struct RF24LogColumnarSegmentHeader
+{
+    /** @brief @ref RF24LOG_COLUMNAR_SEGMENT_MAGIC */
+    uint32_t magic;
+    /** @brief The number of rows */
+    uint32_t rows;
+    /** @brief The earliest timestamp in the segment */
+    uint64_t firstTime;
+    /** @brief The latest timestamp in the segment */
+    uint64_t lastTime;
+    /** @brief Bit `n` is set if the segment has a row of a level from `n * 8` to `n * 8 + 7` */
+    uint32_t levels;
+    /** @brief The number of bytes of each column (see RF24LogColumnarColumn) */
+    uint32_t columnSize[RF24LOG_COLUMNS];
+};
+
+/** @brief An entry of the segment index */
+struct RF24LogColumnarIndexEntry
+{
+    /** @brief The file offset of the segment's header */
+    uint64_t offset;
+    /** @brief A copy of the segment's header */
+    RF24LogColumnarSegmentHeader header;
+};
+
+/**
+ * @brief The last bytes of an archive.
+ *
+ * It follows the footer: the segment index (RF24LogColumnarTrailer::segmentCount
+ * RF24LogColumnarIndexEntry objects), the level dictionary (1 byte per level), the vendor
+ * dictionary and the format dictionary (null-terminated strings).
+ */
+struct RF24LogColumnarTrailer
+{
+    /** @brief @ref RF24LOG_COLUMNAR_TRAILER_MAGIC */
+    uint32_t magic;
+    uint32_t segmentCount;
+    uint32_t levelCount;
+    uint32_t vendorCount;
+    uint32_t formatCount;
+    uint32_t reserved;
+    /** @brief The file offset of the footer */
+    uint64_t footerOffset;
+    /** @brief The number of bytes of the footer (excluding this trailer) */
+    uint64_t footerSize;
+};
+
+/**
+ * @brief Writes a columnar log archive.
+ *
+ * Rows are buffered in memory and written a segment at a time; the dictionaries and the
+ * segment index are written by close(). This is meant for converting logs (by the
+ * `rf24log-columnar` tool in the repo's tools folder), not for logging: an archive is only
+ * readable once it is closed, and a writer must not be used by several threads at once.
+ */
+class RF24LogColumnarWriter
+{
+public:
+
+    /**
+     * @brief Instance constructor
+     * @param segmentRows The number of rows per segment
+     */
+    RF24LogColumnarWriter(uint32_t segmentRows = 65536);
+
+    /** @brief closes the archive */
+    ~RF24LogColumnarWriter();
+
+    /**
+     * @brief create an archive (replacing an existing file)
+     * @param path The archive's path
+     * @return true if the archive is ready to use
+     */
+    bool open(const char *path);
+
+    /**
+     * @brief add a log message
+     * @param timestamp The time (see rf24LogNow()) at which the message was logged
+     * @param logLevel The level of the logging message
+     * @param vendorId The vendorId
+     * @param message The message format string
+     * @param args The packed arguments (see RF24LogArgList::pack())
+     * @param argsSize The number of bytes of packed arguments
+     * @return false if the archive isn't open or can't be written
+     */
+    bool add(RF24LogTime timestamp, uint8_t logLevel, const char *vendorId, const char *message,
+             const uint8_t *args, uint16_t argsSize);
+
+    /**
+     * @brief write the last segment, the dictionaries and the index, and close the archive
+     * @return false if the archive couldn't be completed
+     */
+    bool close();
+
+    /** @brief the number of rows added since open() */
+    inline uint64_t rows() { return _rows; }
+
+private:
+
+    /** @brief write the rows buffered for the current segment */
+    bool writeSegment();
+
+    /** @brief write all of @p length bytes at the end of the archive */
+    bool append(const void *data, size_t length);
+
+    /** @brief the index of a string in a dictionary (adding it if needed) */
+    static uint32_t lookup(std::unordered_map<std::string, uint32_t> *ids, std::vector<std::string> *strings,
+                           const char *value);
+
+    int _fd;
+    bool _failed;
+    uint64_t _end;
+    uint64_t _rows;
+    uint32_t _segmentRows;
+    std::vector<uint8_t> _columns[RF24LOG_COLUMNS];
+    RF24LogColumnarSegmentHeader _segment;
+    RF24LogTime _previous;
+    std::vector<RF24LogColumnarIndexEntry> _index;
+    /** @brief The level dictionary's index of each level (or -1) */
+    int16_t _levelIds[256];
+    std::vector<uint8_t> _levels;
+    std::unordered_map<std::string, uint32_t> _vendorIds;
+    std::vector<std::string> _vendors;
+    std::unordered_map<std::string, uint32_t> _formatIds;
+    std::vector<std::string> _formats;
+};
+
+/** @brief Group the rows of an aggregation by level */
+#define RF24LOG_GROUP_LEVEL 1
+/** @brief Group the rows of an aggregation by vendorId */
+#define RF24LOG_GROUP_VENDOR 2
+/** @brief Group the rows of an aggregation by message format string */
+#define RF24LOG_GROUP_FORMAT 4
+
+/** @brief The rows to aggregate, and how to group them */
+struct RF24LogColumnarQuery
+{
+    /** @brief Only the rows logged from this time... */
+    RF24LogTime from = 0;
+    /** @brief ...to this time (inclusive) */
+    RF24LogTime to = static_cast<RF24LogTime>(-1);
+    /** @brief Only the rows with a level from this level... */
+    uint8_t minLevel = 0;
+    /** @brief ...to this level (inclusive) */
+    uint8_t maxLevel = 0xFF;
+    /** @brief Only the rows of this vendorId (see RF24LogColumnarArchive::findVendor()), or -1 */
+    long vendor = -1;
+    /** @brief The RF24LOG_GROUP_* flags of the fields to group by */
+    uint8_t groupBy = 0;
+    /** @brief Group the rows by periods of this many microseconds (0 for no time grouping) */
+    RF24LogTime interval = 0;
+};
+
+/** @brief A group of rows counted by RF24LogColumnarArchive::aggregate() */
+struct RF24LogColumnarCount
+{
+    /** @brief The start of the group's period (0 without time grouping) */
+    RF24LogTime time;
+    /** @brief The group's level (0 without @ref RF24LOG_GROUP_LEVEL) */
+    uint8_t logLevel;
+    /** @brief The group's vendorId (see RF24LogColumnarArchive::vendor(); 0 without @ref RF24LOG_GROUP_VENDOR) */
+    uint32_t vendor;
+    /** @brief The group's format string (see RF24LogColumnarArchive::format(); 0 without @ref RF24LOG_GROUP_FORMAT) */
+    uint32_t format;
+    /** @brief The number of rows */
+    uint64_t count;
+};
+
+/** @brief A row read by RF24LogColumnarArchive::readSegment() */
+struct RF24LogColumnarRow
+{
+    /** @brief The time (see rf24LogNow()) at which the message was logged */
+    RF24LogTime timestamp;
+    /** @brief The level of the logging message */
+    uint8_t logLevel;
+    /** @brief The vendorId (see RF24LogColumnarArchive::vendor()) */
+    uint32_t vendor;
+    /** @brief The message format string (see RF24LogColumnarArchive::format()) */
+    uint32_t format;
+    /** @brief The packed arguments (for RF24LogArgList; they point into the mapped archive) */
+    const uint8_t *args;
+    /** @brief The number of bytes of packed arguments */
+    uint16_t argsSize;
+};
+
+/**
+ * @brief Reads a columnar log archive (written by RF24LogColumnarWriter) and aggregates over it.
+ *
+ * The archive is mapped in memory. An aggregation skips the segments outside its time
+ * window or levels (using the segment index), and only decodes the columns that it needs:
+ * counting the rows per level per minute never touches the vendor, format and argument
+ * columns.
+ */
+class RF24LogColumnarArchive
+{
+public:
+
+    RF24LogColumnarArchive();
+    ~RF24LogColumnarArchive();
+
+    /**
+     * @brief open an archive and load its dictionaries and index
+     * @param path The archive's path
+     * @return true if the file is a complete columnar log archive
+     */
+    bool open(const char *path);
+
+    /** @brief close the archive */
+    void close();
+
+    /** @brief the number of rows */
+    uint64_t rows() const;
+
+    /** @brief the number of segments */
+    inline size_t segmentCount() const { return _index.size(); }
+
+    /** @brief the vendorId of a RF24LogColumnarCount::vendor */
+    inline const char *vendor(uint32_t id) const { return id < _vendors.size() ? _vendors[id] : ""; }
+
+    /** @brief the number of vendorIds */
+    inline size_t vendorCount() const { return _vendors.size(); }
+
+    /** @brief the message format string of a RF24LogColumnarCount::format */
+    inline const char *format(uint32_t id) const { return id < _formats.size() ? _formats[id] : ""; }
+
+    /** @brief the number of message format strings */
+    inline size_t formatCount() const { return _formats.size(); }
+
+    /** @brief the index of a vendorId (for RF24LogColumnarQuery::vendor), or -1 if the archive doesn't have it */
+    long findVendor(const char *vendorId) const;
+
+    /**
+     * @brief count the rows that match a query, grouped by its fields
+     * @param query The rows to count and how to group them
+     * @param result Set to the groups (sorted by time, level, vendorId then format string)
+     * @return false if the archive is corrupt
+     */
+    bool aggregate(const RF24LogColumnarQuery &query, std::vector<RF24LogColumnarCount> *result) const;
+
+    /**
+     * @brief decode all the columns of a segment
+     * @param segment The segment's number (less than segmentCount())
+     * @param rows Set to the segment's rows
+     * @return false if the segment is corrupt
+     */
+    bool readSegment(size_t segment, std::vector<RF24LogColumnarRow> *rows) const;
+
+private:
+
+    const char *_data;
+    size_t _size;
+    std::vector<RF24LogColumnarIndexEntry> _index;
+    std::vector<uint8_t> _levels;
+    std::vector<const char *> _vendors;
+    std::vector<const char *> _formats;
+};
+
+#endif // defined (RF24LOG_POSIX)
+#endif /* SRC_RF24LOGPARTS_COLUMNARLOG_H_ */
@@ -12,6 +12,13 @@
  */
 
 #include "Common.h"
+#if defined(ARDUINO)
+#include <Arduino.h> // millis()
+#elif defined(PICO_BUILD)
+#include <pico/stdlib.h> // to_ms_since_boot(), get_absolute_time()
+#else
+#include <chrono> // system_clock
+#endif
 
 /****************************************************************************/
 
@@ -33,3 +40,17 @@ uint16_t numbCharsToPrint(int64_t numb, uint8_t base)
     }
     return i;
 }
+
+/****************************************************************************/
+
+RF24LogTime rf24LogNow()
+{
+#if defined(ARDUINO)
+    return millis();
+#elif defined(PICO_BUILD)
+    return to_ms_since_boot(get_absolute_time());
+#else
+    using namespace std::chrono;
+    return duration_cast<microseconds>(system_clock::now().time_since_epoch()).count();
+#endif
+}
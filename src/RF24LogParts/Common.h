@@ -16,6 +16,30 @@
 
 #include <stdint.h>
 
+#if !defined(ARDUINO) && !defined(PICO_BUILD)
+/** @brief macro (automatically defined) when building for a hosted OS with a C++ standard library. */
+#define RF24LOG_HOSTED
+#if defined(__unix__) || defined(__APPLE__)
+/** @brief macro (automatically defined) when building for a POSIX compliant OS. */
+#define RF24LOG_POSIX
+#endif
+#endif
+
+#if defined(RF24LOG_HOSTED) && defined(__GNUC__)
+/** @brief use the cheapest thread-local storage model for variables accessed on every log call */
+#define RF24LOG_TLS_MODEL __attribute__((tls_model("initial-exec")))
+#else
+#define RF24LOG_TLS_MODEL
+#endif
+
+#if defined(RF24LOG_HOSTED)
+/** @brief A timestamp in microseconds since the Unix epoch. */
+typedef uint64_t RF24LogTime;
+#else
+/** @brief A timestamp in milliseconds since boot. */
+typedef uint32_t RF24LogTime;
+#endif
+
 /**
  * @brief how wide (in characters) does it take to display a number
  * @param numb The number to represent
@@ -23,4 +47,13 @@
  */
 uint16_t numbCharsToPrint(int64_t numb, uint8_t base = 10);
 
+/**
+ * @brief get the current time
+ *
+ * This is safe to call from an interrupt (or POSIX signal) handler.
+ * @return The milliseconds since boot on microcontrollers, or the microseconds
+ * since the Unix epoch on hosted platforms.
+ */
+RF24LogTime rf24LogNow();
+
 #endif /* SRC_RF24ABSTRACT_COMMON_H_ */
@@ -0,0 +1,203 @@
+/**
+ * @file Epoch.cpp
+ * @date Created 19 Oct 2026
+ * @author Brendan Doherty (2bndy5)
+ * @copyright Copyright (C) <br>
+ *      2026        Brendan Doherty (2bndy5) <br>
+ * This General Public License does not permit incorporating your program into
+ * proprietary programs.  If your program is a subroutine library, you may
+ * consider it more useful to permit linking proprietary applications with the
+ * library.  If this is what you want to do, use the GNU Lesser General
+ * Public License instead of this License.
+ */
+
+#include "Epoch.h"
+
+#if defined (RF24LOG_HOSTED)
+#include <mutex>  // std::mutex, std::lock_guard
+#include <thread> // std::this_thread::yield()
+#if defined (RF24LOG_POSIX)
+#include <pthread.h> // pthread_key_create(), pthread_setspecific()
+#endif
+#if defined (__linux__)
+#include <linux/membarrier.h> // MEMBARRIER_CMD_*
+#include <sys/syscall.h>      // __NR_membarrier
+#include <unistd.h>           // syscall()
+#endif
+
+/** @brief can the writers use the process-wide `membarrier()`? (registers the process for it) */
+static bool queryMembarrier()
+{
+#if defined (__linux__)
+    long commands = syscall(__NR_membarrier, MEMBARRIER_CMD_QUERY, 0);
+    return commands > 0
+           && (commands & MEMBARRIER_CMD_PRIVATE_EXPEDITED)
+           && syscall(__NR_membarrier, MEMBARRIER_CMD_REGISTER_PRIVATE_EXPEDITED, 0) == 0;
+#else
+    return false;
+#endif
+}
+
+std::atomic<uint64_t> RF24LogEpoch::s_epoch(1);
+// until this is initialized (before main() runs), readers use a full memory fence
+bool RF24LogEpoch::s_hasMembarrier = queryMembarrier();
+RF24LogEpoch::Reader RF24LogEpoch::s_readers[RF24LOG_EPOCH_READERS];
+std::atomic<uint32_t> RF24LogEpoch::s_sharedReaders(0);
+thread_local uint32_t RF24LogEpoch::t_sharedDepth RF24LOG_TLS_MODEL = 0;
+thread_local RF24LogEpoch::Reader *RF24LogEpoch::t_reader RF24LOG_TLS_MODEL = nullptr;
+
+/** @brief serializes the writers */
+static std::mutex &writerMutex()
+{
+    static std::mutex mutex;
+    return mutex;
+}
+
+/****************************************************************************/
+
+#if defined (RF24LOG_POSIX)
+/** @brief releases a thread's reader record when the thread exits */
+static void releaseReader(void *)
+{
+    RF24LogEpoch::unregisterThread();
+}
+
+/** @brief the thread-specific key whose destructor is releaseReader() */
+static pthread_key_t readerKey;
+
+/** @brief create @ref readerKey */
+static bool createReaderKey()
+{
+    return pthread_key_create(&readerKey, releaseReader) == 0;
+}
+
+/** @brief is @ref readerKey created? (not until this is initialized, before main() runs) */
+static bool hasReaderKey = createReaderKey();
+#else
+/** @brief releases the calling thread's reader record when the thread exits */
+struct RF24LogEpochReaderOwner
+{
+    ~RF24LogEpochReaderOwner()
+    {
+        RF24LogEpoch::unregisterThread();
+    }
+};
+#endif
+
+/****************************************************************************/
+
+/** @brief the process-wide barrier that pairs with the readers' compiler barrier */
+static void writerBarrier(bool hasMembarrier)
+{
+#if defined (__linux__)
+    if (hasMembarrier)
+    {
+        syscall(__NR_membarrier, MEMBARRIER_CMD_PRIVATE_EXPEDITED, 0);
+        return;
+    }
+#endif
+    (void)hasMembarrier;
+    std::atomic_thread_fence(std::memory_order_seq_cst);
+}
+
+/****************************************************************************/
+
+RF24LogEpoch::Reader *RF24LogEpoch::registerThread()
+{
+    if (t_reader != nullptr)
+    {
+        return t_reader;
+    }
+    for (Reader &reader : s_readers)
+    {
+        if (reader.claimed.load(std::memory_order_relaxed) || reader.claimed.exchange(true, std::memory_order_acquire))
+        {
+            continue;
+        }
+        t_reader = &reader;
+#if defined (RF24LOG_POSIX)
+        // (doesn't allocate memory for the first keys of a process, so this is fine in a signal handler)
+        if (hasReaderKey)
+        {
+            pthread_setspecific(readerKey, &reader);
+        }
+#else
+        static thread_local RF24LogEpochReaderOwner owner;
+        (void)owner;
+#endif
+        return &reader;
+    }
+    return nullptr;
+}
+
+/****************************************************************************/
+
+void RF24LogEpoch::unregisterThread()
+{
+    Reader *reader = t_reader;
+    if (reader != nullptr)
+    {
+        t_reader = nullptr;
+        reader->epoch.store(0, std::memory_order_relaxed);
+        reader->claimed.store(false, std::memory_order_release);
+    }
+}
+
+/****************************************************************************/
+
+uint64_t RF24LogEpoch::enterShared()
+{
+    ++t_sharedDepth;
+    s_sharedReaders.fetch_add(1, std::memory_order_relaxed);
+    // order the count before the loads of the protected data (pairs with the writer's barrier)
+    std::atomic_thread_fence(std::memory_order_seq_cst);
+    return RF24LOG_EPOCH_UNREGISTERED;
+}
+
+/****************************************************************************/
+
+void RF24LogEpoch::leaveShared()
+{
+    s_sharedReaders.fetch_sub(1, std::memory_order_release);
+    --t_sharedDepth;
+}
+
+/****************************************************************************/
+
+void RF24LogEpoch::synchronize()
+{
+    std::lock_guard<std::mutex> lock(writerMutex());
+
+    // make the new configuration visible to all readers before sampling their epochs
+    writerBarrier(s_hasMembarrier);
+    uint64_t target = s_epoch.fetch_add(1, std::memory_order_relaxed) + 1;
+
+    for (Reader *reader = s_readers; reader != s_readers + RF24LOG_EPOCH_READERS; ++reader)
+    {
+        if (reader == t_reader)
+        {
+            continue; // a writer can't wait on itself
+        }
+        while (true)
+        {
+            uint64_t epoch = reader->epoch.load(std::memory_order_acquire);
+            if (epoch == 0 || epoch >= target)
+            {
+                break; // not in a critical section, or it began after the new configuration was published
+            }
+            std::this_thread::yield();
+        }
+    }
+
+    // the threads without a reader record can't be told apart: wait until none is reading
+    // (except the calling thread)
+    while (s_sharedReaders.load(std::memory_order_acquire) > t_sharedDepth)
+    {
+        std::this_thread::yield();
+    }
+
+    // order the readers' completed critical sections before the caller reuses the old configuration
+    writerBarrier(s_hasMembarrier);
+}
+
+#endif // defined (RF24LOG_HOSTED)
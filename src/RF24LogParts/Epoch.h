@@ -0,0 +1,170 @@
+/**
+ * @file Epoch.h
+ * @brief epoch-based (RCU-style) protection of the logging configuration
+ * @date Created 19 Oct 2026
+ * @author Brendan Doherty (2bndy5)
+ * @copyright Copyright (C) <br>
+ *      2026        Brendan Doherty (2bndy5) <br>
+ * This General Public License does not permit incorporating your program into
+ * proprietary programs.  If your program is a subroutine library, you may
+ * consider it more useful to permit linking proprietary applications with the
+ * library.  If this is what you want to do, use the GNU Lesser General
+ * Public License instead of this License.
+ */
+
+#ifndef SRC_RF24LOGPARTS_EPOCH_H_
+#define SRC_RF24LOGPARTS_EPOCH_H_
+
+#include "Common.h" // RF24LOG_HOSTED
+
+#if defined (RF24LOG_HOSTED)
+#include <stdint.h>
+#include <atomic>
+
+/**
+ * @brief The number of threads that can hold a reader record at the same time (the size of
+ * the reader array).
+ *
+ * The threads beyond this limit still log, but their critical sections are counted by 1
+ * shared atomic counter (an atomic read-modify-write on a shared cache line per log call),
+ * and synchronize() waits for that count to drop to 0.
+ */
+#ifndef RF24LOG_EPOCH_READERS
+#define RF24LOG_EPOCH_READERS 128
+#endif
+
+/** @brief The token returned by RF24LogEpoch::readLock() when all the reader records are taken */
+#define RF24LOG_EPOCH_UNREGISTERED UINT64_MAX
+
+/**
+ * @brief Epoch-based read-copy-update used to swap the logging configuration while other threads log.
+ *
+ * Readers (the log calls) only do relaxed loads & stores to a per-thread record and a
+ * compiler barrier: no locks and no atomic read-modify-write instructions. Writers
+ * (configuration changes) pay for the synchronization instead: synchronize() issues a
+ * process-wide memory barrier (Linux `membarrier()`) and waits until every thread that
+ * might still use the old configuration has left its read-side critical section.
+ *
+ * Where `membarrier()` is unavailable, readers fall back to a (non read-modify-write)
+ * memory fence.
+ *
+ * The reader records are a static array: a thread claims one with an atomic exchange on its
+ * first log call (which is safe in a signal handler), and releases it when it exits. While
+ * they are all taken, the other threads use a shared reader count instead.
+ */
+class RF24LogEpoch
+{
+public:
+
+    /** @brief The per-thread state of a reader (on its own cache line) */
+    struct Reader
+    {
+        /** @brief The epoch observed when entering the critical section (0 when outside) */
+        alignas(64) std::atomic<uint64_t> epoch;
+        /** @brief Is the record used by a thread? */
+        std::atomic<bool> claimed;
+    };
+
+    /**
+     * @brief enter a read-side critical section.
+     *
+     * A thread claims its reader record on its first call (without locks or allocations, so
+     * that can happen in a signal handler). Critical sections can nest (even from signal
+     * handlers).
+     * @return A token to pass to readUnlock(). It is @ref RF24LOG_EPOCH_UNREGISTERED if every
+     * reader record is taken: then, the critical section is counted by the shared reader
+     * count (see enterShared()).
+     */
+    static inline uint64_t readLock()
+    {
+        Reader *reader = t_reader;
+        if (reader == nullptr)
+        {
+            reader = registerThread();
+            if (reader == nullptr)
+            {
+                return enterShared();
+            }
+        }
+        uint64_t outer = reader->epoch.load(std::memory_order_relaxed);
+        if (outer == 0)
+        {
+            reader->epoch.store(s_epoch.load(std::memory_order_relaxed), std::memory_order_relaxed);
+            readerBarrier();
+        }
+        return outer;
+    }
+
+    /**
+     * @brief leave a read-side critical section.
+     * @param token The value returned from the matching readLock().
+     */
+    static inline void readUnlock(uint64_t token)
+    {
+        if (token == RF24LOG_EPOCH_UNREGISTERED)
+        {
+            leaveShared();
+        }
+        else if (token == 0)
+        {
+            t_reader->epoch.store(0, std::memory_order_release);
+        }
+    }
+
+    /**
+     * @brief wait until every read-side critical section that began before this call has ended.
+     *
+     * Call this after publishing a new configuration, before reusing or destroying the old one.
+     * The calling thread's own critical section (if any) is not waited on.
+     */
+    static void synchronize();
+
+    /**
+     * @brief register the calling thread as a reader (done automatically by readLock()).
+     * @return The thread's reader record, or `nullptr` if they are all taken.
+     */
+    static Reader *registerThread();
+
+    /** @brief release the calling thread's reader record (done automatically when the thread exits). */
+    static void unregisterThread();
+
+private:
+
+    /**
+     * @brief enter a read-side critical section without a reader record (readLock()'s slow path)
+     * @return @ref RF24LOG_EPOCH_UNREGISTERED
+     */
+    static uint64_t enterShared();
+
+    /** @brief leave a critical section entered by enterShared() */
+    static void leaveShared();
+
+    /** @brief order the reader's epoch store before its loads of the protected data */
+    static inline void readerBarrier()
+    {
+        if (s_hasMembarrier)
+        {
+            std::atomic_signal_fence(std::memory_order_seq_cst); // compiler barrier only
+        }
+        else
+        {
+            std::atomic_thread_fence(std::memory_order_seq_cst);
+        }
+    }
+
+    /** @brief The current epoch (only incremented by writers) */
+    static std::atomic<uint64_t> s_epoch;
+    /** @brief Is the process-wide `membarrier()` used by writers? (set before `main()` runs) */
+    static bool s_hasMembarrier;
+    /** @brief The reader records of the threads */
+    static Reader s_readers[RF24LOG_EPOCH_READERS];
+    /** @brief The number of critical sections entered by enterShared() (by all threads) */
+    static std::atomic<uint32_t> s_sharedReaders;
+    /** @brief The number of the calling thread's critical sections in @ref s_sharedReaders */
+    static thread_local uint32_t t_sharedDepth RF24LOG_TLS_MODEL;
+    /** @brief The calling thread's reader record */
+    static thread_local Reader *t_reader RF24LOG_TLS_MODEL;
+};
+
+#endif // defined (RF24LOG_HOSTED)
+#endif /* SRC_RF24LOGPARTS_EPOCH_H_ */
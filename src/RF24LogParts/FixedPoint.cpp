@@ -0,0 +1,162 @@
+/**
+ * @file FixedPoint.cpp
+ * @date Created 19 Oct 2026
+ * @author Brendan Doherty (2bndy5)
+ * @copyright Copyright (C) <br>
+ *      2026        Brendan Doherty (2bndy5) <br>
+ * This General Public License does not permit incorporating your program into
+ * proprietary programs.  If your program is a subroutine library, you may
+ * consider it more useful to permit linking proprietary applications with the
+ * library.  If this is what you want to do, use the GNU Lesser General
+ * Public License instead of this License.
+ */
+
+#include <string.h> // memcpy()
+#include "FixedPoint.h"
+
+/** @brief `10^n` for each supported number of decimal places */
+static const uint32_t powersOf10[RF24LOG_FIXED_PRECISION + 1] = {
+    1UL, 10UL, 100UL, 1000UL, 10000UL, 100000UL, 1000000UL, 10000000UL, 100000000UL, 1000000000UL
+};
+
+/****************************************************************************/
+
+void RF24LogFixed::split(double value, uint8_t decimals)
+{
+    precision = decimals < RF24LOG_FIXED_PRECISION ? decimals : RF24LOG_FIXED_PRECISION;
+    special = RF24LOG_FIXED_NUMBER;
+    integer = 0;
+    fraction = 0;
+
+    // decode the value as mantissa * 2^exponent
+    uint64_t mantissa;
+    int16_t exponent;
+#if __SIZEOF_DOUBLE__ == 4
+    uint32_t bits;
+    memcpy(&bits, &value, sizeof(bits));
+    negative = bits >> 31;
+    uint16_t biased = (uint16_t)((bits >> 23) & 0xFF);
+    mantissa = bits & 0x7FFFFFUL;
+    if (biased == 0xFF)
+    {
+        special = mantissa ? RF24LOG_FIXED_NAN : RF24LOG_FIXED_INF;
+        return;
+    }
+    if (biased)
+    {
+        mantissa |= 0x800000UL;
+        exponent = (int16_t)(biased - 150);
+    }
+    else
+    {
+        exponent = -149; // subnormal
+    }
+#else
+    uint64_t bits;
+    memcpy(&bits, &value, sizeof(bits));
+    negative = bits >> 63;
+    uint16_t biased = (uint16_t)((bits >> 52) & 0x7FF);
+    mantissa = bits & 0xFFFFFFFFFFFFFULL;
+    if (biased == 0x7FF)
+    {
+        special = mantissa ? RF24LOG_FIXED_NAN : RF24LOG_FIXED_INF;
+        return;
+    }
+    if (biased)
+    {
+        mantissa |= 0x10000000000000ULL;
+        exponent = (int16_t)(biased - 1075);
+    }
+    else
+    {
+        exponent = -1074; // subnormal
+    }
+#endif
+
+    if (!mantissa)
+    {
+        return; // zero
+    }
+    if (exponent >= 0)
+    {
+        // no fraction; the integer part needs to fit in 32 bits
+        if (exponent >= 32 || (mantissa >> (32 - exponent)))
+        {
+            special = RF24LOG_FIXED_OVF;
+            return;
+        }
+        integer = (uint32_t)(mantissa << exponent);
+        return;
+    }
+
+    uint16_t shift = (uint16_t)-exponent;
+    if (shift < 64 && (mantissa >> shift) >> 32)
+    {
+        special = RF24LOG_FIXED_OVF;
+        return;
+    }
+
+    // the exact product N = mantissa * 10^precision (less than 2^83), as high:low 64-bit words
+    uint32_t scale = powersOf10[precision];
+    uint64_t low = (mantissa & 0xFFFFFFFFULL) * scale;
+    uint64_t mid = (mantissa >> 32) * scale;
+    uint64_t nLow = low + (mid << 32);
+    uint64_t nHigh = (mid >> 32) + (nLow < low ? 1 : 0);
+
+    // total = N >> shift (the number in units of the last decimal place), and the bits
+    // shifted out (remHigh:remLow) are compared with half of a unit (halfHigh:halfLow)
+    uint64_t total, remHigh, remLow, halfHigh, halfLow;
+    if (shift < 64)
+    {
+        total = (nLow >> shift) | (nHigh << (64 - shift));
+        remHigh = 0;
+        remLow = nLow & ((1ULL << shift) - 1);
+        halfHigh = 0;
+        halfLow = 1ULL << (shift - 1);
+    }
+    else if (shift < 128)
+    {
+        total = nHigh >> (shift - 64);
+        remHigh = shift > 64 ? nHigh & ((1ULL << (shift - 64)) - 1) : 0;
+        remLow = nLow;
+        halfHigh = shift > 64 ? 1ULL << (shift - 65) : 0;
+        halfLow = shift > 64 ? 0 : 1ULL << 63;
+    }
+    else
+    {
+        return; // N is less than half of a unit: it rounds to 0
+    }
+
+    // round to the nearest; a tie rounds to an even last digit (like printf() does)
+    if (remHigh > halfHigh || (remHigh == halfHigh && remLow > halfLow)
+        || (remHigh == halfHigh && remLow == halfLow && (total & 1)))
+    {
+        ++total;
+    }
+    uint64_t whole = total / scale;
+    if (whole >> 32)
+    {
+        special = RF24LOG_FIXED_OVF;
+        return;
+    }
+    integer = (uint32_t)whole;
+    fraction = (uint32_t)(total - whole * scale);
+}
+
+/****************************************************************************/
+
+void RF24LogFixed::split(long scaled, uint8_t decimals)
+{
+    precision = decimals < RF24LOG_FIXED_PRECISION ? decimals : RF24LOG_FIXED_PRECISION;
+    special = RF24LOG_FIXED_NUMBER;
+    negative = scaled < 0;
+    unsigned long magnitude = negative ? 0UL - (unsigned long)scaled : (unsigned long)scaled;
+    unsigned long whole = magnitude / powersOf10[precision];
+    if (sizeof(whole) > 4 && (whole >> 16) >> 16)
+    {
+        special = RF24LOG_FIXED_OVF;
+        return;
+    }
+    integer = (uint32_t)whole;
+    fraction = (uint32_t)(magnitude - whole * powersOf10[precision]);
+}
@@ -0,0 +1,83 @@
+/**
+ * @file FixedPoint.h
+ * @brief Decimal rendering of floating point numbers with integer arithmetic only
+ * @date Created 19 Oct 2026
+ * @author Brendan Doherty (2bndy5)
+ * @copyright Copyright (C) <br>
+ *      2026        Brendan Doherty (2bndy5) <br>
+ * This General Public License does not permit incorporating your program into
+ * proprietary programs.  If your program is a subroutine library, you may
+ * consider it more useful to permit linking proprietary applications with the
+ * library.  If this is what you want to do, use the GNU Lesser General
+ * Public License instead of this License.
+ */
+
+#ifndef SRC_RF24LOGPARTS_FIXEDPOINT_H_
+#define SRC_RF24LOGPARTS_FIXEDPOINT_H_
+
+#include <stdint.h>
+
+#ifdef DOXYGEN_FORCED
+/**
+ * @brief macro (when defined) renders the `%f`, `%F` and `%D` format specifiers with
+ * integer arithmetic only (see RF24LogFixed::split()), instead of the stream's own
+ * floating point output. This is recommended for targets without a FPU (like AVR or
+ * Cortex-M0), where it avoids the soft-float digit loop of `Print::print(double)` and
+ * the large floating point support of `printf()`.
+ */
+#define RF24LOG_FIXED_POINT
+#endif
+
+/** @brief The maximum number of decimal places rendered by RF24LogFixed */
+#define RF24LOG_FIXED_PRECISION 9
+
+/** @brief RF24LogFixed::special value: a finite number that fits */
+#define RF24LOG_FIXED_NUMBER 0
+/** @brief RF24LogFixed::special value: Not a Number (output as `nan`) */
+#define RF24LOG_FIXED_NAN 1
+/** @brief RF24LogFixed::special value: an infinity (output as `inf`) */
+#define RF24LOG_FIXED_INF 2
+/** @brief RF24LogFixed::special value: too large for 32 bits (output as `ovf`) */
+#define RF24LOG_FIXED_OVF 3
+
+/**
+ * @brief A decimal number split into a sign, an integer part and a fraction scaled by a
+ * power of 10.
+ *
+ * The value is `integer + fraction / 10^precision` (negated if @ref negative is true).
+ */
+struct RF24LogFixed
+{
+    /** @brief The sign bit of the number (set for `-0.0`, like `printf()` shows it) */
+    bool negative;
+    /** @brief A finite number (@ref RF24LOG_FIXED_NUMBER) or a special value (like @ref RF24LOG_FIXED_NAN) */
+    uint8_t special;
+    /** @brief The number of decimal places of @ref fraction */
+    uint8_t precision;
+    /** @brief The integer part */
+    uint32_t integer;
+    /** @brief The decimal places, scaled by `10^precision` */
+    uint32_t fraction;
+
+    /**
+     * @brief split a floating point number by decoding its IEEE 754 bits with integer
+     * arithmetic only (no floating point operation is made, so no soft-float code is used).
+     *
+     * The number is rounded to the @p precision like `printf("%.*f")` rounds it (to the
+     * nearest, ties to even, from the exact binary value). Both 32-bit `double` (AVR) and
+     * 64-bit `double` are supported.
+     * @param value The number
+     * @param decimals The number of decimal places (at most @ref RF24LOG_FIXED_PRECISION)
+     */
+    void split(double value, uint8_t decimals);
+
+    /**
+     * @brief split a number that is already stored as a scaled integer (like `12345` for
+     * `123.45` with 2 decimal places)
+     * @param scaled The number multiplied by `10^decimals`
+     * @param decimals The number of decimal places (at most @ref RF24LOG_FIXED_PRECISION)
+     */
+    void split(long scaled, uint8_t decimals);
+};
+
+#endif /* SRC_RF24LOGPARTS_FIXEDPOINT_H_ */
@@ -22,7 +22,11 @@ bool FormatSpecifier::isFlagged(char c)
     {
         fill = '0';
     }
-    return (bool)(c == '-' || c == '+' || c == ' ' || c == '0');
+    else if (c == '#')
+    {
+        alternate = true;
+    }
+    return (bool)(c == '-' || c == '+' || c == ' ' || c == '0' || c == '#');
 }
 
 /****************************************************************************/
@@ -71,6 +75,8 @@ bool FormatSpecifier::isFmtOption(char c)
             c == 'u' ||
             c == 'd' ||
             c == 'i' ||
+            c == 'k' ||
+            c == 'H' ||
             c == 'b')
     {
         if (c == 'u' || c == 'x' || c == 'X' || c == 'o' || c == 'b')
@@ -25,7 +25,7 @@ struct FormatSpecifier
      * @brief Construct a new Specifier Flags object
      * @param pad The default char used when padding data
      */
-    FormatSpecifier(char pad = ' ') : fill(pad), width(0), precis(-1), length(0), specifier(0) {};
+    FormatSpecifier(char pad = ' ') : fill(pad), width(0), precis(-1), length(0), specifier(0), alternate(false) {};
 
     /**
      * @brief is a character a valid specifier flag
@@ -63,6 +63,8 @@ struct FormatSpecifier
     uint8_t length;
     /** @brief datatype specifier */
     char specifier;
+    /** @brief was the `#` flag used (the alternate form, like the ASCII column of a hex dump)? */
+    bool alternate;
 };
 
 #endif /* SRC_RF24LOGPARTS_FORMATSPECIFIER_H_ */
@@ -0,0 +1,216 @@
+/**
+ * @file HeaderPattern.cpp
+ * @date Created 19 Oct 2026
+ * @author Brendan Doherty (2bndy5)
+ * @copyright Copyright (C) <br>
+ *      2026        Brendan Doherty (2bndy5) <br>
+ * This General Public License does not permit incorporating your program into
+ * proprietary programs.  If your program is a subroutine library, you may
+ * consider it more useful to permit linking proprietary applications with the
+ * library.  If this is what you want to do, use the GNU Lesser General
+ * Public License instead of this License.
+ */
+
+#include "HeaderPattern.h"
+
+#if defined (RF24LOG_HOSTED)
+#include <string.h> // strncpy()
+#include <time.h>   // time_t, struct tm, localtime_r(), strftime()
+#include <functional> // std::hash
+#include <thread>     // std::this_thread::get_id()
+#if defined (RF24LOG_POSIX)
+#include <pthread.h>  // pthread_getname_np()
+#include <unistd.h>   // getpid()
+#if defined (__linux__)
+#include <sys/syscall.h> // SYS_gettid
+#endif
+#elif defined (_WIN32)
+#include <process.h>  // _getpid()
+#endif
+
+/** @brief The calling thread's cached ID (0 until it is looked up) and name */
+static thread_local RF24LogThread t_thread RF24LOG_TLS_MODEL = {0, {0}};
+static thread_local bool t_threadNamed RF24LOG_TLS_MODEL = false;
+
+#if defined (RF24LOG_POSIX)
+/** @brief The cached process ID (0 until it is looked up) */
+static std::atomic<uint32_t> s_processId(0);
+
+/** @brief look up the process ID again (in the child of a `fork()`, by its only thread) */
+static void refreshProcessId()
+{
+    s_processId.store((uint32_t)getpid(), std::memory_order_relaxed);
+    t_thread.id = 0; // the thread of the child has its own ID
+}
+
+static const bool s_forkWatched = (refreshProcessId(), pthread_atfork(nullptr, nullptr, refreshProcessId) == 0);
+#endif
+
+/** @brief The calling thread's last rendered date (local time changes once per second) */
+static thread_local time_t t_cachedSecond RF24LOG_TLS_MODEL = -1;
+static thread_local char t_cachedTime[20] RF24LOG_TLS_MODEL;
+#endif
+
+/****************************************************************************/
+
+RF24LogHeaderPattern::RF24LogHeaderPattern(const char *pattern)
+    : count(0), truncated(false), sequence(0)
+{
+    uint8_t used = 0;    // bytes of text
+    bool inText = false; // is the last field a run of text?
+    const char *c = pattern;
+    while (*c && !truncated)
+    {
+        Code code = TEXT;
+        uint8_t width = 0;
+        if (*c == '%')
+        {
+            const char *p = c + 1;
+            while (*p >= '0' && *p <= '9')
+            {
+                width = (uint8_t)(width * 10 + (*p++ - '0'));
+            }
+            switch (*p)
+            {
+                case 'T': code = TIME; break;
+                case 'm': code = MILLIS; break;
+                case 'u': code = MICROS; break;
+                case 'L': code = LEVEL; break;
+                case 'l': code = LEVEL_NUMBER; break;
+                case 'V': code = VENDOR; break;
+                case 't': code = THREAD_ID; break;
+                case 'N': code = THREAD_NAME; break;
+                case 'P': code = PROCESS_ID; break;
+                case 'n': code = SEQUENCE; break;
+                case '%': c = p; break; // "%%" is a literal '%'
+                default: break;         // an unknown specifier is output as it is
+            }
+            if (code != TEXT)
+            {
+                if (count == RF24LOG_HEADER_FIELDS)
+                {
+                    truncated = true;
+                    break;
+                }
+                if (inText)
+                {
+                    ++used; // keep the run's null terminator
+                    inText = false;
+                }
+                fields[count].code = code;
+                fields[count].width = width;
+                fields[count].offset = 0;
+                ++count;
+                c = p + 1;
+                continue;
+            }
+        }
+
+        // append the character to the current run of text
+        if (used + 2 > RF24LOG_HEADER_TEXT_SIZE || (!inText && count == RF24LOG_HEADER_FIELDS))
+        {
+            truncated = true;
+            break;
+        }
+        if (!inText)
+        {
+            fields[count].code = TEXT;
+            fields[count].width = 0;
+            fields[count].offset = used;
+            ++count;
+            inText = true;
+        }
+        text[used++] = *c++;
+        text[used] = 0;
+    }
+}
+
+/****************************************************************************/
+
+uint32_t RF24LogHeaderPattern::nextSequence()
+{
+#if defined (RF24LOG_HOSTED)
+    return sequence.fetch_add(1, std::memory_order_relaxed);
+#else
+    return sequence++;
+#endif
+}
+
+#if defined (RF24LOG_HOSTED)
+
+/****************************************************************************/
+
+void RF24LogHeaderPattern::setThreadName(const char *name)
+{
+    strncpy(t_thread.name, name, sizeof(t_thread.name) - 1);
+    t_thread.name[sizeof(t_thread.name) - 1] = 0;
+    t_threadNamed = true;
+}
+
+/****************************************************************************/
+
+const RF24LogThread *RF24LogHeaderPattern::thisThread()
+{
+    if (!t_thread.id)
+    {
+#if defined (__linux__)
+        t_thread.id = (uint32_t)syscall(SYS_gettid);
+#elif defined (__APPLE__)
+        uint64_t id;
+        pthread_threadid_np(nullptr, &id);
+        t_thread.id = (uint32_t)id;
+#else
+        t_thread.id = (uint32_t)std::hash<std::thread::id>()(std::this_thread::get_id());
+#endif
+    }
+    if (!t_threadNamed)
+    {
+        t_thread.name[0] = 0;
+#if defined (RF24LOG_POSIX)
+        pthread_getname_np(pthread_self(), t_thread.name, sizeof(t_thread.name));
+#endif
+        t_threadNamed = true;
+    }
+    return &t_thread;
+}
+
+/****************************************************************************/
+
+uint32_t RF24LogHeaderPattern::processId()
+{
+#if defined (RF24LOG_POSIX)
+    uint32_t id = s_processId.load(std::memory_order_relaxed);
+    if (!id) // (logged by a static initializer that ran first)
+    {
+        (void)s_forkWatched;
+        id = (uint32_t)getpid();
+    }
+    return id;
+#elif defined (_WIN32)
+    static const uint32_t id = (uint32_t)_getpid();
+    return id;
+#else
+    return 0;
+#endif
+}
+
+/****************************************************************************/
+
+const char *RF24LogHeaderPattern::dateTime(RF24LogTime timestamp)
+{
+    time_t seconds = (time_t)(timestamp / 1000000);
+    if (seconds != t_cachedSecond)
+    {
+        struct tm local;
+#if defined (RF24LOG_POSIX)
+        localtime_r(&seconds, &local);
+#else
+        local = *localtime(&seconds);
+#endif
+        strftime(t_cachedTime, sizeof(t_cachedTime), "%F:%H:%M:%S", &local);
+        t_cachedSecond = seconds;
+    }
+    return t_cachedTime;
+}
+
+#endif // defined (RF24LOG_HOSTED)
@@ -0,0 +1,172 @@
+/**
+ * @file HeaderPattern.h
+ * @brief A configurable layout for the header of each line of a log message
+ * @date Created 19 Oct 2026
+ * @author Brendan Doherty (2bndy5)
+ * @copyright Copyright (C) <br>
+ *      2026        Brendan Doherty (2bndy5) <br>
+ * This General Public License does not permit incorporating your program into
+ * proprietary programs.  If your program is a subroutine library, you may
+ * consider it more useful to permit linking proprietary applications with the
+ * library.  If this is what you want to do, use the GNU Lesser General
+ * Public License instead of this License.
+ */
+
+#ifndef SRC_RF24LOGPARTS_HEADERPATTERN_H_
+#define SRC_RF24LOGPARTS_HEADERPATTERN_H_
+
+#include <stdint.h>
+#include "Common.h" // RF24LOG_HOSTED, RF24LogTime
+#if defined (RF24LOG_HOSTED)
+#include <atomic>
+#endif
+
+/** @brief The maximum number of fields (including the runs of literal text) in a header pattern. */
+#if !defined(RF24LOG_HEADER_FIELDS)
+#define RF24LOG_HEADER_FIELDS 16
+#endif
+
+/** @brief The maximum number of bytes of literal text in a header pattern (including 1 null terminator per run). */
+#if !defined(RF24LOG_HEADER_TEXT_SIZE)
+#define RF24LOG_HEADER_TEXT_SIZE 32
+#endif
+
+#if defined (RF24LOG_HOSTED)
+/** @brief The thread that logged a message (as shown by the `%t` and `%N` fields) */
+struct RF24LogThread
+{
+    /** @brief The thread's ID (see RF24LogHeaderPattern::threadId()) */
+    uint32_t id;
+    /** @brief The thread's name (or an empty string) */
+    char name[16];
+};
+#endif
+
+/**
+ * @brief A header layout that is compiled once into a flat list of fields.
+ *
+ * The pattern is parsed by the constructor, so rendering a header (done by the
+ * RF24LogPrintfParser loggers, see RF24LogPrintfParser::setHeaderPattern()) only walks the
+ * list of fields. The pattern's specifiers are:
+ *
+ * | specifier | field |
+ * |:---------:|-------|
+ * | `%T` | the local date and time (`2026-10-19:10:07:42`), or the milliseconds since boot on microcontrollers |
+ * | `%m` | the milliseconds of the second (3 digits) |
+ * | `%u` | the microseconds of the second (6 digits) |
+ * | `%L` | the description of the log level (like `" INFO  "`) |
+ * | `%l` | the log level as an octal number (3 digits) |
+ * | `%V` | the vendorId |
+ * | `%t` | the ID of the thread that logged the message (the kernel's thread ID on Linux) |
+ * | `%N` | the name of the thread that logged the message (see setThreadName()), or its ID if it has no name |
+ * | `%P` | the process ID |
+ * | `%n` | the sequence number of the log message (counted by the pattern) |
+ * | `%%` | a `%` |
+ *
+ * The numeric fields (`%t`, `%P` and `%n`) take an optional minimum width, like `%6n`.
+ * The thread, process and date fields are only supported on hosted platforms (they render
+ * as `0` or, for the date, the milliseconds since boot elsewhere). For example,
+ * `"%T.%u %L %V [%t] "` renders `2026-10-19:10:07:42.123456  INFO   RF24LogExample [4242] `.
+ *
+ * Messages of level 0 keep the default header (only the vendorId).
+ */
+class RF24LogHeaderPattern
+{
+public:
+
+    /** @brief The kinds of fields */
+    enum Code : uint8_t
+    {
+        TEXT,
+        TIME,
+        MILLIS,
+        MICROS,
+        LEVEL,
+        LEVEL_NUMBER,
+        VENDOR,
+        THREAD_ID,
+        THREAD_NAME,
+        PROCESS_ID,
+        SEQUENCE
+    };
+
+    /** @brief A compiled field */
+    struct Field
+    {
+        /** @brief What the field renders */
+        Code code;
+        /** @brief The minimum width of a numeric field */
+        uint8_t width;
+        /** @brief The offset of a @ref TEXT field's null-terminated text in @ref text */
+        uint8_t offset;
+    };
+
+    /**
+     * @brief compile a header pattern
+     * @param pattern The layout of the header (see the table above). Unknown specifiers are
+     * output as they are. A pattern that doesn't fit in @ref RF24LOG_HEADER_FIELDS fields or
+     * @ref RF24LOG_HEADER_TEXT_SIZE bytes of text is truncated (see isTruncated()).
+     */
+    RF24LogHeaderPattern(const char *pattern);
+
+    /** @brief did the pattern not fit in the compiled fields? */
+    bool isTruncated() const { return truncated; }
+
+    /** @brief take the sequence number of the next log message */
+    uint32_t nextSequence();
+
+    /** @brief The compiled fields */
+    Field fields[RF24LOG_HEADER_FIELDS];
+    /** @brief The number of @ref fields */
+    uint8_t count;
+    /** @brief The literal text of the @ref TEXT fields */
+    char text[RF24LOG_HEADER_TEXT_SIZE];
+
+#if defined (RF24LOG_HOSTED)
+    /**
+     * @brief name the calling thread for the `%N` field.
+     *
+     * The name is kept by the thread (so it is not looked up per log message); on POSIX
+     * platforms a thread that has not been named by this function uses the name given to
+     * it with `pthread_setname_np()`, as read at its first log message.
+     * @param name The thread's name (truncated to 15 characters)
+     */
+    static void setThreadName(const char *name);
+
+    /**
+     * @brief the calling thread's ID and name (looked up once per thread).
+     *
+     * A captured message keeps a copy (see RF24LogRecord::thread), so the fields show the
+     * thread that logged it, not the thread that formats it.
+     */
+    static const RF24LogThread *thisThread();
+
+    /** @brief the calling thread's ID (looked up once per thread) */
+    static uint32_t threadId() { return thisThread()->id; }
+
+    /** @brief the calling thread's name (or an empty string) */
+    static const char *threadName() { return thisThread()->name; }
+
+    /** @brief the ID of the process (looked up again in the child of a `fork()`) */
+    static uint32_t processId();
+
+    /**
+     * @brief the local date and time of a timestamp as `YYYY-MM-DD:HH:MM:SS`.
+     *
+     * The text is kept per thread, and is only rebuilt when the second changes.
+     * @param timestamp The time (see rf24LogNow())
+     */
+    static const char *dateTime(RF24LogTime timestamp);
+#endif
+
+private:
+
+    bool truncated;
+#if defined (RF24LOG_HOSTED)
+    std::atomic<uint32_t> sequence;
+#else
+    uint32_t sequence;
+#endif
+};
+
+#endif /* SRC_RF24LOGPARTS_HEADERPATTERN_H_ */
@@ -0,0 +1,320 @@
+/**
+ * @file IndexedLog.cpp
+ * @date Created 19 Oct 2026
+ * @author Brendan Doherty (2bndy5)
+ * @copyright Copyright (C) <br>
+ *      2026        Brendan Doherty (2bndy5) <br>
+ * This General Public License does not permit incorporating your program into
+ * proprietary programs.  If your program is a subroutine library, you may
+ * consider it more useful to permit linking proprietary applications with the
+ * library.  If this is what you want to do, use the GNU Lesser General
+ * Public License instead of this License.
+ */
+
+#include "IndexedLog.h"
+
+#if defined (RF24LOG_POSIX)
+#include <fcntl.h>    // open(), O_RDONLY
+#include <string.h>   // memcpy(), memcmp(), strcmp(), strlen()
+#include <sys/stat.h> // fstat()
+#include <unistd.h>   // pread(), close()
+
+/****************************************************************************/
+
+void RF24LogIndexedBlockInfo::clear()
+{
+    memset(this, 0, sizeof(*this));
+}
+
+/****************************************************************************/
+
+void RF24LogIndexedBlockInfo::add(uint64_t timestamp, uint8_t logLevel, uint64_t vendorHash)
+{
+    if (records == 0 || timestamp < firstTime)
+    {
+        firstTime = timestamp;
+    }
+    if (records == 0 || timestamp > lastTime)
+    {
+        lastTime = timestamp;
+    }
+    ++records;
+    levels |= 1UL << (logLevel >> 3);
+    for (uint8_t i = 0; i < 3; ++i)
+    {
+        uint8_t bit = (uint8_t)(vendorHash >> (i * 16));
+        vendors[bit >> 6] |= 1ULL << (bit & 63);
+    }
+}
+
+/****************************************************************************/
+
+bool RF24LogIndexedBlockInfo::mayHaveVendor(uint64_t vendorHash) const
+{
+    for (uint8_t i = 0; i < 3; ++i)
+    {
+        uint8_t bit = (uint8_t)(vendorHash >> (i * 16));
+        if (!(vendors[bit >> 6] & (1ULL << (bit & 63))))
+        {
+            return false;
+        }
+    }
+    return true;
+}
+
+/****************************************************************************/
+
+uint64_t RF24LogIndexedBlockInfo::hashVendor(const char *vendorId, size_t length)
+{
+    // FNV-1a
+    uint64_t hash = 14695981039346656037ULL;
+    for (size_t i = 0; i < length; ++i)
+    {
+        hash = (hash ^ (uint8_t)vendorId[i]) * 1099511628211ULL;
+    }
+    return hash;
+}
+
+/****************************************************************************/
+
+uint32_t RF24LogIndexedBlockInfo::levelMask(uint8_t minLevel, uint8_t maxLevel)
+{
+    uint32_t mask = 0;
+    for (uint8_t group = minLevel >> 3; group <= maxLevel >> 3 && minLevel <= maxLevel; ++group)
+    {
+        mask |= 1UL << group;
+        if (group == 31)
+        {
+            break;
+        }
+    }
+    return mask;
+}
+
+/****************************************************************************/
+
+RF24LogIndexedReader::RF24LogIndexedReader()
+{
+    _fd = -1;
+    _from = 0;
+    _to = (RF24LogTime)-1;
+    _minLevel = 0;
+    _maxLevel = 0xFF;
+    _vendorHash = 0;
+    rewind();
+}
+
+/****************************************************************************/
+
+RF24LogIndexedReader::~RF24LogIndexedReader()
+{
+    close();
+}
+
+/****************************************************************************/
+
+bool RF24LogIndexedReader::readIndex(int fd, std::vector<RF24LogIndexedIndexEntry> *index, uint64_t *end)
+{
+    index->clear();
+    struct stat info;
+    RF24LogIndexedFileHeader header;
+    if (fstat(fd, &info) != 0
+        || pread(fd, &header, sizeof(header), 0) != (ssize_t)sizeof(header)
+        || memcmp(header.magic, RF24LOG_INDEXED_MAGIC, sizeof(RF24LOG_INDEXED_MAGIC)) != 0
+        || header.version != RF24LOG_INDEXED_VERSION)
+    {
+        return false;
+    }
+    uint64_t size = (uint64_t)info.st_size;
+
+    // a closed file ends with its index
+    RF24LogIndexedTrailer trailer;
+    if (size >= sizeof(header) + sizeof(trailer)
+        && pread(fd, &trailer, sizeof(trailer), (off_t)(size - sizeof(trailer))) == (ssize_t)sizeof(trailer)
+        && trailer.magic == RF24LOG_INDEXED_TRAILER_MAGIC
+        && trailer.indexOffset + (uint64_t)trailer.blockCount * sizeof(RF24LogIndexedIndexEntry) + sizeof(trailer) == size)
+    {
+        index->resize(trailer.blockCount);
+        size_t bytes = trailer.blockCount * sizeof(RF24LogIndexedIndexEntry);
+        if (pread(fd, index->data(), bytes, (off_t)trailer.indexOffset) == (ssize_t)bytes)
+        {
+            *end = trailer.indexOffset;
+            return true;
+        }
+        index->clear();
+    }
+
+    // otherwise (its writer didn't close it), hop from block header to block header
+    uint64_t offset = sizeof(header);
+    RF24LogIndexedBlockHeader block;
+    while (offset + sizeof(block) <= size
+           && pread(fd, &block, sizeof(block), (off_t)offset) == (ssize_t)sizeof(block)
+           && block.magic == RF24LOG_INDEXED_BLOCK_MAGIC
+           && offset + sizeof(block) + block.dataSize <= size)
+    {
+        index->push_back({offset, block.info});
+        offset += sizeof(block) + block.dataSize;
+    }
+    *end = offset;
+    return true;
+}
+
+/****************************************************************************/
+
+bool RF24LogIndexedReader::open(const char *path)
+{
+    close();
+    _fd = ::open(path, O_RDONLY | O_CLOEXEC);
+    if (_fd < 0)
+    {
+        return false;
+    }
+    uint64_t end;
+    if (!readIndex(_fd, &_index, &end))
+    {
+        close();
+        return false;
+    }
+    rewind();
+    return true;
+}
+
+/****************************************************************************/
+
+void RF24LogIndexedReader::close()
+{
+    if (_fd >= 0)
+    {
+        ::close(_fd);
+        _fd = -1;
+    }
+    _index.clear();
+    rewind();
+}
+
+/****************************************************************************/
+
+void RF24LogIndexedReader::setTimeRange(RF24LogTime from, RF24LogTime to)
+{
+    _from = from;
+    _to = to;
+}
+
+/****************************************************************************/
+
+void RF24LogIndexedReader::setLevelRange(uint8_t minLevel, uint8_t maxLevel)
+{
+    _minLevel = minLevel;
+    _maxLevel = maxLevel;
+}
+
+/****************************************************************************/
+
+void RF24LogIndexedReader::setVendor(const char *vendorId)
+{
+    _vendor.clear();
+    if (vendorId != nullptr)
+    {
+        size_t length = strlen(vendorId);
+        _vendor.assign(vendorId, vendorId + length + 1);
+        _vendorHash = RF24LogIndexedBlockInfo::hashVendor(vendorId, length);
+    }
+}
+
+/****************************************************************************/
+
+void RF24LogIndexedReader::rewind()
+{
+    _block.clear();
+    _nextBlock = 0;
+    _position = 0;
+    _blocksRead = 0;
+    _blocksSkipped = 0;
+}
+
+/****************************************************************************/
+
+bool RF24LogIndexedReader::loadBlock()
+{
+    uint32_t levels = RF24LogIndexedBlockInfo::levelMask(_minLevel, _maxLevel);
+    while (_nextBlock < _index.size())
+    {
+        const RF24LogIndexedIndexEntry &entry = _index[_nextBlock++];
+        if (!entry.info.overlaps(_from, _to)
+            || !entry.info.hasLevels(levels)
+            || (!_vendor.empty() && !entry.info.mayHaveVendor(_vendorHash)))
+        {
+            ++_blocksSkipped;
+            continue;
+        }
+        RF24LogIndexedBlockHeader header;
+        if (pread(_fd, &header, sizeof(header), (off_t)entry.offset) != (ssize_t)sizeof(header)
+            || header.magic != RF24LOG_INDEXED_BLOCK_MAGIC)
+        {
+            continue;
+        }
+        _block.resize(header.dataSize);
+        if (pread(_fd, _block.data(), header.dataSize, (off_t)(entry.offset + sizeof(header))) != (ssize_t)header.dataSize)
+        {
+            continue;
+        }
+        ++_blocksRead;
+        _position = 0;
+        return true;
+    }
+    _block.clear();
+    return false;
+}
+
+/****************************************************************************/
+
+bool RF24LogIndexedReader::parseRecord(const char *data, size_t size, size_t *position, RF24LogIndexedMessage *message)
+{
+    RF24LogIndexedRecord record;
+    if (*position + sizeof(record) > size)
+    {
+        return false;
+    }
+    memcpy(&record, data + *position, sizeof(record));
+    size_t length = sizeof(record) + record.vendorLength + record.messageLength + 2 + record.argsSize;
+    if (*position + length > size)
+    {
+        return false;
+    }
+    const char *vendorId = data + *position + sizeof(record);
+    message->timestamp = (RF24LogTime)record.timestamp;
+    message->logLevel = record.logLevel;
+    message->flags = record.flags;
+    message->vendorId = vendorId;
+    message->message = vendorId + record.vendorLength + 1;
+    message->args = reinterpret_cast<const uint8_t *>(message->message + record.messageLength + 1);
+    message->argsSize = record.argsSize;
+    *position += length;
+    return true;
+}
+
+/****************************************************************************/
+
+bool RF24LogIndexedReader::next(RF24LogIndexedMessage *message)
+{
+    while (true)
+    {
+        if (!parseRecord(_block.data(), _block.size(), &_position, message))
+        {
+            if (!loadBlock())
+            {
+                return false;
+            }
+            continue;
+        }
+        if (message->timestamp < _from || message->timestamp > _to
+            || message->logLevel < _minLevel || message->logLevel > _maxLevel
+            || (!_vendor.empty() && strcmp(message->vendorId, _vendor.data()) != 0))
+        {
+            continue;
+        }
+        return true;
+    }
+}
+
+#endif // defined (RF24LOG_POSIX)
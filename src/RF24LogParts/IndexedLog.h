@@ -0,0 +1,259 @@
+/**
+ * @file IndexedLog.h
+ * @brief A binary log file made of blocks with a sparse index (and its reader)
+ * @date Created 19 Oct 2026
+ * @author Brendan Doherty (2bndy5)
+ * @copyright Copyright (C) <br>
+ *      2026        Brendan Doherty (2bndy5) <br>
+ * This General Public License does not permit incorporating your program into
+ * proprietary programs.  If your program is a subroutine library, you may
+ * consider it more useful to permit linking proprietary applications with the
+ * library.  If this is what you want to do, use the GNU Lesser General
+ * Public License instead of this License.
+ */
+
+#ifndef SRC_RF24LOGPARTS_INDEXEDLOG_H_
+#define SRC_RF24LOGPARTS_INDEXEDLOG_H_
+
+#include "Common.h" // RF24LOG_POSIX, RF24LogTime
+
+#if defined (RF24LOG_POSIX)
+#include <stddef.h>
+#include <stdint.h>
+#include <vector>
+
+/**
+ * @brief The first bytes of an indexed log file.
+ *
+ * All the numbers in the file use the byte order of the machine that wrote it
+ * (little-endian on every platform this lib is built for).
+ */
+#define RF24LOG_INDEXED_MAGIC "RF24IDX"
+/** @brief The version of the indexed log file layout */
+#define RF24LOG_INDEXED_VERSION 1
+/** @brief RF24LogIndexedBlockHeader::magic ("BLK1") */
+#define RF24LOG_INDEXED_BLOCK_MAGIC 0x314B4C42
+/** @brief RF24LogIndexedTrailer::magic ("IDX1") */
+#define RF24LOG_INDEXED_TRAILER_MAGIC 0x31584449
+
+/** @brief The start of an indexed log file */
+struct RF24LogIndexedFileHeader
+{
+    /** @brief @ref RF24LOG_INDEXED_MAGIC (null-terminated) */
+    char magic[8];
+    /** @brief @ref RF24LOG_INDEXED_VERSION */
+    uint32_t version;
+    uint32_t reserved;
+};
+
+/** @brief What a block holds (stored in the block's header and in the file's index) */
+struct RF24LogIndexedBlockInfo
+{
+    /** @brief The earliest timestamp in the block */
+    uint64_t firstTime;
+    /** @brief The latest timestamp in the block */
+    uint64_t lastTime;
+    /** @brief A bloom filter of the vendorIds in the block (3 bits per vendorId) */
+    uint64_t vendors[4];
+    /** @brief Bit `n` is set if the block has a message of a level from `n * 8` to `n * 8 + 7` */
+    uint32_t levels;
+    /** @brief The number of records in the block */
+    uint32_t records;
+
+    /** @brief start an empty block */
+    void clear();
+
+    /** @brief add a record's summary */
+    void add(uint64_t timestamp, uint8_t logLevel, uint64_t vendorHash);
+
+    /** @brief does the block overlap a time window (inclusive)? */
+    inline bool overlaps(uint64_t from, uint64_t to) const { return records && firstTime <= to && lastTime >= from; }
+
+    /** @brief may the block have a message of a level in @p mask (see levelMask())? */
+    inline bool hasLevels(uint32_t mask) const { return (levels & mask) != 0; }
+
+    /** @brief may the block have messages of a vendorId (false positives are possible)? */
+    bool mayHaveVendor(uint64_t vendorHash) const;
+
+    /** @brief the hash of a vendorId used by the bloom filter */
+    static uint64_t hashVendor(const char *vendorId, size_t length);
+
+    /** @brief the @ref levels bits of the levels from @p minLevel to @p maxLevel */
+    static uint32_t levelMask(uint8_t minLevel, uint8_t maxLevel);
+};
+
+/** @brief The start of a block (followed by RF24LogIndexedBlockHeader::dataSize bytes of records) */
+struct RF24LogIndexedBlockHeader
+{
+    /** @brief @ref RF24LOG_INDEXED_BLOCK_MAGIC */
+    uint32_t magic;
+    /** @brief The number of bytes of records */
+    uint32_t dataSize;
+    /** @brief The block's summary */
+    RF24LogIndexedBlockInfo info;
+};
+
+/**
+ * @brief A stored log message (at any byte offset of a block's data).
+ *
+ * This is followed by the null-terminated vendorId, the null-terminated message, and the
+ * packed arguments (see RF24LogArgList::pack()).
+ */
+struct RF24LogIndexedRecord
+{
+    /** @brief The time (see rf24LogNow()) at which the message was logged */
+    uint64_t timestamp;
+    /** @brief The level of the logging message */
+    uint8_t logLevel;
+    /** @brief Copied from RF24LogRecord::flags */
+    uint8_t flags;
+    /** @brief The length of the vendorId (excluding the null terminator) */
+    uint16_t vendorLength;
+    /** @brief The length of the message (excluding the null terminator) */
+    uint16_t messageLength;
+    /** @brief The number of bytes of packed arguments */
+    uint16_t argsSize;
+};
+
+/** @brief An entry of the index that closes a file */
+struct RF24LogIndexedIndexEntry
+{
+    /** @brief The file offset of the block's header */
+    uint64_t offset;
+    /** @brief The block's summary */
+    RF24LogIndexedBlockInfo info;
+};
+
+/**
+ * @brief The last bytes of a closed file.
+ *
+ * The index (RF24LogIndexedTrailer::blockCount RF24LogIndexedIndexEntry objects) is
+ * stored right before this. A file without it (its writer crashed) is indexed by reading
+ * each block's header.
+ */
+struct RF24LogIndexedTrailer
+{
+    /** @brief @ref RF24LOG_INDEXED_TRAILER_MAGIC */
+    uint32_t magic;
+    /** @brief The number of blocks */
+    uint32_t blockCount;
+    /** @brief The file offset of the index (the end of the last block) */
+    uint64_t indexOffset;
+};
+
+/** @brief A log message read by RF24LogIndexedReader */
+struct RF24LogIndexedMessage
+{
+    /** @brief The time (see rf24LogNow()) at which the message was logged */
+    RF24LogTime timestamp;
+    /** @brief The level of the logging message */
+    uint8_t logLevel;
+    /** @brief Copied from RF24LogRecord::flags */
+    uint8_t flags;
+    /** @brief The vendorId */
+    const char *vendorId;
+    /** @brief The message format string */
+    const char *message;
+    /** @brief The packed arguments (for RF24LogArgList) */
+    const uint8_t *args;
+    /** @brief The number of bytes of packed arguments */
+    uint16_t argsSize;
+};
+
+/**
+ * @brief Reads the messages of an indexed log file (written by RF24LogIndexedHandler) that
+ * match a time window, a range of levels and a vendorId.
+ *
+ * The filters are first applied to the file's index, so only the blocks that may have
+ * matching messages are read from the file.
+ */
+class RF24LogIndexedReader
+{
+public:
+
+    RF24LogIndexedReader();
+    ~RF24LogIndexedReader();
+
+    /**
+     * @brief open a file and load its index
+     * @param path The file's path
+     * @return true if the file is an indexed log file
+     */
+    bool open(const char *path);
+
+    /** @brief close the file */
+    void close();
+
+    /** @brief only read the messages logged from @p from to @p to (inclusive) */
+    void setTimeRange(RF24LogTime from, RF24LogTime to);
+
+    /** @brief only read the messages with a level from @p minLevel to @p maxLevel (inclusive) */
+    void setLevelRange(uint8_t minLevel, uint8_t maxLevel);
+
+    /** @brief only read the messages of a vendorId (nullptr for all vendorIds) */
+    void setVendor(const char *vendorId);
+
+    /** @brief start reading from the first block again (after changing the filters) */
+    void rewind();
+
+    /**
+     * @brief get the next matching message
+     * @param message Set to the message; its pointers stay valid until the next call
+     * @return false when there are no more matching messages
+     */
+    bool next(RF24LogIndexedMessage *message);
+
+    /** @brief the number of blocks in the file */
+    inline size_t blockCount() { return _index.size(); }
+
+    /** @brief the number of blocks read since the last rewind() */
+    inline size_t blocksRead() { return _blocksRead; }
+
+    /** @brief the number of blocks skipped (thanks to the index) since the last rewind() */
+    inline size_t blocksSkipped() { return _blocksSkipped; }
+
+    /**
+     * @brief load the index of an indexed log file
+     * @param fd The open file
+     * @param index Set to the blocks' summaries
+     * @param end Set to the end of the last complete block
+     * @return false if the file isn't an indexed log file
+     */
+    static bool readIndex(int fd, std::vector<RF24LogIndexedIndexEntry> *index, uint64_t *end);
+
+    /**
+     * @brief decode the message at a position of a block's data
+     * @param data The block's data (the bytes after its RF24LogIndexedBlockHeader)
+     * @param size The number of bytes in @p data
+     * @param position The offset of the message; moved to the next message
+     * @param message Set to the message (its pointers point into @p data)
+     * @return false at the end of the data (or if the rest of the data is corrupt)
+     */
+    static bool parseRecord(const char *data, size_t size, size_t *position, RF24LogIndexedMessage *message);
+
+private:
+
+    /** @brief read the next block that may match the filters; false at the end of the file */
+    bool loadBlock();
+
+    int _fd;
+    std::vector<RF24LogIndexedIndexEntry> _index;
+    std::vector<char> _block;
+    /** @brief The next index entry to consider */
+    size_t _nextBlock;
+    /** @brief The read position in @ref _block */
+    size_t _position;
+    size_t _blocksRead;
+    size_t _blocksSkipped;
+
+    RF24LogTime _from;
+    RF24LogTime _to;
+    uint8_t _minLevel;
+    uint8_t _maxLevel;
+    /** @brief The vendorId filter (empty for all vendorIds) */
+    std::vector<char> _vendor;
+    uint64_t _vendorHash;
+};
+
+#endif // defined (RF24LOG_POSIX)
+#endif /* SRC_RF24LOGPARTS_INDEXEDLOG_H_ */
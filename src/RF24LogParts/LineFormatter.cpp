@@ -0,0 +1,279 @@
+/**
+ * @file LineFormatter.cpp
+ * @date Created 19 Oct 2026
+ * @author Brendan Doherty (2bndy5)
+ * @copyright Copyright (C) <br>
+ *      2026        Brendan Doherty (2bndy5) <br>
+ * This General Public License does not permit incorporating your program into
+ * proprietary programs.  If your program is a subroutine library, you may
+ * consider it more useful to permit linking proprietary applications with the
+ * library.  If this is what you want to do, use the GNU Lesser General
+ * Public License instead of this License.
+ */
+
+#include "LineFormatter.h"
+
+#if defined (RF24LOG_HOSTED)
+#include <stdio.h> // snprintf()
+#include <time.h>  // time_t, struct tm, localtime_r(), strftime()
+#include "Profiler.h" // RF24LogProfiler (when RF24LOG_PROFILE is defined)
+
+/** @brief The buffer being filled by the calling thread */
+struct RF24LogLine
+{
+    char *data;
+    size_t size;
+    size_t length;
+    bool truncated;
+    RF24LogTime timestamp;
+    /** @brief The thread shown in the header (`nullptr` for the calling thread) */
+    const RF24LogThread *thread;
+    /** @brief Is the header's sequence number given by the caller? */
+    bool sequenced;
+    uint32_t sequence;
+};
+
+static thread_local RF24LogLine *t_line RF24LOG_TLS_MODEL = nullptr;
+
+/** @brief The calling thread's last rendered timestamp (local time changes once per second) */
+static thread_local time_t t_cachedSecond RF24LOG_TLS_MODEL = -1;
+static thread_local char t_cachedTime[20] RF24LOG_TLS_MODEL;
+
+/****************************************************************************/
+
+/** @brief append bytes to the calling thread's buffer */
+static inline void put(const char *data, size_t length)
+{
+    RF24LogLine *line = t_line;
+    size_t room = line->size - line->length;
+    if (length > room)
+    {
+        length = room;
+        line->truncated = true;
+    }
+    memcpy(line->data + line->length, data, length);
+    line->length += length;
+}
+
+/****************************************************************************/
+
+size_t RF24LogLineFormatter::format(char *buffer, size_t size,
+                                    uint8_t logLevel,
+                                    const char *vendorId,
+                                    const char *message,
+                                    RF24LogArgList *args,
+                                    RF24LogTime timestamp,
+                                    const RF24LogThread *thread)
+{
+    RF24LogLine line = {buffer, size, 0, false, timestamp, thread, false, 0};
+    return format(&line, logLevel, vendorId, message, args);
+}
+
+/****************************************************************************/
+
+size_t RF24LogLineFormatter::format(char *buffer, size_t size,
+                                    uint8_t logLevel,
+                                    const char *vendorId,
+                                    const char *message,
+                                    RF24LogArgList *args,
+                                    RF24LogTime timestamp,
+                                    uint32_t sequence,
+                                    const RF24LogThread *thread)
+{
+    RF24LogLine line = {buffer, size, 0, false, timestamp, thread, true, sequence};
+    return format(&line, logLevel, vendorId, message, args);
+}
+
+/****************************************************************************/
+
+size_t RF24LogLineFormatter::format(RF24LogLine *line,
+                                    uint8_t logLevel,
+                                    const char *vendorId,
+                                    const char *message,
+                                    RF24LogArgList *args)
+{
+    RF24LogLine *outer = t_line; // a signal handler may log while this thread is formatting
+    t_line = line;
+    RF24LogPrintfParser::write(logLevel, vendorId, message, args);
+    t_line = outer;
+#if !defined (RF24LOG_NO_EOL)
+    if (line->truncated && line->length)
+    {
+        line->data[line->length - 1] = '\n';
+    }
+#endif
+    return line->length;
+}
+
+/****************************************************************************/
+
+void RF24LogLineFormatter::write(uint8_t logLevel,
+                                 const char *vendorId,
+                                 const char *message,
+                                 va_list *args)
+{
+#if defined (RF24LOG_PROFILE)
+    RF24LogProfiler::Format profile(logLevel, vendorId, message);
+#endif
+    char buffer[RF24LOG_LINE_SIZE];
+    RF24LogArgList argList(args);
+    size_t length = format(buffer, sizeof(buffer), logLevel, vendorId, message, &argList, rf24LogNow());
+    RF24LOG_PROFILE_SINK();
+    writeLine(buffer, length, logLevel);
+#if defined (RF24LOG_STACK_TRACES)
+    if (RF24LogStackTrace::isCaptured(logLevel))
+    {
+        // the message is output at once, so is its stack trace
+        RF24LogStackTrace stack;
+        stack.capture();
+        writeStackTrace(&stack, logLevel);
+    }
+#endif
+}
+
+/****************************************************************************/
+
+void RF24LogLineFormatter::logRecord(const RF24LogRecord *record)
+{
+    if (!isLevelEnabled(record->logLevel) && !(record->flags & RF24LOG_RECORD_FORCED))
+    {
+        return;
+    }
+#if defined (RF24LOG_PROFILE)
+    RF24LogProfiler::Format profile(record->logLevel, record->vendorId, record->message);
+#endif
+    char buffer[RF24LOG_LINE_SIZE];
+    RF24LogArgList argList(record->args, record->argsSize);
+    size_t length = format(buffer, sizeof(buffer), record->logLevel, record->vendorId, record->message,
+                           &argList, record->timestamp, &record->thread);
+    RF24LOG_PROFILE_SINK();
+    writeLine(buffer, length, record->logLevel);
+#if defined (RF24LOG_STACK_TRACES)
+    if (record->flags & RF24LOG_RECORD_STACK)
+    {
+        // the trace is symbolized here, by the thread that outputs the message
+        writeStackTrace(&record->stack, record->logLevel);
+    }
+#endif
+}
+
+/****************************************************************************/
+
+#if defined (RF24LOG_STACK_TRACES)
+void RF24LogLineFormatter::writeStackTrace(const RF24LogStackTrace *stack, uint8_t logLevel)
+{
+    char trace[RF24LOG_STACK_TEXT_SIZE];
+    size_t length = stack->format(trace, sizeof(trace));
+    if (length)
+    {
+        writeLine(trace, length, logLevel);
+    }
+}
+#endif
+
+/****************************************************************************/
+
+void RF24LogLineFormatter::appendTimestamp()
+{
+    // the same format as the other loggers: "%F:%H:%M:%S"
+    time_t seconds = (time_t)(t_line->timestamp / 1000000);
+    if (seconds != t_cachedSecond)
+    {
+        struct tm local;
+        localtime_r(&seconds, &local);
+        strftime(t_cachedTime, sizeof(t_cachedTime), "%F:%H:%M:%S", &local);
+        t_cachedSecond = seconds;
+    }
+    put(t_cachedTime, 19);
+    appendChar(RF24LOG_DELIMITER);
+}
+
+/****************************************************************************/
+
+RF24LogTime RF24LogLineFormatter::headerTime()
+{
+    return t_line->timestamp;
+}
+
+/****************************************************************************/
+
+const RF24LogThread *RF24LogLineFormatter::headerThread()
+{
+    return t_line->thread ? t_line->thread : RF24LogHeaderPattern::thisThread();
+}
+
+/****************************************************************************/
+
+uint32_t RF24LogLineFormatter::headerSequence(RF24LogHeaderPattern *pattern)
+{
+    return t_line->sequenced ? t_line->sequence : pattern->nextSequence();
+}
+
+/****************************************************************************/
+
+void RF24LogLineFormatter::appendChar(char data, uint16_t depth)
+{
+    RF24LogLine *line = t_line;
+    while (depth > 0)
+    {
+        --depth;
+        if (line->length == line->size)
+        {
+            line->truncated = true;
+            return;
+        }
+        line->data[line->length++] = data;
+    }
+}
+
+/****************************************************************************/
+
+void RF24LogLineFormatter::appendInt(long data)
+{
+    if (data < 0)
+    {
+        appendChar('-');
+        appendUInt(0UL - (unsigned long)data);
+    }
+    else
+    {
+        appendUInt((unsigned long)data);
+    }
+}
+
+/****************************************************************************/
+
+void RF24LogLineFormatter::appendUInt(unsigned long data, uint8_t base)
+{
+    char buffer[sizeof(unsigned long) * 8];
+    uint8_t index = sizeof(buffer);
+    do
+    {
+        // get representation as a reversed string
+        uint8_t digit = data % base;
+        buffer[--index] = digit < 10 ? '0' + digit : 'A' + digit - 10;
+        data /= base;
+    } while (data);
+    put(buffer + index, sizeof(buffer) - index);
+}
+
+/****************************************************************************/
+
+void RF24LogLineFormatter::appendDouble(double data, uint8_t precision)
+{
+    char buffer[64];
+    int length = snprintf(buffer, sizeof(buffer), "%.*F", precision, data);
+    if (length > 0)
+    {
+        put(buffer, (size_t)length < sizeof(buffer) ? (size_t)length : sizeof(buffer) - 1);
+    }
+}
+
+/****************************************************************************/
+
+void RF24LogLineFormatter::appendStr(const char *data)
+{
+    put(data, strlen(data));
+}
+
+#endif // defined (RF24LOG_HOSTED)
@@ -0,0 +1,144 @@
+/**
+ * @file LineFormatter.h
+ * @brief A handler that formats each log message into memory before output
+ * @date Created 19 Oct 2026
+ * @author Brendan Doherty (2bndy5)
+ * @copyright Copyright (C) <br>
+ *      2026        Brendan Doherty (2bndy5) <br>
+ * This General Public License does not permit incorporating your program into
+ * proprietary programs.  If your program is a subroutine library, you may
+ * consider it more useful to permit linking proprietary applications with the
+ * library.  If this is what you want to do, use the GNU Lesser General
+ * Public License instead of this License.
+ */
+
+#ifndef SRC_RF24LOGPARTS_LINEFORMATTER_H_
+#define SRC_RF24LOGPARTS_LINEFORMATTER_H_
+
+#include "Common.h" // RF24LOG_HOSTED
+
+#if defined (RF24LOG_HOSTED)
+#include <stddef.h>
+#include <stdint.h>
+#include "PrintfParser.h"
+
+/**
+ * @brief The maximum number of bytes of a formatted log message (including all of its lines).
+ *
+ * Longer messages are truncated (the last line feed is kept).
+ */
+#ifndef RF24LOG_LINE_SIZE
+#define RF24LOG_LINE_SIZE 512
+#endif
+
+struct RF24LogLine; // declared in LineFormatter.cpp
+
+/**
+ * @brief An abstract handler that formats each log message into a buffer in memory.
+ *
+ * Unlike the stream loggers, every log message is handed to writeLine() as 1 contiguous
+ * buffer, which suits outputs that work with whole records (files, sockets, shared memory).
+ * Numbers are converted without stdio, and the header's timestamp is the time at which the
+ * message was logged (or captured, for a RF24LogRecord). Formatting uses only the caller's
+ * stack, so many threads can log through the same instance.
+ */
+class RF24LogLineFormatter : public RF24LogPrintfParser
+{
+public:
+
+    /**
+     * @brief output a captured message (if its level is enabled) with its capture timestamp.
+     * @param record The captured message
+     */
+    void logRecord(const RF24LogRecord *record);
+
+    /**
+     * @brief format a log message into a buffer
+     * @param buffer The destination (not null-terminated)
+     * @param size The size of the @p buffer
+     * @param logLevel The level of the logging message
+     * @param vendorId The prefixed origin of the message
+     * @param message The message format string
+     * @param args The sequence of arguments used to replace the format specifiers
+     * @param timestamp The time shown in the header (see rf24LogNow())
+     * @param thread The thread shown in the header (`nullptr` for the calling thread)
+     * @return The number of bytes written to the @p buffer
+     */
+    size_t format(char *buffer, size_t size,
+                  uint8_t logLevel,
+                  const char *vendorId,
+                  const char *message,
+                  RF24LogArgList *args,
+                  RF24LogTime timestamp,
+                  const RF24LogThread *thread = nullptr);
+
+    /**
+     * @brief format a log message into a buffer, with a given sequence number.
+     *
+     * The @p sequence is shown by the `%n` field of a RF24LogHeaderPattern, in place of the
+     * pattern's own count (for messages that were numbered when they were captured).
+     * @param buffer The destination (not null-terminated)
+     * @param size The size of the @p buffer
+     * @param logLevel The level of the logging message
+     * @param vendorId The prefixed origin of the message
+     * @param message The message format string
+     * @param args The sequence of arguments used to replace the format specifiers
+     * @param timestamp The time shown in the header (see rf24LogNow())
+     * @param sequence The sequence number shown in the header
+     * @param thread The thread shown in the header (`nullptr` for the calling thread)
+     * @return The number of bytes written to the @p buffer
+     */
+    size_t format(char *buffer, size_t size,
+                  uint8_t logLevel,
+                  const char *vendorId,
+                  const char *message,
+                  RF24LogArgList *args,
+                  RF24LogTime timestamp,
+                  uint32_t sequence,
+                  const RF24LogThread *thread = nullptr);
+
+protected:
+
+    /**
+     * @brief output 1 formatted log message
+     * @param data The formatted message (not null-terminated)
+     * @param length The number of bytes in @p data
+     * @param logLevel The level of the logging message
+     */
+    virtual void writeLine(const char *data, size_t length, uint8_t logLevel) = 0;
+
+#if defined (RF24LOG_STACK_TRACES)
+    /** @brief output the symbolized lines of a stack trace (after a message) */
+    void writeStackTrace(const RF24LogStackTrace *stack, uint8_t logLevel);
+#endif
+
+    void write(uint8_t logLevel,
+               const char *vendorId,
+               const char *message,
+               va_list *args);
+
+    // declare the rest to raise from pure virtual
+    /************************************************/
+
+    void appendTimestamp();
+    RF24LogTime headerTime();
+    const RF24LogThread *headerThread();
+    uint32_t headerSequence(RF24LogHeaderPattern *pattern);
+    void appendChar(char data, uint16_t depth = 1);
+    void appendInt(long data);
+    void appendUInt(unsigned long data, uint8_t base = 10);
+    void appendDouble(double data, uint8_t precision = 2);
+    void appendStr(const char *data);
+
+private:
+
+    /** @brief format a log message into the buffer of a line */
+    size_t format(RF24LogLine *line,
+                  uint8_t logLevel,
+                  const char *vendorId,
+                  const char *message,
+                  RF24LogArgList *args);
+};
+
+#endif // defined (RF24LOG_HOSTED)
+#endif /* SRC_RF24LOGPARTS_LINEFORMATTER_H_ */
@@ -0,0 +1,219 @@
+/**
+ * @file Lz.cpp
+ * @date Created 19 Oct 2026
+ * @author Brendan Doherty (2bndy5)
+ * @copyright Copyright (C) <br>
+ *      2026        Brendan Doherty (2bndy5) <br>
+ * This General Public License does not permit incorporating your program into
+ * proprietary programs.  If your program is a subroutine library, you may
+ * consider it more useful to permit linking proprietary applications with the
+ * library.  If this is what you want to do, use the GNU Lesser General
+ * Public License instead of this License.
+ */
+
+#include "Lz.h"
+
+#if defined (RF24LOG_HOSTED)
+#include <string.h> // memcpy(), memset()
+
+/** @brief The shortest match */
+#define LZ_MIN_MATCH 4
+/** @brief The last match must start this many bytes before the end of the block */
+#define LZ_MATCH_LIMIT 12
+/** @brief The last bytes of a block are always literals */
+#define LZ_LAST_LITERALS 5
+/** @brief The farthest match */
+#define LZ_MAX_OFFSET 65535
+/** @brief log2 of the number of hash table entries */
+#define LZ_HASH_LOG 12
+
+/****************************************************************************/
+
+static inline uint32_t read32(const char *data)
+{
+    uint32_t value;
+    memcpy(&value, data, sizeof(value));
+    return value;
+}
+
+/****************************************************************************/
+
+static inline uint32_t hash(uint32_t sequence)
+{
+    return (sequence * 2654435761U) >> (32 - LZ_HASH_LOG);
+}
+
+/****************************************************************************/
+
+/** @brief write a length's extension bytes (for lengths of 15 or more) */
+static inline char *putLength(char *output, size_t length)
+{
+    while (length >= 255)
+    {
+        *output++ = (char)255;
+        length -= 255;
+    }
+    *output++ = (char)length;
+    return output;
+}
+
+/****************************************************************************/
+
+size_t RF24LogLz::compress(const char *source, size_t size, char *destination)
+{
+    uint32_t table[1 << LZ_HASH_LOG];
+    memset(table, 0, sizeof(table));
+
+    const char *input = source;
+    const char *anchor = source; // the first literal that isn't written yet
+    const char *end = source + size;
+    char *output = destination;
+
+    if (size >= LZ_MATCH_LIMIT + 1)
+    {
+        const char *matchStartLimit = end - LZ_MATCH_LIMIT;
+        const char *matchEndLimit = end - LZ_LAST_LITERALS;
+        ++input;
+        while (input < matchStartLimit)
+        {
+            uint32_t sequence = read32(input);
+            uint32_t *entry = &table[hash(sequence)];
+            const char *reference = source + *entry;
+            *entry = (uint32_t)(input - source);
+            if (reference >= input || input - reference > LZ_MAX_OFFSET || read32(reference) != sequence)
+            {
+                ++input;
+                continue;
+            }
+
+            // extend the match backwards over the pending literals, then forwards
+            while (input > anchor && reference > source && input[-1] == reference[-1])
+            {
+                --input;
+                --reference;
+            }
+            const char *matchEnd = input + LZ_MIN_MATCH;
+            const char *referenceEnd = reference + LZ_MIN_MATCH;
+            while (matchEnd < matchEndLimit && *matchEnd == *referenceEnd)
+            {
+                ++matchEnd;
+                ++referenceEnd;
+            }
+
+            size_t literals = (size_t)(input - anchor);
+            size_t matchLength = (size_t)(matchEnd - input) - LZ_MIN_MATCH;
+            char *token = output++;
+            *token = (char)(((literals < 15 ? literals : 15) << 4) | (matchLength < 15 ? matchLength : 15));
+            if (literals >= 15)
+            {
+                output = putLength(output, literals - 15);
+            }
+            memcpy(output, anchor, literals);
+            output += literals;
+            uint16_t offset = (uint16_t)(input - reference);
+            *output++ = (char)(offset & 0xFF);
+            *output++ = (char)(offset >> 8);
+            if (matchLength >= 15)
+            {
+                output = putLength(output, matchLength - 15);
+            }
+
+            input = matchEnd;
+            anchor = input;
+            if (input < matchStartLimit)
+            {
+                table[hash(read32(input - 2))] = (uint32_t)(input - 2 - source);
+            }
+        }
+    }
+
+    // the rest is literals
+    size_t literals = (size_t)(end - anchor);
+    *output++ = (char)((literals < 15 ? literals : 15) << 4);
+    if (literals >= 15)
+    {
+        output = putLength(output, literals - 15);
+    }
+    memcpy(output, anchor, literals);
+    output += literals;
+    return (size_t)(output - destination);
+}
+
+/****************************************************************************/
+
+long RF24LogLz::decompress(const char *source, size_t size, char *destination, size_t capacity)
+{
+    const uint8_t *input = reinterpret_cast<const uint8_t *>(source);
+    const uint8_t *end = input + size;
+    char *output = destination;
+    char *outputEnd = destination + capacity;
+
+    while (input < end)
+    {
+        uint8_t token = *input++;
+        size_t literals = token >> 4;
+        if (literals == 15)
+        {
+            uint8_t more;
+            do
+            {
+                if (input >= end)
+                {
+                    return -1;
+                }
+                more = *input++;
+                literals += more;
+            } while (more == 255);
+        }
+        if (literals > (size_t)(end - input) || literals > (size_t)(outputEnd - output))
+        {
+            return -1;
+        }
+        memcpy(output, input, literals);
+        input += literals;
+        output += literals;
+        if (input == end)
+        {
+            break; // the last sequence has no match
+        }
+
+        if (end - input < 2)
+        {
+            return -1;
+        }
+        size_t offset = (size_t)input[0] | ((size_t)input[1] << 8);
+        input += 2;
+        if (offset == 0 || offset > (size_t)(output - destination))
+        {
+            return -1;
+        }
+        size_t matchLength = token & 15;
+        if (matchLength == 15)
+        {
+            uint8_t more;
+            do
+            {
+                if (input >= end)
+                {
+                    return -1;
+                }
+                more = *input++;
+                matchLength += more;
+            } while (more == 255);
+        }
+        matchLength += LZ_MIN_MATCH;
+        if (matchLength > (size_t)(outputEnd - output))
+        {
+            return -1;
+        }
+        // byte by byte: the match may overlap the bytes it produces
+        const char *reference = output - offset;
+        while (matchLength--)
+        {
+            *output++ = *reference++;
+        }
+    }
+    return (long)(output - destination);
+}
+
+#endif // defined (RF24LOG_HOSTED)
@@ -0,0 +1,76 @@
+/**
+ * @file Lz.h
+ * @brief A small LZ77 block codec (the LZ4 block format) and the block stream it is stored in
+ * @date Created 19 Oct 2026
+ * @author Brendan Doherty (2bndy5)
+ * @copyright Copyright (C) <br>
+ *      2026        Brendan Doherty (2bndy5) <br>
+ * This General Public License does not permit incorporating your program into
+ * proprietary programs.  If your program is a subroutine library, you may
+ * consider it more useful to permit linking proprietary applications with the
+ * library.  If this is what you want to do, use the GNU Lesser General
+ * Public License instead of this License.
+ */
+
+#ifndef SRC_RF24LOGPARTS_LZ_H_
+#define SRC_RF24LOGPARTS_LZ_H_
+
+#include "Common.h" // RF24LOG_HOSTED
+
+#if defined (RF24LOG_HOSTED)
+#include <stddef.h>
+#include <stdint.h>
+
+/** @brief The first word of a compressed log stream ("RF24" as a little-endian word) */
+#define RF24LOG_LZ_MAGIC 0x34324652
+/** @brief The version of the compressed log stream (the word after @ref RF24LOG_LZ_MAGIC) */
+#define RF24LOG_LZ_VERSION 1
+/** @brief The size of a block's header (2 little-endian words) */
+#define RF24LOG_LZ_BLOCK_HEADER 8
+/** @brief Set in a block's first word when the block is stored uncompressed */
+#define RF24LOG_LZ_STORED 0x80000000UL
+/** @brief The largest block (uncompressed) */
+#define RF24LOG_LZ_MAX_BLOCK (4UL << 20)
+
+/**
+ * @brief Compresses & decompresses blocks of log text.
+ *
+ * The blocks use the LZ4 block format: a greedy LZ77 compressor with a hash table of
+ * 4-byte sequences and no entropy coding, which is fast enough for a background thread and
+ * works very well on the repetitive headers of formatted log messages.
+ *
+ * A compressed log stream (see RF24LogCompressSink) is a sequence of:
+ * - a stream header (@ref RF24LOG_LZ_MAGIC, @ref RF24LOG_LZ_VERSION) at the start of every
+ *   writer's output (so streams can be appended to each other);
+ * - blocks: the uncompressed size (with @ref RF24LOG_LZ_STORED if the data is not compressed),
+ *   the size of the data, then the data.
+ */
+class RF24LogLz
+{
+public:
+
+    /** @brief the largest compressed size of @p size bytes */
+    static inline size_t bound(size_t size) { return size + size / 255 + 16; }
+
+    /**
+     * @brief compress a block
+     * @param source The data to compress
+     * @param size The number of bytes in @p source (at most @ref RF24LOG_LZ_MAX_BLOCK)
+     * @param destination Where to put the compressed data (at least `bound(size)` bytes)
+     * @return The size of the compressed data
+     */
+    static size_t compress(const char *source, size_t size, char *destination);
+
+    /**
+     * @brief decompress a block
+     * @param source The compressed data
+     * @param size The number of bytes in @p source
+     * @param destination Where to put the decompressed data
+     * @param capacity The size of @p destination
+     * @return The size of the decompressed data, or -1 if the data is corrupt
+     */
+    static long decompress(const char *source, size_t size, char *destination, size_t capacity);
+};
+
+#endif // defined (RF24LOG_HOSTED)
+#endif /* SRC_RF24LOGPARTS_LZ_H_ */
@@ -0,0 +1,347 @@
+/**
+ * @file Memory.cpp
+ * @date Created 19 Oct 2026
+ * @author Brendan Doherty (2bndy5)
+ * @copyright Copyright (C) <br>
+ *      2026        Brendan Doherty (2bndy5) <br>
+ * This General Public License does not permit incorporating your program into
+ * proprietary programs.  If your program is a subroutine library, you may
+ * consider it more useful to permit linking proprietary applications with the
+ * library.  If this is what you want to do, use the GNU Lesser General
+ * Public License instead of this License.
+ */
+
+#include "Memory.h"
+
+#if defined (RF24LOG_HOSTED)
+#include <stdlib.h> // malloc(), free()
+#include <mutex>
+
+/** @brief The log2 of the smallest size class */
+#define RF24LOG_MEMORY_MIN_SHIFT 6
+/** @brief The log2 of the largest power of 2 with size classes (larger blocks are not kept for reuse) */
+#define RF24LOG_MEMORY_MAX_SHIFT 40
+/** @brief The number of size classes (4 per power of 2) */
+#define RF24LOG_MEMORY_CLASSES ((RF24LOG_MEMORY_MAX_SHIFT - RF24LOG_MEMORY_MIN_SHIFT) * 4 + 1)
+
+/** @brief The header of a block (the buffer follows it) */
+struct alignas(alignof(max_align_t)) RF24LogBlockHeader
+{
+    /** @brief The next block kept for reuse (of the same class) */
+    RF24LogBlockHeader *next;
+    /** @brief The bytes accounted for the block (the size of its class, with this header) */
+    size_t bytes;
+};
+
+/** @brief The budget and the pools */
+struct RF24LogMemoryState
+{
+    std::mutex mutex;
+    size_t budget = 0;
+    uint8_t policy = RF24LOG_BUDGET_SHRINK;
+    size_t used = 0;
+    size_t cached = 0;
+    size_t peak = 0;
+    uint32_t shrunk = 0;
+    uint32_t refused = 0;
+    uint32_t overdrafts = 0;
+    RF24LogBlockHeader *free[RF24LOG_MEMORY_CLASSES] = {};
+
+    ~RF24LogMemoryState();
+};
+
+/****************************************************************************/
+
+/** @brief the state (constructed by its first use, so handlers can be static objects too) */
+static RF24LogMemoryState &memoryState()
+{
+    static RF24LogMemoryState state;
+    return state;
+}
+
+/****************************************************************************/
+
+/** @brief the size of a class */
+static size_t classSize(size_t index)
+{
+    size_t power = (size_t)1 << (RF24LOG_MEMORY_MIN_SHIFT + index / 4);
+    return power + (index % 4) * (power / 4);
+}
+
+/****************************************************************************/
+
+/** @brief the smallest class that holds @p size bytes (@ref RF24LOG_MEMORY_CLASSES if there is none) */
+static size_t classOf(size_t size)
+{
+    if (size <= classSize(0))
+    {
+        return 0;
+    }
+    if (size > classSize(RF24LOG_MEMORY_CLASSES - 1))
+    {
+        return RF24LOG_MEMORY_CLASSES;
+    }
+    size_t shift = RF24LOG_MEMORY_MIN_SHIFT;
+    while (((size_t)2 << shift) < size)
+    {
+        ++shift;
+    }
+    // (1 << shift) < size <= (2 << shift); count the quarters of (1 << shift) above it
+    size_t power = (size_t)1 << shift;
+    size_t quarters = (size - power + power / 4 - 1) / (power / 4);
+    return (shift - RF24LOG_MEMORY_MIN_SHIFT) * 4 + quarters;
+}
+
+/****************************************************************************/
+
+/** @brief free the blocks kept for reuse (the caller holds the state's mutex) */
+static void trimLocked(RF24LogMemoryState *state)
+{
+    for (RF24LogBlockHeader *&head : state->free)
+    {
+        while (head != nullptr)
+        {
+            RF24LogBlockHeader *block = head;
+            head = block->next;
+            free(block);
+        }
+    }
+    state->cached = 0;
+}
+
+/****************************************************************************/
+
+RF24LogMemoryState::~RF24LogMemoryState()
+{
+    trimLocked(this);
+}
+
+/****************************************************************************/
+
+/**
+ * @brief account for @p *size bytes, applying the policy if they don't fit in the budget
+ * @param state The state (its mutex is held by the caller)
+ * @param size The bytes wanted; set to the bytes granted
+ * @param minimum The least number of bytes that is useful
+ * @param pooled Are the bytes served from the size classes (so a shrunk size is a class size)?
+ * @return false if the bytes were refused
+ */
+static bool grantLocked(RF24LogMemoryState *state, size_t *size, size_t minimum, bool pooled)
+{
+    size_t need = pooled && classOf(*size) < RF24LOG_MEMORY_CLASSES ? classSize(classOf(*size)) : *size;
+    if (state->budget && state->used + state->cached + need > state->budget)
+    {
+        trimLocked(state); // the blocks kept for reuse make room first
+    }
+    if (state->budget && state->used + need > state->budget)
+    {
+        if (state->policy == RF24LOG_BUDGET_OVERDRAFT)
+        {
+            ++state->overdrafts;
+        }
+        else
+        {
+            size_t available = state->budget > state->used ? state->budget - state->used : 0;
+            if (pooled)
+            {
+                size_t index = classOf(available);
+                while (index && (index >= RF24LOG_MEMORY_CLASSES || classSize(index) > available))
+                {
+                    --index;
+                }
+                available = classSize(index) <= available ? classSize(index) : 0;
+            }
+            if (state->policy != RF24LOG_BUDGET_SHRINK || !available || available < minimum)
+            {
+                ++state->refused;
+                *size = 0;
+                return false;
+            }
+            ++state->shrunk;
+            *size = available;
+            need = available;
+        }
+    }
+    state->used += need;
+    if (state->used + state->cached > state->peak)
+    {
+        state->peak = state->used + state->cached;
+    }
+    return true;
+}
+
+/****************************************************************************/
+
+void RF24LogMemory::setBudget(size_t bytes, uint8_t policy)
+{
+    RF24LogMemoryState &state = memoryState();
+    std::lock_guard<std::mutex> lock(state.mutex);
+    state.budget = bytes;
+    state.policy = policy;
+    if (bytes && state.used + state.cached > bytes)
+    {
+        trimLocked(&state);
+    }
+}
+
+/****************************************************************************/
+
+size_t RF24LogMemory::budget()
+{
+    RF24LogMemoryState &state = memoryState();
+    std::lock_guard<std::mutex> lock(state.mutex);
+    return state.budget;
+}
+
+/****************************************************************************/
+
+void *RF24LogMemory::allocate(size_t *size, size_t minimum)
+{
+    if (*size == 0)
+    {
+        return nullptr;
+    }
+    RF24LogMemoryState &state = memoryState();
+    std::lock_guard<std::mutex> lock(state.mutex);
+
+    // reuse a block of the same class (this doesn't change the total)
+    size_t bytes = sizeof(RF24LogBlockHeader) + *size;
+    size_t index = classOf(bytes);
+    RF24LogBlockHeader *block;
+    if (index < RF24LOG_MEMORY_CLASSES && state.free[index] != nullptr)
+    {
+        block = state.free[index];
+        state.free[index] = block->next;
+        state.cached -= block->bytes;
+        state.used += block->bytes;
+        return block + 1;
+    }
+
+    if (!grantLocked(&state, &bytes, sizeof(RF24LogBlockHeader) + minimum, true))
+    {
+        *size = 0;
+        return nullptr;
+    }
+    index = classOf(bytes);
+    bytes = index < RF24LOG_MEMORY_CLASSES ? classSize(index) : bytes;
+    block = static_cast<RF24LogBlockHeader *>(malloc(bytes));
+    if (block == nullptr)
+    {
+        state.used -= bytes;
+        ++state.refused;
+        *size = 0;
+        return nullptr;
+    }
+    block->bytes = bytes;
+    if (sizeof(RF24LogBlockHeader) + *size > bytes)
+    {
+        *size = bytes - sizeof(RF24LogBlockHeader); // shrunk to the size of a class
+    }
+    return block + 1;
+}
+
+/****************************************************************************/
+
+void RF24LogMemory::release(void *buffer)
+{
+    if (buffer == nullptr)
+    {
+        return;
+    }
+    RF24LogMemoryState &state = memoryState();
+    std::lock_guard<std::mutex> lock(state.mutex);
+    RF24LogBlockHeader *block = static_cast<RF24LogBlockHeader *>(buffer) - 1;
+    state.used -= block->bytes;
+    size_t index = classOf(block->bytes);
+    if (index >= RF24LOG_MEMORY_CLASSES)
+    {
+        free(block);
+        return;
+    }
+    state.cached += block->bytes;
+    block->next = state.free[index];
+    state.free[index] = block;
+}
+
+/****************************************************************************/
+
+bool RF24LogMemory::reserve(size_t *size, size_t minimum)
+{
+    RF24LogMemoryState &state = memoryState();
+    std::lock_guard<std::mutex> lock(state.mutex);
+    return grantLocked(&state, size, minimum, false);
+}
+
+/****************************************************************************/
+
+void RF24LogMemory::unreserve(size_t size)
+{
+    RF24LogMemoryState &state = memoryState();
+    std::lock_guard<std::mutex> lock(state.mutex);
+    state.used -= size;
+}
+
+/****************************************************************************/
+
+void RF24LogMemory::trim()
+{
+    RF24LogMemoryState &state = memoryState();
+    std::lock_guard<std::mutex> lock(state.mutex);
+    trimLocked(&state);
+}
+
+/****************************************************************************/
+
+size_t RF24LogMemory::used()
+{
+    RF24LogMemoryState &state = memoryState();
+    std::lock_guard<std::mutex> lock(state.mutex);
+    return state.used;
+}
+
+/****************************************************************************/
+
+size_t RF24LogMemory::cached()
+{
+    RF24LogMemoryState &state = memoryState();
+    std::lock_guard<std::mutex> lock(state.mutex);
+    return state.cached;
+}
+
+/****************************************************************************/
+
+size_t RF24LogMemory::peak()
+{
+    RF24LogMemoryState &state = memoryState();
+    std::lock_guard<std::mutex> lock(state.mutex);
+    return state.peak;
+}
+
+/****************************************************************************/
+
+uint32_t RF24LogMemory::shrunk()
+{
+    RF24LogMemoryState &state = memoryState();
+    std::lock_guard<std::mutex> lock(state.mutex);
+    return state.shrunk;
+}
+
+/****************************************************************************/
+
+uint32_t RF24LogMemory::refused()
+{
+    RF24LogMemoryState &state = memoryState();
+    std::lock_guard<std::mutex> lock(state.mutex);
+    return state.refused;
+}
+
+/****************************************************************************/
+
+uint32_t RF24LogMemory::overdrafts()
+{
+    RF24LogMemoryState &state = memoryState();
+    std::lock_guard<std::mutex> lock(state.mutex);
+    return state.overdrafts;
+}
+
+#endif // defined (RF24LOG_HOSTED)
@@ -0,0 +1,158 @@
+/**
+ * @file Memory.h
+ * @brief A logging-wide memory budget, with size-classed pools for the handlers' buffers
+ * @date Created 19 Oct 2026
+ * @author Brendan Doherty (2bndy5)
+ * @copyright Copyright (C) <br>
+ *      2026        Brendan Doherty (2bndy5) <br>
+ * This General Public License does not permit incorporating your program into
+ * proprietary programs.  If your program is a subroutine library, you may
+ * consider it more useful to permit linking proprietary applications with the
+ * library.  If this is what you want to do, use the GNU Lesser General
+ * Public License instead of this License.
+ */
+
+#ifndef SRC_RF24LOGPARTS_MEMORY_H_
+#define SRC_RF24LOGPARTS_MEMORY_H_
+
+#include <stddef.h>
+#include <stdint.h>
+#include "Common.h" // RF24LOG_HOSTED
+
+#if defined (RF24LOG_HOSTED)
+#include <new> // placement new
+
+/**
+ * @brief budget policy: a buffer that doesn't fit in the remaining budget is made smaller (down
+ * to the minimum that its owner works with); if even the minimum doesn't fit, it is refused.
+ */
+#define RF24LOG_BUDGET_SHRINK 0
+/** @brief budget policy: a buffer that doesn't fit in the remaining budget is refused */
+#define RF24LOG_BUDGET_REFUSE 1
+/**
+ * @brief budget policy: a buffer that doesn't fit in the remaining budget is allocated anyway
+ * (and counted by RF24LogMemory::overdrafts()), to size a budget before enforcing it
+ */
+#define RF24LOG_BUDGET_OVERDRAFT 2
+
+/**
+ * @brief The memory budget shared by all of the logging buffers.
+ *
+ * The handlers and sinks that own buffers (like RF24LogWritevSink or RF24LogLaneHandler)
+ * allocate them from here when they are constructed, and never allocate memory while logging.
+ * So, the total memory used by logging is bounded by the budget (set with setBudget()), and
+ * bursts of messages are absorbed (or dropped and counted) by the buffers that already exist.
+ *
+ * When a buffer doesn't fit in the remaining budget, the @ref RF24LOG_BUDGET_SHRINK policy
+ * (the default) gives its owner a smaller buffer, which means smaller batches (or fewer queued
+ * messages). An owner whose buffer is refused still works, as documented by each owner
+ * (usually by writing each message without buffering it, or by dropping the messages).
+ *
+ * The blocks are served from size classes (4 per power of 2, so a block wastes less than 25%
+ * of its size), after a small header that records the block's size. A released block is kept
+ * for reuse by the next buffer of its class, so re-creating a handler doesn't allocate memory
+ * again; the kept blocks count against the budget, and are freed (see trim()) when a new
+ * buffer needs their room.
+ */
+class RF24LogMemory
+{
+public:
+
+    /**
+     * @brief set the maximum number of bytes used by all of the logging buffers
+     * @param bytes The budget (`0` for no limit, the default)
+     * @param policy What happens to a buffer that doesn't fit (like @ref RF24LOG_BUDGET_SHRINK)
+     */
+    static void setBudget(size_t bytes, uint8_t policy = RF24LOG_BUDGET_SHRINK);
+
+    /** @brief the budget set by setBudget() (`0` for no limit) */
+    static size_t budget();
+
+    /**
+     * @brief allocate a buffer from the budget
+     * @param size The number of bytes wanted; set to the number of bytes granted (which can be
+     * less when the @ref RF24LOG_BUDGET_SHRINK policy applies, or `0` when refused)
+     * @param minimum The least number of bytes that is useful to the caller
+     * @return The buffer, or `nullptr` if it was refused
+     */
+    static void *allocate(size_t *size, size_t minimum);
+
+    /**
+     * @brief return a buffer to the budget
+     * @param block The buffer from allocate() (can be `nullptr`)
+     */
+    static void release(void *block);
+
+    /**
+     * @brief allocate and construct an array of objects from the budget
+     * @param count The number of objects wanted; set to the number granted (or `0` when refused)
+     * @param minimum The least number of objects that is useful to the caller
+     * @return The array, or `nullptr` if it was refused
+     */
+    template <typename T>
+    static T *allocateArray(size_t *count, size_t minimum)
+    {
+        static_assert(alignof(T) <= alignof(max_align_t), "the blocks are only aligned like malloc()");
+        size_t size = *count * sizeof(T);
+        T *array = static_cast<T *>(allocate(&size, minimum * sizeof(T)));
+        *count = size / sizeof(T);
+        for (size_t i = 0; i < *count; ++i)
+        {
+            new (&array[i]) T;
+        }
+        return array;
+    }
+
+    /**
+     * @brief destroy an array from allocateArray() and return it to the budget
+     * @param array The array (can be `nullptr`)
+     * @param count The number of objects granted by allocateArray()
+     */
+    template <typename T>
+    static void releaseArray(T *array, size_t count)
+    {
+        for (size_t i = 0; i < count; ++i)
+        {
+            array[i].~T();
+        }
+        release(array);
+    }
+
+    /**
+     * @brief account for memory that isn't allocated here (like a shared memory ring)
+     * @param size The number of bytes wanted; set to the number of bytes granted (like allocate())
+     * @param minimum The least number of bytes that is useful to the caller
+     * @return false if the memory was refused
+     */
+    static bool reserve(size_t *size, size_t minimum);
+
+    /**
+     * @brief return memory accounted by reserve() to the budget
+     * @param size The size granted by reserve()
+     */
+    static void unreserve(size_t size);
+
+    /** @brief free the blocks kept for reuse */
+    static void trim();
+
+    /** @brief the number of bytes used by the logging buffers */
+    static size_t used();
+
+    /** @brief the number of bytes kept for reuse (see trim()) */
+    static size_t cached();
+
+    /** @brief the highest number of bytes used (and kept for reuse) at once */
+    static size_t peak();
+
+    /** @brief the number of buffers that were made smaller to fit in the budget */
+    static uint32_t shrunk();
+
+    /** @brief the number of buffers that were refused */
+    static uint32_t refused();
+
+    /** @brief the number of buffers that were allocated beyond the budget (see @ref RF24LOG_BUDGET_OVERDRAFT) */
+    static uint32_t overdrafts();
+};
+
+#endif // defined (RF24LOG_HOSTED)
+#endif /* SRC_RF24LOGPARTS_MEMORY_H_ */
@@ -18,6 +18,51 @@
 #endif
 
 #include "FormatSpecifier.h" // FormatSpecifier struct
+#include "Profiler.h" // RF24LogProfiler (when RF24LOG_PROFILE is defined)
+
+/****************************************************************************/
+
+void RF24LogPrintfParser::logRecord(const RF24LogRecord *record)
+{
+    if (!isLevelEnabled(record->logLevel) && !(record->flags & RF24LOG_RECORD_FORCED))
+    {
+        return;
+    }
+    RF24LogArgList argList(record->args, record->argsSize);
+    _record = record;
+#if defined(ARDUINO_ARCH_AVR)
+    if (record->flags & RF24LOG_RECORD_FLASH)
+    {
+        write(record->logLevel,
+              reinterpret_cast<const __FlashStringHelper *>(record->vendorId),
+              reinterpret_cast<const __FlashStringHelper *>(record->message),
+              &argList);
+        _record = nullptr;
+        return;
+    }
+#endif
+    write(record->logLevel, record->vendorId, record->message, &argList);
+    _record = nullptr;
+#if defined (RF24LOG_STACK_TRACES)
+    if (record->flags & RF24LOG_RECORD_STACK)
+    {
+        appendStackTrace(&record->stack);
+    }
+#endif
+}
+
+/****************************************************************************/
+
+#if defined (RF24LOG_STACK_TRACES)
+void RF24LogPrintfParser::appendStackTrace(const RF24LogStackTrace *stack)
+{
+    char trace[RF24LOG_STACK_TEXT_SIZE];
+    if (stack->format(trace, sizeof(trace)))
+    {
+        appendStr(trace);
+    }
+}
+#endif
 
 /****************************************************************************/
 
@@ -26,22 +71,42 @@ void RF24LogPrintfParser::write(uint8_t logLevel,
                                 const __FlashStringHelper *vendorId,
                                 const __FlashStringHelper *message,
                                 va_list *args)
+{
+    RF24LogArgList argList(args);
+    write(logLevel, vendorId, message, &argList);
+}
+
+/****************************************************************************/
+
+void RF24LogPrintfParser::write(uint8_t logLevel,
+                                const __FlashStringHelper *vendorId,
+                                const __FlashStringHelper *message,
+                                RF24LogArgList *args)
 {
     PGM_P p = reinterpret_cast<PGM_P>(message);
     char c = pgm_read_byte(p++);
+    RF24LogHeaderPattern *header = logLevel ? _header : nullptr;
+    uint32_t sequence = header ? headerSequence(header) : 0;
     do
     {
         // print header
     #if defined(RF24LOG_NO_EOL)
         appendChar(RF24LOG_DELIMITER);
     #endif
-        descTimeLevel(logLevel);
-        PGM_P id = reinterpret_cast<PGM_P>(vendorId);
-        char v = pgm_read_byte(id++);
-        if (v)
+        if (header)
         {
-            appendStr(vendorId);
-            appendChar(RF24LOG_DELIMITER);
+            appendHeader(header, logLevel, sequence, vendorId);
+        }
+        else
+        {
+            descTimeLevel(logLevel);
+            PGM_P id = reinterpret_cast<PGM_P>(vendorId);
+            char v = pgm_read_byte(id++);
+            if (v)
+            {
+                appendStr(vendorId);
+                appendChar(RF24LOG_DELIMITER);
+            }
         }
 
         // print formatted message (or at least 1 line at a time)
@@ -101,18 +166,50 @@ void RF24LogPrintfParser::write(uint8_t logLevel,
                                 const char *message,
                                 va_list *args)
 {
+    RF24LogArgList argList(args);
+    write(logLevel, vendorId, message, &argList);
+#if defined (RF24LOG_STACK_TRACES)
+    if (RF24LogStackTrace::isCaptured(logLevel))
+    {
+        // the message is output at once, so is its stack trace
+        RF24LogStackTrace stack;
+        stack.capture();
+        appendStackTrace(&stack);
+    }
+#endif
+}
+
+/****************************************************************************/
+
+void RF24LogPrintfParser::write(uint8_t logLevel,
+                                const char *vendorId,
+                                const char *message,
+                                RF24LogArgList *args)
+{
+#if defined (RF24LOG_PROFILE)
+    RF24LogProfiler::Format profile(logLevel, vendorId, message);
+#endif
     char *c = (char *)message;
+    RF24LogHeaderPattern *header = logLevel ? _header : nullptr;
+    uint32_t sequence = header ? headerSequence(header) : 0;
     do
     {
         // print header
 #if defined(RF24LOG_NO_EOL)
         appendChar(RF24LOG_DELIMITER);
 #endif
-        descTimeLevel(logLevel);
-        if (*vendorId)
+        if (header)
+        {
+            appendHeader(header, logLevel, sequence, vendorId);
+        }
+        else
         {
-            appendStr(vendorId);
-            appendChar(RF24LOG_DELIMITER);
+            descTimeLevel(logLevel);
+            if (*vendorId)
+            {
+                appendStr(vendorId);
+                appendChar(RF24LOG_DELIMITER);
+            }
         }
 
         // print formatted message (or at least 1 line at a time)
@@ -19,11 +19,68 @@
 #include <stdint.h>
 #include "AbstractHandler.h"
 #include "AbstractStream.h"
+#include "ArgList.h"
+#include "Record.h"
 
 /** @brief class that holds the RF24Log's in-house printf-like parsing */
 class RF24LogPrintfParser : public RF24LogAbstractHandler, public RF24LogAbstractStream
 {
+public:
+
+    /**
+     * @brief output a captured message (if its level is enabled).
+     *
+     * The header's timestamp is the time of capture (see headerTime()).
+     * @param record The captured message
+     */
+    void logRecord(const RF24LogRecord *record);
+
+    /**
+     * @brief use a compiled header layout instead of the default header.
+     *
+     * The default header (the timestamp, level description and vendorId, separated by
+     * @ref RF24LOG_DELIMITER) is used again when @p pattern is `nullptr`.
+     * @param pattern The header layout. It must remain valid while it is used.
+     */
+    void setHeaderPattern(RF24LogHeaderPattern *pattern) { _header = pattern; }
+
 protected:
+
+    /** @brief The header layout (or `nullptr` for the default header) */
+    RF24LogHeaderPattern *_header = nullptr;
+
+    /** @brief The captured message being output by logRecord() (or `nullptr`) */
+    const RF24LogRecord *_record = nullptr;
+
+    /**
+     * @brief the time shown in the header
+     * @return The time of capture of the message being output by logRecord(), or the current time.
+     */
+    RF24LogTime headerTime() { return _record ? _record->timestamp : rf24LogNow(); }
+
+#if defined (RF24LOG_HOSTED)
+    /**
+     * @brief the thread shown in the header
+     * @return The thread that logged the message being output by logRecord(), or the calling thread.
+     */
+    const RF24LogThread *headerThread()
+    {
+        return _record ? &_record->thread : RF24LogHeaderPattern::thisThread();
+    }
+#endif
+
+    /**
+     * @brief the sequence number of the log message being output
+     * @param pattern The header layout
+     * @return The pattern's next sequence number, unless the message was numbered earlier.
+     */
+    virtual uint32_t headerSequence(RF24LogHeaderPattern *pattern) { return pattern->nextSequence(); }
+
+#if defined (RF24LOG_STACK_TRACES)
+    /** @brief output the symbolized lines of a stack trace (after a message) */
+    void appendStackTrace(const RF24LogStackTrace *stack);
+#endif
+
     void write(uint8_t logLevel,
                const char *vendorId,
                const char *message,
@@ -35,6 +92,25 @@ protected:
                const __FlashStringHelper *message,
                va_list *args);
 #endif
+
+    /**
+     * @brief write log message to its destination
+     * @param logLevel The level of the logging message
+     * @param vendorId The prefixed origin of the message
+     * @param message The message format string
+     * @param args The sequence of arguments used to replace the format specifiers
+     */
+    void write(uint8_t logLevel,
+               const char *vendorId,
+               const char *message,
+               RF24LogArgList *args);
+
+#if defined (ARDUINO_ARCH_AVR)
+    void write(uint8_t logLevel,
+               const __FlashStringHelper *vendorId,
+               const __FlashStringHelper *message,
+               RF24LogArgList *args);
+#endif
 };
 
 #endif /* SRC_RF24LOGPARTS_PARSING_H_ */
@@ -0,0 +1,257 @@
+/**
+ * @file Profiler.cpp
+ * @date Created 19 Oct 2026
+ * @author Brendan Doherty (2bndy5)
+ * @copyright Copyright (C) <br>
+ *      2026        Brendan Doherty (2bndy5) <br>
+ * This General Public License does not permit incorporating your program into
+ * proprietary programs.  If your program is a subroutine library, you may
+ * consider it more useful to permit linking proprietary applications with the
+ * library.  If this is what you want to do, use the GNU Lesser General
+ * Public License instead of this License.
+ */
+
+#include "Profiler.h"
+
+#if defined (RF24LOG_PROFILE)
+#include <algorithm>     // std::partial_sort()
+#include <mutex>         // std::mutex, std::lock_guard
+#include <unordered_map> // std::unordered_map
+#include <vector>        // std::vector
+
+static_assert((RF24LOG_PROFILE_SITES & (RF24LOG_PROFILE_SITES - 1)) == 0,
+              "RF24LOG_PROFILE_SITES must be a power of 2");
+
+/** @brief The counters of 1 message in 1 thread (only written by the owning thread) */
+struct RF24LogProfilerEntry
+{
+    std::atomic<const char *> message;
+    const char *vendorId;
+    uint8_t logLevel;
+    std::atomic<uint64_t> calls;
+    std::atomic<uint64_t> filtered;
+    std::atomic<uint64_t> formatCycles;
+    std::atomic<uint64_t> sinkCycles;
+};
+
+/** @brief The open-addressing table of 1 thread */
+struct RF24LogProfilerTable
+{
+    RF24LogProfilerEntry entries[RF24LOG_PROFILE_SITES];
+    /** @brief counts the messages that didn't fit in @ref entries */
+    RF24LogProfilerEntry overflow;
+    /** @brief The owning thread has exited (guarded by tablesMutex()) */
+    bool retired;
+    RF24LogProfilerTable *next;
+};
+
+thread_local RF24LogProfiler::ThreadState RF24LogProfiler::t_state RF24LOG_TLS_MODEL = {false, 0, 0, 0};
+
+/** @brief The calling thread's table */
+static thread_local RF24LogProfilerTable *t_table RF24LOG_TLS_MODEL = nullptr;
+
+/** @brief the list of all tables (guarded by tablesMutex()) */
+static RF24LogProfilerTable *tablesHead = nullptr;
+
+/** @brief the mutex that guards the list of tables */
+static std::mutex &tablesMutex()
+{
+    static std::mutex mutex;
+    return mutex;
+}
+
+/****************************************************************************/
+
+/** @brief retires the calling thread's table (for reuse by a new thread) when the thread exits */
+struct RF24LogProfilerTableOwner
+{
+    RF24LogProfilerTable *table = nullptr;
+
+    ~RF24LogProfilerTableOwner()
+    {
+        if (table != nullptr)
+        {
+            std::lock_guard<std::mutex> lock(tablesMutex());
+            table->retired = true;
+        }
+    }
+};
+
+/****************************************************************************/
+
+/** @brief get the calling thread's table (the counters of exited threads are kept) */
+static RF24LogProfilerTable *threadTable()
+{
+    if (t_table != nullptr)
+    {
+        return t_table;
+    }
+    static thread_local RF24LogProfilerTableOwner owner;
+    std::lock_guard<std::mutex> lock(tablesMutex());
+    RF24LogProfilerTable *table = tablesHead;
+    while (table != nullptr && !table->retired)
+    {
+        table = table->next;
+    }
+    if (table == nullptr)
+    {
+        table = new RF24LogProfilerTable();
+        table->next = tablesHead;
+        tablesHead = table;
+    }
+    table->retired = false;
+    owner.table = table;
+    t_table = table;
+    return table;
+}
+
+/****************************************************************************/
+
+/** @brief find (or claim) the calling thread's entry for a message */
+static RF24LogProfilerEntry *findEntry(uint8_t logLevel, const char *vendorId, const char *message)
+{
+    RF24LogProfilerTable *table = threadTable();
+    uintptr_t hash = (uintptr_t)message * (uintptr_t)0x9E3779B97F4A7C15ULL;
+    uint16_t index = (uint16_t)(hash >> (sizeof(uintptr_t) * 8 - 16));
+    for (uint16_t probes = 0; probes < RF24LOG_PROFILE_SITES; ++probes, ++index)
+    {
+        RF24LogProfilerEntry *entry = &table->entries[index & (RF24LOG_PROFILE_SITES - 1)];
+        const char *claimed = entry->message.load(std::memory_order_relaxed);
+        if (claimed == message)
+        {
+            return entry;
+        }
+        if (claimed == nullptr)
+        {
+            entry->vendorId = vendorId;
+            entry->logLevel = logLevel;
+            entry->message.store(message, std::memory_order_release);
+            return entry;
+        }
+    }
+    return &table->overflow;
+}
+
+/****************************************************************************/
+
+/** @brief add to a counter that only the calling thread writes */
+static inline void add(std::atomic<uint64_t> &counter, uint64_t value)
+{
+    counter.store(counter.load(std::memory_order_relaxed) + value, std::memory_order_relaxed);
+}
+
+/****************************************************************************/
+
+bool RF24LogProfiler::beginCall(uint8_t logLevel, const char *vendorId, const char *message)
+{
+    add(findEntry(logLevel, vendorId, message)->calls, 1);
+    bool outer = t_state.accepted;
+    t_state.accepted = false;
+    return outer;
+}
+
+/****************************************************************************/
+
+void RF24LogProfiler::endCall(const char *message, bool token)
+{
+    if (!t_state.accepted)
+    {
+        // the entry was claimed by beginCall()
+        add(findEntry(0, nullptr, message)->filtered, 1);
+    }
+    t_state.accepted = token;
+}
+
+/****************************************************************************/
+
+RF24LogProfiler::Format::Format(uint8_t logLevel, const char *vendorId, const char *message)
+{
+    active = t_state.formatDepth++ == 0;
+    this->logLevel = logLevel;
+    this->vendorId = vendorId;
+    this->message = message;
+    sinkStart = t_state.sinkCycles;
+    start = cycles();
+}
+
+/****************************************************************************/
+
+RF24LogProfiler::Format::~Format()
+{
+    --t_state.formatDepth;
+    if (!active)
+    {
+        return;
+    }
+    uint64_t total = cycles() - start;
+    uint64_t sink = t_state.sinkCycles - sinkStart;
+    RF24LogProfilerEntry *entry = findEntry(logLevel, vendorId, message);
+    add(entry->formatCycles, total > sink ? total - sink : 0);
+    add(entry->sinkCycles, sink);
+}
+
+/****************************************************************************/
+
+uint16_t RF24LogProfiler::report(Report *reports, uint16_t count)
+{
+    std::unordered_map<const char *, Report> merged;
+    {
+        std::lock_guard<std::mutex> lock(tablesMutex());
+        for (RF24LogProfilerTable *table = tablesHead; table != nullptr; table = table->next)
+        {
+            for (uint16_t i = 0; i <= RF24LOG_PROFILE_SITES; ++i)
+            {
+                RF24LogProfilerEntry *entry = i < RF24LOG_PROFILE_SITES ? &table->entries[i] : &table->overflow;
+                const char *message = entry->message.load(std::memory_order_acquire);
+                uint64_t calls = entry->calls.load(std::memory_order_relaxed);
+                if (message == nullptr && calls == 0)
+                {
+                    continue; // unclaimed entry (or an unused overflow entry)
+                }
+                Report &merge = merged[message];
+                if (merge.calls == 0 && merge.message == nullptr)
+                {
+                    merge.message = message;
+                    merge.vendorId = entry->vendorId;
+                    merge.logLevel = entry->logLevel;
+                }
+                merge.calls += calls;
+                merge.filtered += entry->filtered.load(std::memory_order_relaxed);
+                merge.formatCycles += entry->formatCycles.load(std::memory_order_relaxed);
+                merge.sinkCycles += entry->sinkCycles.load(std::memory_order_relaxed);
+            }
+        }
+    }
+
+    std::vector<Report> sorted;
+    sorted.reserve(merged.size());
+    for (const auto &it : merged)
+    {
+        sorted.push_back(it.second);
+    }
+    uint16_t n = (uint16_t)std::min<size_t>(count, sorted.size());
+    std::partial_sort(sorted.begin(), sorted.begin() + n, sorted.end(),
+                      [](const Report &a, const Report &b) { return a.cost() > b.cost(); });
+    std::copy(sorted.begin(), sorted.begin() + n, reports);
+    return n;
+}
+
+/****************************************************************************/
+
+void RF24LogProfiler::reset()
+{
+    std::lock_guard<std::mutex> lock(tablesMutex());
+    for (RF24LogProfilerTable *table = tablesHead; table != nullptr; table = table->next)
+    {
+        for (uint16_t i = 0; i <= RF24LOG_PROFILE_SITES; ++i)
+        {
+            RF24LogProfilerEntry *entry = i < RF24LOG_PROFILE_SITES ? &table->entries[i] : &table->overflow;
+            entry->calls.store(0, std::memory_order_relaxed);
+            entry->filtered.store(0, std::memory_order_relaxed);
+            entry->formatCycles.store(0, std::memory_order_relaxed);
+            entry->sinkCycles.store(0, std::memory_order_relaxed);
+        }
+    }
+}
+
+#endif // defined (RF24LOG_PROFILE)
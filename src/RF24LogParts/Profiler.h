@@ -0,0 +1,206 @@
+/**
+ * @file Profiler.h
+ * @brief An optional profiler that attributes the cost of logging to each log message
+ * @date Created 19 Oct 2026
+ * @author Brendan Doherty (2bndy5)
+ * @copyright Copyright (C) <br>
+ *      2026        Brendan Doherty (2bndy5) <br>
+ * This General Public License does not permit incorporating your program into
+ * proprietary programs.  If your program is a subroutine library, you may
+ * consider it more useful to permit linking proprietary applications with the
+ * library.  If this is what you want to do, use the GNU Lesser General
+ * Public License instead of this License.
+ */
+
+#ifndef SRC_RF24LOGPARTS_PROFILER_H_
+#define SRC_RF24LOGPARTS_PROFILER_H_
+
+#include <stdint.h>
+#include "Common.h" // RF24LOG_HOSTED, RF24LOG_TLS_MODEL
+
+#ifdef DOXYGEN_FORCED
+/**
+ * @brief macro (when defined) enables the RF24LogProfiler instrumentation.
+ *
+ * This has to be defined when building the library (use the `RF24LOG_PROFILE` CMake option)
+ * and is only supported on hosted platforms.
+ */
+#define RF24LOG_PROFILE
+
+/** @brief The number of distinct messages that each thread can profile (a power of 2). */
+#define RF24LOG_PROFILE_SITES 512
+#endif
+
+#if defined (RF24LOG_PROFILE) && !defined (RF24LOG_HOSTED)
+#undef RF24LOG_PROFILE
+#endif
+
+#if defined (RF24LOG_PROFILE)
+#include <atomic>
+#if defined (__x86_64__) || defined (__i386__)
+#include <x86intrin.h> // __rdtsc()
+#elif !defined (__aarch64__)
+#include <chrono> // std::chrono::steady_clock
+#endif
+
+#ifndef RF24LOG_PROFILE_SITES
+#define RF24LOG_PROFILE_SITES 512
+#endif
+
+/**
+ * @brief Counts the calls, filtered calls, and cycles spent per log message.
+ *
+ * Every call site is keyed by the message pointer that the @ref LoggingAPI macros pass in.
+ * Each thread accumulates into its own table with relaxed loads & stores (no locks, no atomic
+ * read-modify-write instructions); report() merges the tables of all threads. A thread that
+ * logs from a signal handler should log once from normal context first.
+ *
+ * - The formatting cost is the time spent in RF24LogPrintfParser::write() minus the sink cost.
+ * - The sink cost is the time spent in the logger's output methods (`append*()`), which
+ *   includes the conversions done by the output stream itself (like `printf()`).
+ */
+class RF24LogProfiler
+{
+public:
+
+    /** @brief The merged counters of 1 message (see report()) */
+    struct Report
+    {
+        /** @brief The message format string (`nullptr` for messages that didn't fit a thread's table) */
+        const char *message;
+        /** @brief The vendorId of the first call */
+        const char *vendorId;
+        /** @brief The level of the first call */
+        uint8_t logLevel;
+        /** @brief The number of log calls */
+        uint64_t calls;
+        /** @brief The number of log calls that no handler accepted */
+        uint64_t filtered;
+        /** @brief The cycles spent formatting the message */
+        uint64_t formatCycles;
+        /** @brief The cycles spent in the loggers' output methods */
+        uint64_t sinkCycles;
+
+        /** @brief The total cost (used to rank the messages) */
+        inline uint64_t cost() const { return formatCycles + sinkCycles; }
+    };
+
+    /**
+     * @brief get the messages with the highest total cost
+     * @param reports The array to fill (most expensive first)
+     * @param count The size of the @p reports array (the N in "top N")
+     * @return The number of @p reports filled
+     */
+    static uint16_t report(Report *reports, uint16_t count);
+
+    /**
+     * @brief reset all counters.
+     *
+     * Counts from log calls that run concurrently with this may be lost.
+     */
+    static void reset();
+
+    /** @brief read the CPU's cycle counter (or a nanosecond clock where there is none) */
+    static inline uint64_t cycles()
+    {
+#if defined (__x86_64__) || defined (__i386__)
+        return __rdtsc();
+#elif defined (__aarch64__)
+        uint64_t ticks;
+        __asm__ __volatile__("mrs %0, cntvct_el0" : "=r"(ticks));
+        return ticks;
+#else
+        return std::chrono::duration_cast<std::chrono::nanoseconds>(
+            std::chrono::steady_clock::now().time_since_epoch()).count();
+#endif
+    }
+
+    /**
+     * @brief count a call of RF24Logging::log() (the start of a log call)
+     * @return A token to pass to endCall() (log calls can nest in signal handlers).
+     */
+    static bool beginCall(uint8_t logLevel, const char *vendorId, const char *message);
+
+    /** @brief note that a handler accepted the current log call */
+    static inline void accept() { t_state.accepted = true; }
+
+    /**
+     * @brief count the current log call as filtered if no handler accepted it
+     * @param message The message passed to beginCall()
+     * @param token The value returned from the matching beginCall()
+     */
+    static void endCall(const char *message, bool token);
+
+    /**
+     * @brief measures the formatting of a message (used by RF24LogPrintfParser)
+     *
+     * A measurement nested in another one is ignored; the outer one includes its cycles.
+     */
+    class Format
+    {
+    public:
+        /** @brief start measuring */
+        Format(uint8_t logLevel, const char *vendorId, const char *message);
+        /** @brief stop measuring and account the cycles to the message */
+        ~Format();
+
+    private:
+        bool active;
+        uint8_t logLevel;
+        const char *vendorId;
+        const char *message;
+        uint64_t start;
+        uint64_t sinkStart;
+    };
+
+    /** @brief measures the output of a logger (used by the `append*()` methods) */
+    class Sink
+    {
+    public:
+        /** @brief start measuring (unless nested in another Sink) */
+        inline Sink()
+        {
+            if (t_state.sinkDepth++ == 0)
+            {
+                start = cycles();
+            }
+        }
+
+        /** @brief stop measuring (unless nested in another Sink) */
+        inline ~Sink()
+        {
+            if (--t_state.sinkDepth == 0)
+            {
+                t_state.sinkCycles += cycles() - start;
+            }
+        }
+
+    private:
+        uint64_t start = 0;
+    };
+
+private:
+
+    /** @brief The calling thread's state */
+    struct ThreadState
+    {
+        /** @brief Did a handler accept the current log call? */
+        bool accepted;
+        /** @brief The depth of nested Format measurements */
+        uint8_t formatDepth;
+        /** @brief The depth of nested Sink measurements */
+        uint8_t sinkDepth;
+        /** @brief The cycles spent in sinks (a running total) */
+        uint64_t sinkCycles;
+    };
+
+    static thread_local ThreadState t_state RF24LOG_TLS_MODEL;
+};
+
+/** @brief measure the enclosing output method (of a logger) as sink cost */
+#define RF24LOG_PROFILE_SINK() RF24LogProfiler::Sink rf24LogProfilerSink
+
+#else
+#define RF24LOG_PROFILE_SINK()
+#endif // defined (RF24LOG_PROFILE)
+#endif /* SRC_RF24LOGPARTS_PROFILER_H_ */
@@ -0,0 +1,54 @@
+/**
+ * @file Record.cpp
+ * @date Created 19 Oct 2026
+ * @author Brendan Doherty (2bndy5)
+ * @copyright Copyright (C) <br>
+ *      2026        Brendan Doherty (2bndy5) <br>
+ * This General Public License does not permit incorporating your program into
+ * proprietary programs.  If your program is a subroutine library, you may
+ * consider it more useful to permit linking proprietary applications with the
+ * library.  If this is what you want to do, use the GNU Lesser General
+ * Public License instead of this License.
+ */
+
+#include "Record.h"
+#include "ArgList.h" // RF24LogArgList::pack()
+#include "CallSite.h" // RF24LogSites::isForced()
+
+/****************************************************************************/
+
+void RF24LogRecord::capture(uint8_t logLevel, const char *vendorId, const char *message, va_list *args)
+{
+    this->timestamp = rf24LogNow();
+    this->vendorId = vendorId;
+    this->message = message;
+    this->logLevel = logLevel;
+#if defined (RF24LOG_HOSTED)
+    this->flags = RF24LogSites::isForced() ? RF24LOG_RECORD_FORCED : 0;
+    this->thread = *RF24LogHeaderPattern::thisThread();
+#else
+    this->flags = 0;
+#endif
+    this->argsSize = RF24LogArgList::pack(this->args, RF24LOG_RECORD_ARGS_SIZE, message, args);
+#if defined (RF24LOG_STACK_TRACES)
+    if (RF24LogStackTrace::isCaptured(logLevel))
+    {
+        this->stack.capture();
+        this->flags |= RF24LOG_RECORD_STACK;
+    }
+#endif
+}
+
+/****************************************************************************/
+
+#if defined (ARDUINO_ARCH_AVR)
+void RF24LogRecord::capture(uint8_t logLevel, const __FlashStringHelper *vendorId, const __FlashStringHelper *message, va_list *args)
+{
+    this->timestamp = rf24LogNow();
+    this->vendorId = reinterpret_cast<const char *>(vendorId);
+    this->message = reinterpret_cast<const char *>(message);
+    this->logLevel = logLevel;
+    this->flags = RF24LOG_RECORD_FLASH;
+    this->argsSize = RF24LogArgList::pack(this->args, RF24LOG_RECORD_ARGS_SIZE, message, args);
+}
+#endif
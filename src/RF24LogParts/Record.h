@@ -0,0 +1,100 @@
+/**
+ * @file Record.h
+ * @brief A log message captured for deferred output
+ * @date Created 19 Oct 2026
+ * @author Brendan Doherty (2bndy5)
+ * @copyright Copyright (C) <br>
+ *      2026        Brendan Doherty (2bndy5) <br>
+ * This General Public License does not permit incorporating your program into
+ * proprietary programs.  If your program is a subroutine library, you may
+ * consider it more useful to permit linking proprietary applications with the
+ * library.  If this is what you want to do, use the GNU Lesser General
+ * Public License instead of this License.
+ */
+
+#ifndef SRC_RF24LOGPARTS_RECORD_H_
+#define SRC_RF24LOGPARTS_RECORD_H_
+
+#if defined (ARDUINO_ARCH_AVR)
+#include <WString.h> // __FlashStringHelper
+#else
+#include <string.h>
+#endif
+
+#include <stdint.h>
+#include <stdarg.h>
+#include "Common.h" // RF24LogTime, rf24LogNow()
+#include "StackTrace.h" // RF24LogStackTrace (when RF24LOG_STACK_TRACES is defined)
+#include "HeaderPattern.h" // RF24LogThread (when RF24LOG_HOSTED is defined)
+
+/**
+ * @brief The maximum number of bytes used to store the arguments of a captured message.
+ *
+ * Arguments that don't fit are output as `0` (or an empty string).
+ * Strings from RAM are copied into this buffer (including the null terminator).
+ */
+#if !defined(RF24LOG_RECORD_ARGS_SIZE)
+#if defined (ARDUINO_ARCH_AVR)
+#define RF24LOG_RECORD_ARGS_SIZE 16
+#else
+#define RF24LOG_RECORD_ARGS_SIZE 64
+#endif
+#endif
+
+/** @brief RF24LogRecord::flags bit: the vendorId and message are stored in FLASH (AVR only) */
+#define RF24LOG_RECORD_FLASH 0x01
+/** @brief RF24LogRecord::flags bit: the message was captured from a call site switched to @ref RF24LOG_SITE_ENABLED */
+#define RF24LOG_RECORD_FORCED 0x02
+/** @brief RF24LogRecord::flags bit: the record holds a stack trace (see RF24LogStackTrace::setLevel()) */
+#define RF24LOG_RECORD_STACK 0x04
+
+/**
+ * @brief A log message whose arguments have been copied for output at a later time.
+ *
+ * The @ref vendorId and @ref message are stored by address, so they need to be
+ * string literals or global constants (which is already the recommended usage of
+ * the @ref LoggingAPI).
+ */
+struct RF24LogRecord
+{
+    /** @brief The time (see rf24LogNow()) at which the message was captured */
+    RF24LogTime timestamp;
+    /** @brief The prefixed origin of the message */
+    const char *vendorId;
+    /** @brief The message format string */
+    const char *message;
+    /** @brief The level of the logging message */
+    uint8_t logLevel;
+    /** @brief Options about how the record was captured (like @ref RF24LOG_RECORD_FLASH) */
+    uint8_t flags;
+    /** @brief The number of bytes used in @ref args */
+    uint16_t argsSize;
+    /** @brief The packed arguments (see RF24LogArgList::pack()) */
+    uint8_t args[RF24LOG_RECORD_ARGS_SIZE];
+#if defined (RF24LOG_HOSTED)
+    /** @brief The thread that logged the message (shown by the `%t` and `%N` header fields) */
+    RF24LogThread thread;
+#endif
+#if defined (RF24LOG_STACK_TRACES)
+    /** @brief The call stack of the message (only valid with the @ref RF24LOG_RECORD_STACK flag) */
+    RF24LogStackTrace stack;
+#endif
+
+    /**
+     * @brief copy a log message into this record.
+     *
+     * This does not allocate memory and does not call any stdio functions, so it is safe
+     * to use in an interrupt (or signal) handler.
+     * @param logLevel The level of the logging message
+     * @param vendorId The prefixed origin of the message
+     * @param message The message format string
+     * @param args The sequence of variables used to replace the format specifiers
+     */
+    void capture(uint8_t logLevel, const char *vendorId, const char *message, va_list *args);
+
+#if defined (ARDUINO_ARCH_AVR)
+    void capture(uint8_t logLevel, const __FlashStringHelper *vendorId, const __FlashStringHelper *message, va_list *args);
+#endif
+};
+
+#endif /* SRC_RF24LOGPARTS_RECORD_H_ */
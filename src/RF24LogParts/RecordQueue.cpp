@@ -0,0 +1,280 @@
+/**
+ * @file RecordQueue.cpp
+ * @date Created 19 Oct 2026
+ * @author Brendan Doherty (2bndy5)
+ * @copyright Copyright (C) <br>
+ *      2026        Brendan Doherty (2bndy5) <br>
+ * This General Public License does not permit incorporating your program into
+ * proprietary programs.  If your program is a subroutine library, you may
+ * consider it more useful to permit linking proprietary applications with the
+ * library.  If this is what you want to do, use the GNU Lesser General
+ * Public License instead of this License.
+ */
+
+#include "RecordQueue.h"
+#if defined (ARDUINO_ARCH_AVR)
+#include <util/atomic.h> // ATOMIC_BLOCK()
+#elif defined (PICO_BUILD)
+#include <hardware/sync.h> // save_and_disable_interrupts(), restore_interrupts()
+#endif
+
+// The queue is Dmitry Vyukov's bounded MPMC design used with a single consumer:
+// each slot's sequence tells producers (sequence == pos) and the consumer
+// (sequence == pos + 1) whose turn it is to use the slot.
+
+#if defined (ARDUINO_ARCH_AVR)
+
+static inline RF24LogQueuePos loadPos(RF24LogAtomicPos *pos)
+{
+    RF24LogQueuePos value;
+    ATOMIC_BLOCK(ATOMIC_RESTORESTATE) { value = *pos; }
+    return value;
+}
+
+static inline void storePos(RF24LogAtomicPos *pos, RF24LogQueuePos value)
+{
+    ATOMIC_BLOCK(ATOMIC_RESTORESTATE) { *pos = value; }
+}
+
+static inline bool casPos(RF24LogAtomicPos *pos, RF24LogQueuePos *expected, RF24LogQueuePos desired)
+{
+    bool result = false;
+    ATOMIC_BLOCK(ATOMIC_RESTORESTATE)
+    {
+        if (*pos == *expected) { *pos = desired; result = true; }
+        else { *expected = *pos; }
+    }
+    return result;
+}
+
+#elif defined (PICO_BUILD)
+
+static inline RF24LogQueuePos loadPos(RF24LogAtomicPos *pos)
+{
+    RF24LogQueuePos value = *pos; // aligned 32-bit loads are atomic
+    __sync_synchronize();
+    return value;
+}
+
+static inline void storePos(RF24LogAtomicPos *pos, RF24LogQueuePos value)
+{
+    __sync_synchronize();
+    *pos = value; // aligned 32-bit stores are atomic
+}
+
+static inline bool casPos(RF24LogAtomicPos *pos, RF24LogQueuePos *expected, RF24LogQueuePos desired)
+{
+    bool result = false;
+    uint32_t irqState = save_and_disable_interrupts();
+    if (*pos == *expected) { *pos = desired; result = true; }
+    else { *expected = *pos; }
+    restore_interrupts(irqState);
+    return result;
+}
+
+#else
+
+static inline RF24LogQueuePos loadPos(RF24LogAtomicPos *pos)
+{
+    return pos->load(std::memory_order_acquire);
+}
+
+static inline void storePos(RF24LogAtomicPos *pos, RF24LogQueuePos value)
+{
+    pos->store(value, std::memory_order_release);
+}
+
+static inline bool casPos(RF24LogAtomicPos *pos, RF24LogQueuePos *expected, RF24LogQueuePos desired)
+{
+    return pos->compare_exchange_weak(*expected, desired, std::memory_order_relaxed);
+}
+
+#endif
+
+/****************************************************************************/
+
+RF24LogRecordQueue::RF24LogRecordQueue(RF24LogRecordSlot *slots, RF24LogQueuePos count)
+{
+    setSlots(slots, count);
+}
+
+/****************************************************************************/
+
+RF24LogRecordQueue::RF24LogRecordQueue()
+{
+    setSlots(nullptr, 0);
+}
+
+/****************************************************************************/
+
+void RF24LogRecordQueue::setSlots(RF24LogRecordSlot *slots, RF24LogQueuePos count, size_t slotSize)
+{
+    // a slot's free and published sequences must differ from the sequence of the next lap
+    _slots = count < 2 ? nullptr : slots;
+    _slotSize = slotSize;
+    RF24LogQueuePos capacity = 1;
+    while (capacity <= count / 2)
+    {
+        capacity <<= 1;
+    }
+    _mask = capacity - 1;
+    for (RF24LogQueuePos i = 0; _slots != nullptr && i < capacity; ++i)
+    {
+        storePos(&slotAt(i)->sequence, i);
+    }
+    storePos(&_head, 0);
+    storePos(&_tail, 0);
+    storePos(&_dropped, 0);
+}
+
+/****************************************************************************/
+
+RF24LogRecordSlot *RF24LogRecordQueue::claim()
+{
+    RF24LogQueuePos pos;
+    RF24LogRecordSlot *slot = tryClaim(&pos);
+    if (slot == nullptr)
+    {
+        RF24LogQueuePos dropped = loadPos(&_dropped);
+        while (!casPos(&_dropped, &dropped, dropped + 1)) {}
+    }
+    return slot;
+}
+
+/****************************************************************************/
+
+RF24LogRecordSlot *RF24LogRecordQueue::tryClaim(RF24LogQueuePos *position)
+{
+    if (_slots == nullptr)
+    {
+        return nullptr;
+    }
+    RF24LogQueuePos pos = loadPos(&_head);
+    while (true)
+    {
+        RF24LogRecordSlot *slot = slotAt(pos);
+        RF24LogQueuePos sequence = loadPos(&slot->sequence);
+        RF24LogQueuePos diff = sequence - pos;
+        if (diff == 0)
+        {
+            if (casPos(&_head, &pos, pos + 1))
+            {
+                *position = pos;
+                return slot;
+            }
+            // pos was updated with the current head; try again
+        }
+        else if (diff & ((RF24LogQueuePos)1 << (sizeof(RF24LogQueuePos) * 8 - 1)))
+        {
+            // sequence is behind pos (diff is negative): the queue is full
+            return nullptr;
+        }
+        else // another producer claimed this slot already
+        {
+            pos = loadPos(&_head);
+        }
+    }
+}
+
+/****************************************************************************/
+
+void RF24LogRecordQueue::publish(RF24LogRecordSlot *slot)
+{
+    // only the producer that claimed the slot can change its sequence now
+    storePos(&slot->sequence, loadPos(&slot->sequence) + 1);
+}
+
+/****************************************************************************/
+
+bool RF24LogRecordQueue::push(uint8_t logLevel, const char *vendorId, const char *message, va_list *args)
+{
+    RF24LogRecordSlot *slot = claim();
+    if (slot == nullptr)
+    {
+        return false;
+    }
+    slot->record.capture(logLevel, vendorId, message, args);
+    publish(slot);
+    return true;
+}
+
+/****************************************************************************/
+
+#if defined (ARDUINO_ARCH_AVR)
+bool RF24LogRecordQueue::push(uint8_t logLevel, const __FlashStringHelper *vendorId, const __FlashStringHelper *message, va_list *args)
+{
+    RF24LogRecordSlot *slot = claim();
+    if (slot == nullptr)
+    {
+        return false;
+    }
+    slot->record.capture(logLevel, vendorId, message, args);
+    publish(slot);
+    return true;
+}
+#endif
+
+/****************************************************************************/
+
+RF24LogRecord *RF24LogRecordQueue::front()
+{
+    RF24LogRecordSlot *slot = frontSlot();
+    return slot == nullptr ? nullptr : &slot->record;
+}
+
+/****************************************************************************/
+
+RF24LogRecordSlot *RF24LogRecordQueue::frontSlot()
+{
+    if (_slots == nullptr)
+    {
+        return nullptr;
+    }
+    RF24LogQueuePos pos = loadPos(&_tail);
+    RF24LogRecordSlot *slot = slotAt(pos);
+    if (loadPos(&slot->sequence) != (RF24LogQueuePos)(pos + 1))
+    {
+        return nullptr; // empty, or the producer hasn't published it yet
+    }
+    return slot;
+}
+
+/****************************************************************************/
+
+void RF24LogRecordQueue::pop()
+{
+    RF24LogQueuePos pos = loadPos(&_tail);
+    release(pos);
+    storePos(&_tail, pos + 1);
+}
+
+/****************************************************************************/
+
+void RF24LogRecordQueue::release(RF24LogQueuePos position)
+{
+    storePos(&slotAt(position)->sequence, position + _mask + 1);
+}
+
+/****************************************************************************/
+
+RF24LogQueuePos RF24LogRecordQueue::claimed()
+{
+    return loadPos(&_head);
+}
+
+/****************************************************************************/
+
+RF24LogQueuePos RF24LogRecordQueue::size()
+{
+    RF24LogQueuePos tail = loadPos(&_tail);
+    RF24LogQueuePos head = loadPos(&_head);
+    RF24LogQueuePos count = head - tail;
+    return count > _mask + 1 ? _mask + 1 : count;
+}
+
+/****************************************************************************/
+
+RF24LogQueuePos RF24LogRecordQueue::dropped()
+{
+    return loadPos(&_dropped);
+}
@@ -0,0 +1,169 @@
+/**
+ * @file RecordQueue.h
+ * @brief A bounded lock-free queue of captured log messages
+ * @date Created 19 Oct 2026
+ * @author Brendan Doherty (2bndy5)
+ * @copyright Copyright (C) <br>
+ *      2026        Brendan Doherty (2bndy5) <br>
+ * This General Public License does not permit incorporating your program into
+ * proprietary programs.  If your program is a subroutine library, you may
+ * consider it more useful to permit linking proprietary applications with the
+ * library.  If this is what you want to do, use the GNU Lesser General
+ * Public License instead of this License.
+ */
+
+#ifndef SRC_RF24LOGPARTS_RECORDQUEUE_H_
+#define SRC_RF24LOGPARTS_RECORDQUEUE_H_
+
+#include <stddef.h>
+#include <stdint.h>
+#include "Record.h"
+
+#if defined (ARDUINO_ARCH_AVR)
+/** @brief A position in the RF24LogRecordQueue (wraps around) */
+typedef uint16_t RF24LogQueuePos;
+/** @brief A position that is shared between interrupts and the main program */
+typedef volatile uint16_t RF24LogAtomicPos;
+#elif defined (PICO_BUILD)
+typedef uint32_t RF24LogQueuePos;
+typedef volatile uint32_t RF24LogAtomicPos;
+#else
+#include <atomic>
+typedef uint32_t RF24LogQueuePos;
+typedef std::atomic<uint32_t> RF24LogAtomicPos;
+#endif
+
+/** @brief A slot of storage in a RF24LogRecordQueue. */
+struct RF24LogRecordSlot
+{
+    /** @brief The slot's turn in the queue (managed by RF24LogRecordQueue) */
+    RF24LogAtomicPos sequence;
+    /** @brief The captured message */
+    RF24LogRecord record;
+};
+
+/**
+ * @brief A statically sized queue of RF24LogRecord objects for many producers and a single consumer.
+ *
+ * Producers never block and never allocate memory; a record is dropped (and counted) when the
+ * queue is full. Only atomic operations are used on hosted platforms, so it is safe to
+ * produce records from POSIX signal handlers. The AVR and Pico SDK builds use very short
+ * critical sections (interrupts disabled for a few instructions) in place of the
+ * compare-and-swap instructions those CPUs lack, so it is safe to produce records from ISRs.
+ *
+ * Handlers that keep more data per message use slots of a type derived from RF24LogRecordSlot
+ * (see the @p slotSize of setSlots()); the consumers that track the positions themselves (like
+ * several consumers that take turns) use slotAt() and release() in place of front() and pop().
+ */
+class RF24LogRecordQueue
+{
+public:
+
+    /**
+     * @brief Instance constructor
+     * @param slots The storage used for the queue. This is usually a static array.
+     * @param count The number of @p slots. Only the largest power of 2 that is not greater
+     * than @p count is used. At least 2 slots are needed; with fewer, every record is dropped.
+     */
+    RF24LogRecordQueue(RF24LogRecordSlot *slots, RF24LogQueuePos count);
+
+    /** @brief Instance constructor of a queue without slots (until setSlots() is called) */
+    RF24LogRecordQueue();
+
+    /**
+     * @brief give the queue its storage (before the queue is used)
+     * @param slots The storage used for the queue, or nullptr for a queue that drops every record
+     * @param count The number of @p slots. Only the largest power of 2 that is not greater
+     * than @p count is used. At least 2 slots are needed; with fewer, every record is dropped.
+     * @param slotSize The size of each slot (for slots of a type derived from RF24LogRecordSlot)
+     */
+    void setSlots(RF24LogRecordSlot *slots, RF24LogQueuePos count, size_t slotSize = sizeof(RF24LogRecordSlot));
+
+    /**
+     * @brief reserve a slot for a producer
+     * @return A slot to fill (then pass to publish()), or nullptr if the queue is full.
+     */
+    RF24LogRecordSlot *claim();
+
+    /**
+     * @brief reserve a slot for a producer, without counting a dropped record if the queue is full
+     * (for the producers that wait for room).
+     * @param position Set to the position of the slot (see slotAt())
+     * @return A slot to fill (then pass to publish()), or nullptr if the queue is full.
+     */
+    RF24LogRecordSlot *tryClaim(RF24LogQueuePos *position);
+
+    /**
+     * @brief make a slot (from claim()) visible to the consumer.
+     * @param slot The filled slot
+     */
+    void publish(RF24LogRecordSlot *slot);
+
+    /**
+     * @brief capture a message into the queue (shortcut for claim(), RF24LogRecord::capture() & publish())
+     * @return true if the message was queued; false if it was dropped.
+     */
+    bool push(uint8_t logLevel, const char *vendorId, const char *message, va_list *args);
+
+#if defined (ARDUINO_ARCH_AVR)
+    bool push(uint8_t logLevel, const __FlashStringHelper *vendorId, const __FlashStringHelper *message, va_list *args);
+#endif
+
+    /**
+     * @brief get the oldest published record (consumer only).
+     * @return The record, or nullptr if the queue is empty.
+     */
+    RF24LogRecord *front();
+
+    /** @brief the slot of the record from front() (or nullptr) */
+    RF24LogRecordSlot *frontSlot();
+
+    /** @brief release the record from front() back to the producers (consumer only). */
+    void pop();
+
+    /**
+     * @brief the slot of a position
+     * @param position A position given by tryClaim() (the positions count up from 0)
+     */
+    inline RF24LogRecordSlot *slotAt(RF24LogQueuePos position)
+    {
+        char *slots = reinterpret_cast<char *>(_slots);
+        return reinterpret_cast<RF24LogRecordSlot *>(slots + (size_t)(position & _mask) * _slotSize);
+    }
+
+    /**
+     * @brief release the slot of a position back to the producers (for the consumers that
+     * track the positions themselves, in place of pop()).
+     * @param position The position of a published slot
+     */
+    void release(RF24LogQueuePos position);
+
+    /** @brief the number of slots claimed so far (the position of the next slot to claim) */
+    RF24LogQueuePos claimed();
+
+    /** @brief the (approximate) number of records waiting in the queue */
+    RF24LogQueuePos size();
+
+    /** @brief the number of slots used by the queue (`0` without slots) */
+    RF24LogQueuePos capacity() { return _slots == nullptr ? 0 : _mask + 1; }
+
+    /** @brief the number of records dropped because the queue was full */
+    RF24LogQueuePos dropped();
+
+private:
+
+    /** @brief The storage */
+    RF24LogRecordSlot *_slots;
+    /** @brief The size of each slot */
+    size_t _slotSize;
+    /** @brief `capacity() - 1` */
+    RF24LogQueuePos _mask;
+    /** @brief The next position to claim */
+    RF24LogAtomicPos _head;
+    /** @brief The next position to consume */
+    RF24LogAtomicPos _tail;
+    /** @brief The number of dropped records */
+    RF24LogAtomicPos _dropped;
+};
+
+#endif /* SRC_RF24LOGPARTS_RECORDQUEUE_H_ */
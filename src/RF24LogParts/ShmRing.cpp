@@ -0,0 +1,321 @@
+/**
+ * @file ShmRing.cpp
+ * @date Created 19 Oct 2026
+ * @author Brendan Doherty (2bndy5)
+ * @copyright Copyright (C) <br>
+ *      2026        Brendan Doherty (2bndy5) <br>
+ * This General Public License does not permit incorporating your program into
+ * proprietary programs.  If your program is a subroutine library, you may
+ * consider it more useful to permit linking proprietary applications with the
+ * library.  If this is what you want to do, use the GNU Lesser General
+ * Public License instead of this License.
+ */
+
+#include "ShmRing.h"
+
+#if defined (RF24LOG_POSIX)
+#include <errno.h>    // errno, EPERM
+#include <fcntl.h>    // O_* constants
+#include <new>        // placement new
+#include <signal.h>   // kill()
+#include <sys/mman.h> // shm_open(), shm_unlink(), mmap(), munmap()
+#include <sys/stat.h> // fstat()
+#include <unistd.h>   // ftruncate(), close(), getpid()
+#include "Memory.h"
+
+static_assert(std::atomic<uint64_t>::is_always_lock_free, "RF24LogShmRing needs lock-free 64-bit atomics");
+
+/****************************************************************************/
+
+RF24LogShmRing::RF24LogShmRing()
+{
+    _header = nullptr;
+    _slots = nullptr;
+    _stride = 0;
+    _mask = 0;
+    _mappedSize = 0;
+    _isWriter = false;
+}
+
+/****************************************************************************/
+
+RF24LogShmRing::~RF24LogShmRing()
+{
+    close();
+}
+
+/****************************************************************************/
+
+/** @brief the bytes used by a slot (including its data) */
+static size_t slotStride(uint32_t slotSize)
+{
+    return (sizeof(RF24LogShmSlot) + slotSize + 7) & ~(size_t)7;
+}
+
+/****************************************************************************/
+
+bool RF24LogShmRing::map(int fd, size_t size)
+{
+    void *memory = mmap(nullptr, size, PROT_READ | PROT_WRITE, MAP_SHARED, fd, 0);
+    ::close(fd);
+    if (memory == MAP_FAILED)
+    {
+        return false;
+    }
+    _header = static_cast<RF24LogShmHeader *>(memory);
+    _slots = static_cast<uint8_t *>(memory) + sizeof(RF24LogShmHeader);
+    _mappedSize = size;
+    return true;
+}
+
+/****************************************************************************/
+
+bool RF24LogShmRing::create(const char *name, uint32_t slotCount, uint32_t slotSize)
+{
+    close();
+    if (slotCount < 2 || slotSize < sizeof(RF24LogShmRecord) || slotSize > UINT16_MAX)
+    {
+        return false;
+    }
+    while (slotCount & (slotCount - 1))
+    {
+        slotCount &= slotCount - 1; // use the largest power of 2 that fits
+    }
+    size_t size = sizeof(RF24LogShmHeader) + slotStride(slotSize) * slotCount;
+
+    // the ring counts against the memory budget (it isn't made smaller: the readers expect its geometry)
+    size_t reserved = size;
+    if (!RF24LogMemory::reserve(&reserved, size))
+    {
+        return false;
+    }
+    int fd = shm_open(name, O_RDWR | O_CREAT, 0660);
+    if (fd < 0)
+    {
+        RF24LogMemory::unreserve(size);
+        return false;
+    }
+    struct stat info;
+    bool existing = fstat(fd, &info) == 0 && (size_t)info.st_size == size;
+    if (!existing && ftruncate(fd, (off_t)size) != 0)
+    {
+        ::close(fd);
+        RF24LogMemory::unreserve(size);
+        return false;
+    }
+    if (!map(fd, size))
+    {
+        RF24LogMemory::unreserve(size);
+        return false;
+    }
+    _stride = slotStride(slotSize);
+    _mask = slotCount - 1;
+    _isWriter = true;
+
+    RF24LogShmHeader *header = _header;
+    if (existing
+        && header->magic.load(std::memory_order_acquire) == RF24LOG_SHM_MAGIC
+        && header->version == RF24LOG_SHM_VERSION
+        && header->slotCount == slotCount
+        && header->slotSize == slotSize)
+    {
+        uint64_t head = header->head.load(std::memory_order_acquire);
+        uint64_t tail = header->tail.load(std::memory_order_acquire);
+        if (tail <= head && head - tail <= slotCount)
+        {
+            // keep the unread records; any slot the previous writer claimed but didn't publish is abandoned
+            header->abandonedBefore.store(head, std::memory_order_release);
+            header->writerPid.store((int32_t)getpid(), std::memory_order_release);
+            return true;
+        }
+    }
+
+    // (re)initialize the ring
+    header->magic.store(0, std::memory_order_relaxed);
+    header = new (_header) RF24LogShmHeader();
+    header->version = RF24LOG_SHM_VERSION;
+    header->slotCount = slotCount;
+    header->slotSize = slotSize;
+    header->writerPid.store((int32_t)getpid(), std::memory_order_relaxed);
+    header->head.store(0, std::memory_order_relaxed);
+    header->tail.store(0, std::memory_order_relaxed);
+    header->abandonedBefore.store(0, std::memory_order_relaxed);
+    header->dropped.store(0, std::memory_order_relaxed);
+    header->lost.store(0, std::memory_order_relaxed);
+    for (uint64_t i = 0; i < slotCount; ++i)
+    {
+        new (&slotAt(i)->sequence) std::atomic<uint64_t>(i);
+    }
+    header->magic.store(RF24LOG_SHM_MAGIC, std::memory_order_release);
+    return true;
+}
+
+/****************************************************************************/
+
+bool RF24LogShmRing::attach(const char *name)
+{
+    close();
+    int fd = shm_open(name, O_RDWR, 0);
+    if (fd < 0)
+    {
+        return false;
+    }
+    struct stat info;
+    if (fstat(fd, &info) != 0 || (size_t)info.st_size < sizeof(RF24LogShmHeader))
+    {
+        ::close(fd);
+        return false;
+    }
+    if (!map(fd, (size_t)info.st_size))
+    {
+        return false;
+    }
+    uint32_t slotCount = _header->slotCount;
+    if (_header->magic.load(std::memory_order_acquire) != RF24LOG_SHM_MAGIC
+        || _header->version != RF24LOG_SHM_VERSION
+        || slotCount == 0 || (slotCount & (slotCount - 1))
+        || sizeof(RF24LogShmHeader) + slotStride(_header->slotSize) * slotCount != _mappedSize)
+    {
+        close();
+        return false;
+    }
+    _stride = slotStride(_header->slotSize);
+    _mask = slotCount - 1;
+    _isWriter = false;
+    return true;
+}
+
+/****************************************************************************/
+
+void RF24LogShmRing::close()
+{
+    if (_header == nullptr)
+    {
+        return;
+    }
+    if (_isWriter)
+    {
+        _header->writerPid.store(0, std::memory_order_release);
+        RF24LogMemory::unreserve(_mappedSize);
+    }
+    munmap(_header, _mappedSize);
+    _header = nullptr;
+    _slots = nullptr;
+}
+
+/****************************************************************************/
+
+bool RF24LogShmRing::unlink(const char *name)
+{
+    return shm_unlink(name) == 0;
+}
+
+/****************************************************************************/
+
+RF24LogShmSlot *RF24LogShmRing::claim()
+{
+    uint64_t pos = _header->head.load(std::memory_order_relaxed);
+    while (true)
+    {
+        RF24LogShmSlot *slot = slotAt(pos);
+        uint64_t sequence = slot->sequence.load(std::memory_order_acquire);
+        int64_t diff = (int64_t)(sequence - pos);
+        if (diff == 0)
+        {
+            if (_header->head.compare_exchange_weak(pos, pos + 1, std::memory_order_relaxed))
+            {
+                return slot;
+            }
+        }
+        else if (diff < 0)
+        {
+            _header->dropped.fetch_add(1, std::memory_order_relaxed);
+            return nullptr; // full
+        }
+        else
+        {
+            pos = _header->head.load(std::memory_order_relaxed);
+        }
+    }
+}
+
+/****************************************************************************/
+
+void RF24LogShmRing::publish(RF24LogShmSlot *slot, uint16_t length, uint8_t type, uint8_t logLevel)
+{
+    slot->length = length;
+    slot->type = type;
+    slot->logLevel = logLevel;
+    // the sequence is still the claimed position
+    slot->sequence.store(slot->sequence.load(std::memory_order_relaxed) + 1, std::memory_order_release);
+}
+
+/****************************************************************************/
+
+RF24LogShmSlot *RF24LogShmRing::front()
+{
+    while (true)
+    {
+        uint64_t pos = _header->tail.load(std::memory_order_relaxed);
+        RF24LogShmSlot *slot = slotAt(pos);
+        uint64_t sequence = slot->sequence.load(std::memory_order_acquire);
+        if (sequence == pos + 1)
+        {
+            return slot;
+        }
+        if (sequence != pos || pos >= _header->head.load(std::memory_order_acquire))
+        {
+            return nullptr; // empty
+        }
+        // the slot was claimed but not published yet; skip it if its writer is gone
+        if (pos >= _header->abandonedBefore.load(std::memory_order_acquire) && isWriterAlive())
+        {
+            return nullptr;
+        }
+        slot->sequence.store(pos + _mask + 1, std::memory_order_release);
+        _header->tail.store(pos + 1, std::memory_order_release);
+        _header->lost.fetch_add(1, std::memory_order_relaxed);
+    }
+}
+
+/****************************************************************************/
+
+void RF24LogShmRing::pop()
+{
+    uint64_t pos = _header->tail.load(std::memory_order_relaxed);
+    slotAt(pos)->sequence.store(pos + _mask + 1, std::memory_order_release);
+    _header->tail.store(pos + 1, std::memory_order_release);
+}
+
+/****************************************************************************/
+
+uint64_t RF24LogShmRing::size()
+{
+    uint64_t tail = _header->tail.load(std::memory_order_acquire);
+    uint64_t head = _header->head.load(std::memory_order_acquire);
+    return head > tail ? head - tail : 0;
+}
+
+/****************************************************************************/
+
+uint64_t RF24LogShmRing::dropped()
+{
+    return _header->dropped.load(std::memory_order_relaxed);
+}
+
+/****************************************************************************/
+
+uint64_t RF24LogShmRing::lost()
+{
+    return _header->lost.load(std::memory_order_relaxed);
+}
+
+/****************************************************************************/
+
+bool RF24LogShmRing::isWriterAlive()
+{
+    int32_t pid = _header->writerPid.load(std::memory_order_acquire);
+    return pid != 0 && (kill(pid, 0) == 0 || errno == EPERM);
+}
+
+#endif // defined (RF24LOG_POSIX)
@@ -0,0 +1,216 @@
+/**
+ * @file ShmRing.h
+ * @brief A ring of log records in POSIX shared memory
+ * @date Created 19 Oct 2026
+ * @author Brendan Doherty (2bndy5)
+ * @copyright Copyright (C) <br>
+ *      2026        Brendan Doherty (2bndy5) <br>
+ * This General Public License does not permit incorporating your program into
+ * proprietary programs.  If your program is a subroutine library, you may
+ * consider it more useful to permit linking proprietary applications with the
+ * library.  If this is what you want to do, use the GNU Lesser General
+ * Public License instead of this License.
+ */
+
+#ifndef SRC_RF24LOGPARTS_SHMRING_H_
+#define SRC_RF24LOGPARTS_SHMRING_H_
+
+#include "Common.h" // RF24LOG_POSIX, RF24LogTime
+
+#if defined (RF24LOG_POSIX)
+#include <stddef.h>
+#include <stdint.h>
+#include <atomic>
+
+/** @brief The first bytes of a RF24LogShmRing ("RF24") */
+#define RF24LOG_SHM_MAGIC 0x34324652
+/** @brief The version of the RF24LogShmRing layout */
+#define RF24LOG_SHM_VERSION 1
+
+/** @brief RF24LogShmSlot::type: the slot holds formatted text */
+#define RF24LOG_SHM_TEXT 1
+/** @brief RF24LogShmSlot::type: the slot holds a RF24LogShmRecord */
+#define RF24LOG_SHM_BINARY 2
+
+/** @brief The control block at the start of the shared memory */
+struct RF24LogShmHeader
+{
+    /** @brief @ref RF24LOG_SHM_MAGIC (written last when initializing) */
+    std::atomic<uint32_t> magic;
+    /** @brief @ref RF24LOG_SHM_VERSION */
+    uint32_t version;
+    /** @brief The number of slots (a power of 2) */
+    uint32_t slotCount;
+    /** @brief The number of data bytes in each slot */
+    uint32_t slotSize;
+    /** @brief The process that writes the ring (0 after it closed the ring) */
+    std::atomic<int32_t> writerPid;
+    /** @brief The next position to claim (producers) */
+    alignas(64) std::atomic<uint64_t> head;
+    /** @brief The next position to consume (consumer) */
+    alignas(64) std::atomic<uint64_t> tail;
+    /** @brief Positions before this were claimed by a previous writer process */
+    alignas(64) std::atomic<uint64_t> abandonedBefore;
+    /** @brief The number of records dropped because the ring was full */
+    std::atomic<uint64_t> dropped;
+    /** @brief The number of records lost because their writer died while writing them */
+    std::atomic<uint64_t> lost;
+};
+
+/** @brief A slot in the RF24LogShmRing (followed by RF24LogShmHeader::slotSize bytes of data) */
+struct RF24LogShmSlot
+{
+    /** @brief The slot's turn in the ring */
+    std::atomic<uint64_t> sequence;
+    /** @brief The number of data bytes used */
+    uint16_t length;
+    /** @brief @ref RF24LOG_SHM_TEXT or @ref RF24LOG_SHM_BINARY */
+    uint8_t type;
+    /** @brief The level of the logging message */
+    uint8_t logLevel;
+    uint32_t reserved;
+
+    /** @brief The slot's data */
+    inline char *data() { return reinterpret_cast<char *>(this + 1); }
+};
+
+/**
+ * @brief A captured log message as stored in a @ref RF24LOG_SHM_BINARY slot.
+ *
+ * This is followed by the null-terminated vendorId, the null-terminated message, and the
+ * packed arguments (see RF24LogArgList::pack()).
+ */
+struct RF24LogShmRecord
+{
+    /** @brief The time (see rf24LogNow()) at which the message was logged */
+    RF24LogTime timestamp;
+    /** @brief The level of the logging message */
+    uint8_t logLevel;
+    /** @brief Copied from RF24LogRecord::flags */
+    uint8_t flags;
+    /** @brief The length of the vendorId (excluding the null terminator) */
+    uint16_t vendorLength;
+    /** @brief The length of the message (excluding the null terminator) */
+    uint16_t messageLength;
+    /** @brief The number of bytes of packed arguments */
+    uint16_t argsSize;
+
+    /** @brief The vendorId */
+    inline const char *vendorId() const { return reinterpret_cast<const char *>(this + 1); }
+    /** @brief The message format string */
+    inline const char *message() const { return vendorId() + vendorLength + 1; }
+    /** @brief The packed arguments */
+    inline const uint8_t *args() const { return reinterpret_cast<const uint8_t *>(message() + messageLength + 1); }
+};
+
+/**
+ * @brief A ring of log records in POSIX shared memory, written by the threads of 1 process
+ * and read by another process.
+ *
+ * Writing uses only atomic operations on the shared memory (no system calls), like
+ * RF24LogRecordQueue. The positions live in the shared memory, so:
+ * - records published by a process that crashed remain readable;
+ * - a consumer that restarts resumes where the previous one stopped;
+ * - a record that was claimed but never published (its writer died) is skipped by the
+ *   consumer once the writer process is gone or a new writer process has opened the ring.
+ */
+class RF24LogShmRing
+{
+public:
+
+    RF24LogShmRing();
+    ~RF24LogShmRing();
+
+    /**
+     * @brief open (or create) a ring as its writer.
+     *
+     * An existing ring with the same geometry keeps its unread records.
+     * @param name The POSIX shared memory object's name (like `"/rf24log"`)
+     * @param slotCount The number of records the ring can hold (rounded down to a power of 2)
+     * @param slotSize The maximum number of bytes per record
+     * @return true if the ring is ready to use (false if it doesn't fit in the RF24LogMemory budget)
+     */
+    bool create(const char *name, uint32_t slotCount, uint32_t slotSize);
+
+    /**
+     * @brief open an existing ring as its consumer.
+     * @param name The POSIX shared memory object's name
+     * @return true if the ring is ready to use
+     */
+    bool attach(const char *name);
+
+    /** @brief unmap the ring (the writer also marks the ring as closed) */
+    void close();
+
+    /** @brief is the ring open? */
+    inline bool isOpen() { return _header != nullptr; }
+
+    /** @brief The maximum number of bytes per record */
+    inline uint32_t slotSize() { return _header->slotSize; }
+
+    /**
+     * @brief reserve a slot (writer)
+     * @return A slot to fill (then pass to publish()), or nullptr if the ring is full.
+     */
+    RF24LogShmSlot *claim();
+
+    /**
+     * @brief make a slot (from claim()) visible to the consumer (writer)
+     * @param slot The filled slot
+     * @param length The number of data bytes used
+     * @param type @ref RF24LOG_SHM_TEXT or @ref RF24LOG_SHM_BINARY
+     * @param logLevel The level of the logging message
+     */
+    void publish(RF24LogShmSlot *slot, uint16_t length, uint8_t type, uint8_t logLevel);
+
+    /**
+     * @brief get the oldest published record (consumer)
+     * @return The slot, or nullptr if there is nothing to read yet.
+     */
+    RF24LogShmSlot *front();
+
+    /** @brief release the slot from front() back to the writer (consumer) */
+    void pop();
+
+    /** @brief the (approximate) number of records waiting in the ring */
+    uint64_t size();
+
+    /** @brief the number of records dropped because the ring was full */
+    uint64_t dropped();
+
+    /** @brief the number of records lost because their writer died while writing them */
+    uint64_t lost();
+
+    /** @brief is the writer process running? */
+    bool isWriterAlive();
+
+    /** @brief remove a ring's name (the memory is freed once every process unmapped it) */
+    static bool unlink(const char *name);
+
+private:
+
+    /** @brief map the shared memory object */
+    bool map(int fd, size_t size);
+
+    /** @brief get the slot of a position */
+    inline RF24LogShmSlot *slotAt(uint64_t pos)
+    {
+        return reinterpret_cast<RF24LogShmSlot *>(_slots + (pos & _mask) * _stride);
+    }
+
+    /** @brief The mapped control block (followed by the slots) */
+    RF24LogShmHeader *_header;
+    /** @brief The first slot */
+    uint8_t *_slots;
+    /** @brief The size of a slot including its data */
+    size_t _stride;
+    /** @brief `slotCount - 1` */
+    uint64_t _mask;
+    /** @brief The size of the mapping */
+    size_t _mappedSize;
+    /** @brief Was the ring opened with create()? */
+    bool _isWriter;
+};
+
+#endif // defined (RF24LOG_POSIX)
+#endif /* SRC_RF24LOGPARTS_SHMRING_H_ */
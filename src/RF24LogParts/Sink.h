@@ -0,0 +1,46 @@
+/**
+ * @file Sink.h
+ * @brief abstract class for outputs that take whole formatted log messages
+ * @date Created 19 Oct 2026
+ * @author Brendan Doherty (2bndy5)
+ * @copyright Copyright (C) <br>
+ *      2026        Brendan Doherty (2bndy5) <br>
+ * This General Public License does not permit incorporating your program into
+ * proprietary programs.  If your program is a subroutine library, you may
+ * consider it more useful to permit linking proprietary applications with the
+ * library.  If this is what you want to do, use the GNU Lesser General
+ * Public License instead of this License.
+ */
+
+#ifndef SRC_RF24LOGPARTS_SINK_H_
+#define SRC_RF24LOGPARTS_SINK_H_
+
+#include <stddef.h>
+#include <stdint.h>
+
+/**
+ * @brief A destination for formatted log messages (a file, a socket, another sink...).
+ *
+ * Each call to write() passes exactly 1 whole log message (a record), so a sink can
+ * batch, compress or frame the records without ever splitting one. Sinks are used with
+ * a SinkLogger.
+ */
+class RF24LogSink
+{
+public:
+
+    /**
+     * @brief output 1 formatted log message.
+     *
+     * Implementations must be safe to call from many threads at once.
+     * @param data The formatted message (not null-terminated)
+     * @param length The number of bytes in @p data
+     * @param logLevel The level of the logging message
+     */
+    virtual void write(const char *data, size_t length, uint8_t logLevel) = 0;
+
+    /** @brief output any buffered messages now */
+    virtual void flush() {}
+};
+
+#endif /* SRC_RF24LOGPARTS_SINK_H_ */
@@ -0,0 +1,167 @@
+/**
+ * @file StackTrace.cpp
+ * @date Created 19 Oct 2026
+ * @author Brendan Doherty (2bndy5)
+ * @copyright Copyright (C) <br>
+ *      2026        Brendan Doherty (2bndy5) <br>
+ * This General Public License does not permit incorporating your program into
+ * proprietary programs.  If your program is a subroutine library, you may
+ * consider it more useful to permit linking proprietary applications with the
+ * library.  If this is what you want to do, use the GNU Lesser General
+ * Public License instead of this License.
+ */
+
+#include "StackTrace.h"
+
+#if defined (RF24LOG_STACK_TRACES)
+#include <dlfcn.h>    // dladdr()
+#include <inttypes.h> // PRIxPTR
+#include <stdio.h>    // snprintf()
+#include <stdlib.h>   // free()
+#include <string.h>   // strstr()
+#include <cxxabi.h>   // abi::__cxa_demangle()
+#if defined (RF24LOG_STACK_UNWINDER)
+#include <unwind.h>   // _Unwind_Backtrace()
+#endif
+
+std::atomic<uint8_t> RF24LogStackTrace::s_logLevel(0);
+std::atomic<uint8_t> RF24LogStackTrace::s_depth(RF24LOG_STACK_DEPTH);
+
+/****************************************************************************/
+
+#if defined (RF24LOG_STACK_UNWINDER)
+/** @brief The state of a walk of the unwinder */
+struct RF24LogStackWalk
+{
+    RF24LogStackTrace *trace;
+    uint8_t maxDepth;
+    /** @brief Was the frame of capture() itself skipped? */
+    bool skipped;
+};
+
+/** @brief store the return address of 1 frame */
+static _Unwind_Reason_Code rf24LogStackStep(struct _Unwind_Context *context, void *arg)
+{
+    RF24LogStackWalk *walk = (RF24LogStackWalk *)arg;
+    if (!walk->skipped)
+    {
+        walk->skipped = true;
+        return _URC_NO_REASON;
+    }
+    uintptr_t address = _Unwind_GetIP(context);
+    if (!address || walk->trace->depth >= walk->maxDepth)
+    {
+        return _URC_END_OF_STACK;
+    }
+    walk->trace->frames[walk->trace->depth++] = (void *)address;
+    return _URC_NO_REASON;
+}
+#endif
+
+/****************************************************************************/
+
+void RF24LogStackTrace::capture()
+{
+    uint8_t maxDepth = s_depth.load(std::memory_order_relaxed);
+    depth = 0;
+#if !defined (RF24LOG_STACK_UNWINDER)
+    // each frame record holds the caller's frame pointer, then the return address
+    void **frame = (void **)__builtin_frame_address(0);
+    while (frame != nullptr && depth < maxDepth)
+    {
+        void *address = frame[1];
+        if (address == nullptr)
+        {
+            break;
+        }
+        frames[depth++] = address;
+        void **caller = (void **)frame[0];
+        // the stack grows down; anything else is the end of the chain (or a frame without one)
+        if (caller <= frame || (uintptr_t)caller - (uintptr_t)frame > 0x100000
+            || ((uintptr_t)caller & (sizeof(void *) - 1)))
+        {
+            break;
+        }
+        frame = caller;
+    }
+#else
+    RF24LogStackWalk walk = {this, maxDepth, false};
+    _Unwind_Backtrace(rf24LogStackStep, &walk);
+#endif
+}
+
+/****************************************************************************/
+
+size_t RF24LogStackTrace::format(char *buffer, size_t size) const
+{
+    if (!size)
+    {
+        return 0;
+    }
+    size_t length = 0;
+    unsigned shown = 0;
+    buffer[0] = 0;
+    for (uint8_t i = 0; i < depth; ++i)
+    {
+        uintptr_t address = (uintptr_t)frames[i];
+        // a return address follows the call, which may be the last instruction of a function
+        uintptr_t call = address - 1;
+        Dl_info info;
+        bool found = dladdr((void *)call, &info) != 0;
+        const char *name = nullptr;
+        char *demangled = nullptr;
+        if (found && info.dli_sname != nullptr)
+        {
+            int status;
+            demangled = abi::__cxa_demangle(info.dli_sname, nullptr, nullptr, &status);
+            name = demangled != nullptr ? demangled : info.dli_sname;
+        }
+        if (!shown && name != nullptr && strstr(name, "RF24Log") != nullptr)
+        {
+            free(demangled);
+            continue; // a frame of the logging itself
+        }
+
+        int written;
+        if (name != nullptr)
+        {
+            written = snprintf(buffer + length, size - length, "    #%u 0x%" PRIxPTR " in %s+0x%" PRIxPTR " (%s+0x%" PRIxPTR ")\n",
+                               shown, address, name, address - (uintptr_t)info.dli_saddr,
+                               info.dli_fname, call - (uintptr_t)info.dli_fbase);
+        }
+        else if (found)
+        {
+            written = snprintf(buffer + length, size - length, "    #%u 0x%" PRIxPTR " (%s+0x%" PRIxPTR ")\n",
+                               shown, address, info.dli_fname, call - (uintptr_t)info.dli_fbase);
+        }
+        else
+        {
+            written = snprintf(buffer + length, size - length, "    #%u 0x%" PRIxPTR "\n", shown, address);
+        }
+        free(demangled);
+        if (written < 0 || (size_t)written >= size - length)
+        {
+            buffer[length] = 0; // this line doesn't fit
+            break;
+        }
+        length += (size_t)written;
+        ++shown;
+    }
+    return length;
+}
+
+/****************************************************************************/
+
+void RF24LogStackTrace::setLevel(uint8_t logLevel, uint8_t maxDepth)
+{
+    if (logLevel)
+    {
+        // the unwinder allocates its caches on its first use, so not while capturing
+        RF24LogStackTrace warmUp;
+        warmUp.capture();
+    }
+    s_depth.store(maxDepth < RF24LOG_STACK_DEPTH ? maxDepth : RF24LOG_STACK_DEPTH, std::memory_order_relaxed);
+    s_logLevel.store(logLevel, std::memory_order_relaxed);
+}
+
+#endif // defined (RF24LOG_STACK_TRACES)
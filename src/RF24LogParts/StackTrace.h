@@ -0,0 +1,122 @@
+/**
+ * @file StackTrace.h
+ * @brief The return addresses of a call stack, captured with a log message
+ * @date Created 19 Oct 2026
+ * @author Brendan Doherty (2bndy5)
+ * @copyright Copyright (C) <br>
+ *      2026        Brendan Doherty (2bndy5) <br>
+ * This General Public License does not permit incorporating your program into
+ * proprietary programs.  If your program is a subroutine library, you may
+ * consider it more useful to permit linking proprietary applications with the
+ * library.  If this is what you want to do, use the GNU Lesser General
+ * Public License instead of this License.
+ */
+
+#ifndef SRC_RF24LOGPARTS_STACKTRACE_H_
+#define SRC_RF24LOGPARTS_STACKTRACE_H_
+
+#include <stddef.h>
+#include <stdint.h>
+#include "Common.h" // RF24LOG_POSIX
+
+/** @brief The maximum number of return addresses stored with a captured message */
+#if !defined(RF24LOG_STACK_DEPTH)
+#define RF24LOG_STACK_DEPTH 16
+#endif
+
+/** @brief The size of the buffer that a stack trace is symbolized into (for output) */
+#if !defined(RF24LOG_STACK_TEXT_SIZE)
+#define RF24LOG_STACK_TEXT_SIZE 4096
+#endif
+
+#ifdef DOXYGEN_FORCED
+/**
+ * @brief macro (when defined) captures stack traces with the log messages (on POSIX platforms).
+ *
+ * This adds a RF24LogStackTrace to RF24LogRecord, so it must be defined for the RF24Log lib
+ * and for the code that uses it (like the `RF24LOG_STACK_TRACES` option of the CMake builds).
+ * The stack is walked with the frame pointers, so all of the code should be compiled with
+ * `-fno-omit-frame-pointer`.
+ */
+#define RF24LOG_STACK_TRACES
+
+/**
+ * @brief macro (when defined) walks the stack with the compiler's unwinder, which doesn't need
+ * the frame pointers but is slower
+ */
+#define RF24LOG_STACK_UNWINDER
+#endif
+
+#if defined (RF24LOG_STACK_TRACES) && !(defined (RF24LOG_POSIX) && defined (__GNUC__) && RF24LOG_STACK_DEPTH > 0)
+#undef RF24LOG_STACK_TRACES
+#endif
+
+#if defined (RF24LOG_STACK_TRACES)
+#include <atomic>
+
+/**
+ * @brief The raw return addresses of the call stack of a log message.
+ *
+ * Capturing a trace only walks the stack: with the frame pointers that costs tens of
+ * nanoseconds, and with the compiler's unwinder (if @ref RF24LOG_STACK_UNWINDER is defined) a
+ * few hundred nanoseconds per frame. The addresses are only turned into names when the trace is
+ * output by format(), so that cost (microseconds per frame) is paid by the thread that outputs
+ * the message.
+ *
+ * Stack traces are captured for the levels enabled with setLevel(), by RF24LogRecord::capture()
+ * (so by the handlers that capture messages, like RF24LogIsrHandler), and by the loggers that
+ * output messages at once (which symbolize them at once). They are output by the loggers as
+ * extra lines after the message.
+ */
+struct RF24LogStackTrace
+{
+    /** @brief The number of return addresses in @ref frames */
+    uint8_t depth;
+    /** @brief The return addresses (the caller of capture() first) */
+    void *frames[RF24LOG_STACK_DEPTH];
+
+    /**
+     * @brief store the return addresses of the calling thread's stack.
+     *
+     * This does not allocate memory, so it is safe to use in a signal handler (once setLevel()
+     * was called).
+     */
+    void capture();
+
+    /**
+     * @brief symbolize the trace into lines of text, 1 line per frame.
+     *
+     * Each line shows the address, the function (if the module exports its name; link an
+     * executable with `-rdynamic` to export its own functions) and the module with the offset
+     * of the call, which an offline tool can resolve (like `addr2line -e <module> <offset>`).
+     * The leading frames of the RF24Log lib itself are omitted.
+     * @param buffer The destination (null-terminated)
+     * @param size The size of the @p buffer
+     * @return The number of bytes written to the @p buffer (not counting the null terminator).
+     * The lines that don't fit are omitted.
+     */
+    size_t format(char *buffer, size_t size) const;
+
+    /**
+     * @brief set the levels and the depth of the stack traces captured with log messages
+     * @param logLevel The least severe level that is captured with a stack trace (like
+     * `RF24LogLevel::ERROR + 7` for the errors only). Use `0` to disable the stack traces (the
+     * default).
+     * @param maxDepth The maximum number of return addresses stored (up to @ref RF24LOG_STACK_DEPTH)
+     */
+    static void setLevel(uint8_t logLevel, uint8_t maxDepth = RF24LOG_STACK_DEPTH);
+
+    /** @brief is a message of the level captured with a stack trace? */
+    static inline bool isCaptured(uint8_t logLevel)
+    {
+        return logLevel && logLevel <= s_logLevel.load(std::memory_order_relaxed);
+    }
+
+private:
+
+    static std::atomic<uint8_t> s_logLevel;
+    static std::atomic<uint8_t> s_depth;
+};
+
+#endif // defined (RF24LOG_STACK_TRACES)
+#endif /* SRC_RF24LOGPARTS_STACKTRACE_H_ */
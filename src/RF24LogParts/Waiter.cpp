@@ -0,0 +1,127 @@
+/**
+ * @file Waiter.cpp
+ * @date Created 19 Oct 2026
+ * @author Brendan Doherty (2bndy5)
+ * @copyright Copyright (C) <br>
+ *      2026        Brendan Doherty (2bndy5) <br>
+ * This General Public License does not permit incorporating your program into
+ * proprietary programs.  If your program is a subroutine library, you may
+ * consider it more useful to permit linking proprietary applications with the
+ * library.  If this is what you want to do, use the GNU Lesser General
+ * Public License instead of this License.
+ */
+
+#include "Waiter.h"
+
+#if defined (RF24LOG_POSIX)
+#include <sched.h>  // sched_yield()
+#include <time.h>   // struct timespec
+#include <unistd.h> // usleep()
+#if defined (__linux__)
+#include <pthread.h>     // pthread_setaffinity_np()
+#include <linux/futex.h> // FUTEX_WAIT_PRIVATE, FUTEX_WAKE_PRIVATE
+#include <sys/syscall.h> // SYS_futex
+#endif
+
+/****************************************************************************/
+
+RF24LogWaiter::RF24LogWaiter(uint8_t strategy, uint32_t interval, uint32_t batch)
+    : _strategy(strategy), _interval(interval), _batch(batch ? batch : 1), _epoch(0), _pending(0), _sleeping(false)
+{
+    if (_strategy == RF24LOG_WAIT_POLL && !_interval)
+    {
+        _interval = 1000;
+    }
+#if defined (__linux__)
+    if (_strategy == RF24LOG_WAIT_SLEEP && !_interval && _batch > 1)
+    {
+        _interval = 100000; // an incomplete batch waits 100 ms at most
+    }
+#else
+    if (_strategy == RF24LOG_WAIT_SLEEP && !_interval)
+    {
+        _interval = 1000;
+    }
+#endif
+}
+
+/****************************************************************************/
+
+void RF24LogWaiter::notify(bool urgent)
+{
+    if (_strategy != RF24LOG_WAIT_SLEEP)
+    {
+        return; // the consumer is checking for messages by itself
+    }
+    // order the publication of the message before the load of _sleeping (this pairs with the
+    // fence after the consumer's store to _sleeping)
+    std::atomic_thread_fence(std::memory_order_seq_cst);
+    if (!_sleeping.load(std::memory_order_relaxed))
+    {
+        return; // the consumer checks for messages before it sleeps
+    }
+    if (!urgent && _pending.fetch_add(1, std::memory_order_relaxed) + 1 < _batch)
+    {
+        return; // the consumer is woken by the last message of the batch (or the interval)
+    }
+    _epoch.fetch_add(1, std::memory_order_seq_cst);
+#if defined (__linux__)
+    syscall(SYS_futex, reinterpret_cast<uint32_t *>(&_epoch), FUTEX_WAKE_PRIVATE, 1, nullptr, nullptr, 0);
+#endif
+}
+
+/****************************************************************************/
+
+void RF24LogWaiter::sleep(uint32_t epoch)
+{
+#if defined (__linux__)
+    struct timespec timeout = {(time_t)(_interval / 1000000), (long)(_interval % 1000000) * 1000};
+    syscall(SYS_futex, reinterpret_cast<uint32_t *>(&_epoch), FUTEX_WAIT_PRIVATE, epoch,
+            _interval ? &timeout : nullptr, nullptr, 0);
+#else
+    (void)epoch;
+    pause();
+#endif
+}
+
+/****************************************************************************/
+
+void RF24LogWaiter::pause()
+{
+    usleep(_interval);
+}
+
+/****************************************************************************/
+
+void RF24LogWaiter::relax()
+{
+#if defined (__x86_64__) || defined (__i386__)
+    __builtin_ia32_pause();
+#elif defined (__aarch64__)
+    __asm__ __volatile__("yield");
+#endif
+}
+
+/****************************************************************************/
+
+void RF24LogWaiter::yield()
+{
+    sched_yield();
+}
+
+/****************************************************************************/
+
+bool RF24LogWaiter::pinThread(int cpu)
+{
+#if defined (__linux__)
+    cpu_set_t set;
+    CPU_ZERO(&set);
+    CPU_SET(cpu, &set);
+    return pthread_setaffinity_np(pthread_self(), sizeof(set), &set) == 0;
+#else
+    (void)cpu;
+    return false;
+#endif
+}
+
+#endif // defined (RF24LOG_POSIX)
@@ -0,0 +1,153 @@
+/**
+ * @file Waiter.h
+ * @brief How a background thread waits for log messages to consume
+ * @date Created 19 Oct 2026
+ * @author Brendan Doherty (2bndy5)
+ * @copyright Copyright (C) <br>
+ *      2026        Brendan Doherty (2bndy5) <br>
+ * This General Public License does not permit incorporating your program into
+ * proprietary programs.  If your program is a subroutine library, you may
+ * consider it more useful to permit linking proprietary applications with the
+ * library.  If this is what you want to do, use the GNU Lesser General
+ * Public License instead of this License.
+ */
+
+#ifndef SRC_RF24LOGPARTS_WAITER_H_
+#define SRC_RF24LOGPARTS_WAITER_H_
+
+#include "Common.h" // RF24LOG_POSIX
+
+#if defined (RF24LOG_POSIX)
+#include <stdint.h>
+#include <atomic>
+
+/** @brief wait strategy: check for messages in a busy loop (lowest latency, 1 CPU core fully used) */
+#define RF24LOG_WAIT_SPIN 0
+/** @brief wait strategy: check in a busy loop for a while, then yield the CPU between checks */
+#define RF24LOG_WAIT_SPIN_YIELD 1
+/** @brief wait strategy: sleep until a producer wakes the thread (no CPU used while idle) */
+#define RF24LOG_WAIT_SLEEP 2
+/** @brief wait strategy: sleep for a fixed interval between checks */
+#define RF24LOG_WAIT_POLL 3
+
+/** @brief The number of checks made by @ref RF24LOG_WAIT_SPIN_YIELD before it yields the CPU */
+#ifndef RF24LOG_WAIT_SPINS
+#define RF24LOG_WAIT_SPINS 2000
+#endif
+
+/**
+ * @brief A strategy for a consumer thread to wait for log messages, trading the CPU used while
+ * idle against the latency of waking up.
+ *
+ * The consumer calls wait() when it has nothing to consume, and the producers call notify()
+ * after they publish a message. With @ref RF24LOG_WAIT_SLEEP, the consumer sleeps on a futex
+ * (on Linux) and notify() only makes a system call when the consumer is asleep. Wakeups can be
+ * batched: the consumer is then only woken for every `batch` messages (or for an urgent
+ * message), and the messages in between wait at most `interval` microseconds. notify() is safe
+ * to call from a POSIX signal handler.
+ *
+ * On POSIX platforms other than Linux, @ref RF24LOG_WAIT_SLEEP polls at the `interval` (1 ms
+ * if it is 0).
+ */
+class RF24LogWaiter
+{
+public:
+
+    /**
+     * @brief Instance constructor
+     * @param strategy How the consumer waits (like @ref RF24LOG_WAIT_SLEEP)
+     * @param interval The microseconds between checks for @ref RF24LOG_WAIT_POLL (1000 if it is
+     * 0), or the longest sleep for @ref RF24LOG_WAIT_SLEEP (0 sleeps until a producer wakes the
+     * consumer, or 100 ms at most if the wakeups are batched)
+     * @param batch The number of messages that wake a sleeping consumer (@ref RF24LOG_WAIT_SLEEP only)
+     */
+    RF24LogWaiter(uint8_t strategy = RF24LOG_WAIT_SLEEP, uint32_t interval = 0, uint32_t batch = 1);
+
+    /** @brief the wait strategy */
+    uint8_t strategy() const { return _strategy; }
+
+    /**
+     * @brief tell the consumer that a message was published (safe to call from a signal handler)
+     * @param urgent Wake a sleeping consumer now, even if the batch of messages is not complete
+     */
+    void notify(bool urgent = false);
+
+    /**
+     * @brief wait (in the consumer thread) until there is something to consume.
+     *
+     * This may also return early (after the `interval` of the strategy), so it is called in a loop.
+     * @param ready A function that returns true when there is something to consume (or when
+     * the consumer should stop)
+     */
+    template <typename Ready>
+    void wait(Ready ready)
+    {
+        switch (_strategy)
+        {
+            case RF24LOG_WAIT_SPIN:
+                while (!ready()) { relax(); }
+                return;
+            case RF24LOG_WAIT_SPIN_YIELD:
+                for (uint32_t i = 0; !ready(); ++i)
+                {
+                    if (i < RF24LOG_WAIT_SPINS) { relax(); }
+                    else { yield(); }
+                }
+                return;
+            case RF24LOG_WAIT_SLEEP:
+            {
+                // a producer that publishes after the epoch was read changes the epoch (if it
+                // sees the consumer sleeping), which makes the sleep return at once
+                uint32_t epoch = _epoch.load(std::memory_order_seq_cst);
+                _pending.store(0, std::memory_order_relaxed);
+                _sleeping.store(true, std::memory_order_seq_cst);
+                std::atomic_thread_fence(std::memory_order_seq_cst);
+                if (!ready())
+                {
+                    sleep(epoch);
+                }
+                _sleeping.store(false, std::memory_order_relaxed);
+                return;
+            }
+            default:
+                if (!ready())
+                {
+                    pause();
+                }
+                return;
+        }
+    }
+
+    /**
+     * @brief pin the calling thread to a CPU core (Linux only)
+     * @param cpu The index of the CPU core
+     * @return true if the thread was pinned
+     */
+    static bool pinThread(int cpu);
+
+private:
+
+    /** @brief a hint to the CPU that this is a busy loop */
+    static void relax();
+
+    /** @brief yield the CPU to other threads */
+    static void yield();
+
+    /** @brief sleep until the epoch changes (or for the interval) */
+    void sleep(uint32_t epoch);
+
+    /** @brief sleep for the interval */
+    void pause();
+
+    uint8_t _strategy;
+    uint32_t _interval;
+    uint32_t _batch;
+    /** @brief Changed by the producers that wake the consumer (the futex word) */
+    std::atomic<uint32_t> _epoch;
+    /** @brief The number of messages published while the consumer sleeps */
+    std::atomic<uint32_t> _pending;
+    std::atomic<bool> _sleeping;
+};
+
+#endif // defined (RF24LOG_POSIX)
+#endif /* SRC_RF24LOGPARTS_WAITER_H_ */
@@ -0,0 +1,243 @@
+/**
+ * @file CompressSink.cpp
+ * @date Created 19 Oct 2026
+ * @author Brendan Doherty (2bndy5)
+ * @copyright Copyright (C) <br>
+ *     2026    Brendan Doherty (2bndy5) <br>
+ * This General Public License does not permit incorporating your program into
+ * proprietary programs.  If your program is a subroutine library, you may
+ * consider it more useful to permit linking proprietary applications with the
+ * library.  If this is what you want to do, use the GNU Lesser General
+ * Public License instead of this License.
+ */
+
+#include "CompressSink.h"
+
+#if defined (RF24LOG_HOSTED)
+#include <string.h> // memcpy()
+#include "../RF24LogLevel.h"
+#include "../RF24LogParts/Memory.h"
+
+/****************************************************************************/
+
+/** @brief store a little-endian word */
+static inline void putWord(char *output, uint32_t value)
+{
+    for (uint8_t i = 0; i < 4; ++i)
+    {
+        output[i] = (char)(value >> (i * 8));
+    }
+}
+
+/****************************************************************************/
+
+RF24LogCompressSink::RF24LogCompressSink(RF24LogSink *next, size_t blockSize, uint8_t blockCount, uint32_t maxLatency)
+    : _maxLatency(maxLatency), _closed(0), _compressed(0), _flushing(0), _dropped(0), _bytesIn(0), _bytesOut(0)
+{
+    _next = next;
+    _blockSize = blockSize < 1 ? 1 : (blockSize > RF24LOG_LZ_MAX_BLOCK ? RF24LOG_LZ_MAX_BLOCK : blockSize);
+    _blockCount = blockCount < 2 ? 2 : blockCount;
+
+    // the blocks (maybe smaller) and the output buffer come from the memory budget; without them,
+    // the records are dropped (and counted)
+    size_t bytes = _blockSize * _blockCount;
+    char *data = static_cast<char *>(RF24LogMemory::allocate(&bytes, _blockCount));
+    _blockSize = bytes / _blockCount;
+    size_t outputSize = RF24LOG_LZ_BLOCK_HEADER * 2 + RF24LogLz::bound(_blockSize);
+    _output = data == nullptr ? nullptr : static_cast<char *>(RF24LogMemory::allocate(&outputSize, outputSize));
+    if (_output == nullptr)
+    {
+        RF24LogMemory::release(data);
+        data = nullptr;
+        _blockSize = 0;
+    }
+    _blocks = new Block[_blockCount];
+    for (uint8_t i = 0; i < _blockCount; ++i)
+    {
+        _blocks[i].data = data == nullptr ? nullptr : data + i * _blockSize;
+        _blocks[i].used = 0;
+        _blocks[i].logLevel = 0;
+    }
+    _filling = 0;
+    _started = false;
+    _stopping = false;
+    _compressor = std::thread(&RF24LogCompressSink::run, this);
+}
+
+/****************************************************************************/
+
+RF24LogCompressSink::~RF24LogCompressSink()
+{
+    flush();
+    {
+        std::lock_guard<std::mutex> lock(_mutex);
+        _stopping = true;
+    }
+    _wakeup.notify_one();
+    _compressor.join();
+    RF24LogMemory::release(_blocks[0].data);
+    delete[] _blocks;
+    RF24LogMemory::release(_output);
+}
+
+/****************************************************************************/
+
+void RF24LogCompressSink::write(const char *data, size_t length, uint8_t logLevel)
+{
+    std::lock_guard<std::mutex> lock(_mutex);
+    // a record may continue in the next block, but it is only accepted as a whole
+    uint32_t waiting = _closed.load(std::memory_order_relaxed) - _compressed.load(std::memory_order_acquire);
+    size_t room = _blockSize - _blocks[_filling].used + (size_t)(_blockCount - 1 - waiting) * _blockSize;
+    if (length > room)
+    {
+        _dropped.fetch_add(1, std::memory_order_relaxed); // the background thread is behind
+        return;
+    }
+    _bytesIn.fetch_add(length, std::memory_order_relaxed);
+
+    while (length)
+    {
+        Block *block = &_blocks[_filling];
+        if (block->used == _blockSize)
+        {
+            closeBlockLocked();
+            continue;
+        }
+        if (block->used == 0 && _maxLatency.count())
+        {
+            _deadline = std::chrono::steady_clock::now() + _maxLatency;
+            _wakeup.notify_one();
+        }
+        size_t part = _blockSize - block->used < length ? _blockSize - block->used : length;
+        memcpy(block->data + block->used, data, part);
+        block->used += part;
+        if (logLevel && (block->logLevel == 0 || logLevel < block->logLevel))
+        {
+            block->logLevel = logLevel;
+        }
+        data += part;
+        length -= part;
+    }
+
+    if (_blocks[_filling].used == _blockSize
+        || rf24LogIsUrgent(logLevel))
+    {
+        closeBlockLocked();
+    }
+}
+
+/****************************************************************************/
+
+void RF24LogCompressSink::flush()
+{
+    {
+        std::unique_lock<std::mutex> lock(_mutex);
+        _flushing.fetch_add(1);
+        while (!closeBlockLocked())
+        {
+            _written.wait(lock);
+        }
+        while (_compressed.load() != _closed.load(std::memory_order_relaxed))
+        {
+            _written.wait(lock);
+        }
+        _flushing.fetch_sub(1);
+    }
+    _next->flush();
+}
+
+/****************************************************************************/
+
+bool RF24LogCompressSink::closeBlockLocked()
+{
+    if (_blocks[_filling].used == 0)
+    {
+        return true;
+    }
+    uint32_t closed = _closed.load(std::memory_order_relaxed);
+    if (closed - _compressed.load(std::memory_order_acquire) == (uint32_t)(_blockCount - 1))
+    {
+        return false; // keep filling this block
+    }
+    _filling = (uint8_t)((_filling + 1) % _blockCount);
+    _blocks[_filling].logLevel = 0;
+    _closed.store(closed + 1, std::memory_order_release);
+    _wakeup.notify_one();
+    return true;
+}
+
+/****************************************************************************/
+
+void RF24LogCompressSink::run()
+{
+    uint32_t compressed = 0;
+    uint8_t oldest = 0;
+    while (true)
+    {
+        if (_closed.load(std::memory_order_acquire) != compressed)
+        {
+            // the closed blocks belong to this thread until they are released (without taking _mutex,
+            // which the producers would keep from this thread during a burst)
+            Block *block = &_blocks[oldest];
+            char *output = _output;
+            if (!_started)
+            {
+                putWord(output, RF24LOG_LZ_MAGIC);
+                putWord(output + 4, RF24LOG_LZ_VERSION);
+                output += RF24LOG_LZ_BLOCK_HEADER;
+                _started = true;
+            }
+            size_t size = RF24LogLz::compress(block->data, block->used, output + RF24LOG_LZ_BLOCK_HEADER);
+            uint32_t rawSize = (uint32_t)block->used;
+            if (size >= block->used)
+            {
+                // incompressible: store it
+                memcpy(output + RF24LOG_LZ_BLOCK_HEADER, block->data, block->used);
+                size = block->used;
+                rawSize |= RF24LOG_LZ_STORED;
+            }
+            putWord(output, rawSize);
+            putWord(output + 4, (uint32_t)size);
+            size += (size_t)(output - _output) + RF24LOG_LZ_BLOCK_HEADER;
+            _next->write(_output, size, block->logLevel);
+            _bytesOut.fetch_add(size, std::memory_order_relaxed);
+
+            block->used = 0;
+            oldest = (uint8_t)((oldest + 1) % _blockCount);
+            _compressed.store(++compressed);
+            if (_flushing.load())
+            {
+                std::lock_guard<std::mutex> lock(_mutex);
+                _written.notify_all();
+            }
+            continue;
+        }
+
+        std::unique_lock<std::mutex> lock(_mutex);
+        if (_closed.load(std::memory_order_relaxed) != compressed)
+        {
+            continue;
+        }
+        if (_stopping)
+        {
+            break;
+        }
+        if (_blocks[_filling].used && _maxLatency.count())
+        {
+            if (std::chrono::steady_clock::now() >= _deadline)
+            {
+                closeBlockLocked();
+            }
+            else
+            {
+                _wakeup.wait_until(lock, _deadline);
+            }
+        }
+        else
+        {
+            _wakeup.wait(lock);
+        }
+    }
+}
+
+#endif // defined (RF24LOG_HOSTED)
@@ -0,0 +1,128 @@
+/**
+ * @file CompressSink.h
+ * @brief sink that compresses the formatted log messages in blocks for another sink
+ * @date Created 19 Oct 2026
+ * @author Brendan Doherty (2bndy5)
+ * @copyright Copyright (C) <br>
+ *     2026    Brendan Doherty (2bndy5) <br>
+ * This General Public License does not permit incorporating your program into
+ * proprietary programs.  If your program is a subroutine library, you may
+ * consider it more useful to permit linking proprietary applications with the
+ * library.  If this is what you want to do, use the GNU Lesser General
+ * Public License instead of this License.
+ */
+
+#ifndef SRC_RF24LOGSINKS_COMPRESSSINK_H_
+#define SRC_RF24LOGSINKS_COMPRESSSINK_H_
+
+#include "../RF24LogParts/Common.h" // RF24LOG_HOSTED
+#include "../RF24LogParts/Sink.h"
+#include "../RF24LogParts/Lz.h"
+
+#if defined (RF24LOG_HOSTED)
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <mutex>
+#include <thread>
+
+/**
+ * @brief A sink that compresses the stream of records in fixed-size blocks (see RF24LogLz)
+ * and passes each compressed block to another sink (like a RF24LogWritevSink on a file).
+ *
+ * Producers only copy their records into the block being filled. Full blocks are compressed
+ * and written by a background thread, so producers never wait for the compression or for
+ * the next sink. A block is also closed early when an @ref ERROR (or more severe) message is
+ * written, and when its first record has waited @p maxLatency milliseconds.
+ *
+ * If all the blocks are waiting for the background thread, new records are dropped (and
+ * counted) instead of blocking the producer. The `rf24log-unlz` tool (in the repo's tools
+ * folder) turns the compressed stream back into text.
+ */
+class RF24LogCompressSink : public RF24LogSink
+{
+public:
+
+    /**
+     * @brief Instance constructor
+     * @param next The sink that receives the compressed blocks (each block is 1 write)
+     * @param blockSize The uncompressed size of a block (at most @ref RF24LOG_LZ_MAX_BLOCK). The
+     * blocks are allocated from the RF24LogMemory budget, so they can be smaller; if they are
+     * refused, the records are dropped.
+     * @param blockCount The number of blocks (the one being filled and the ones waiting to be compressed)
+     * @param maxLatency The maximum time (in milliseconds) a record waits before its block is
+     * compressed; `0` means blocks are only closed when full, on errors and by flush().
+     */
+    RF24LogCompressSink(RF24LogSink *next, size_t blockSize = 65536, uint8_t blockCount = 4, uint32_t maxLatency = 1000);
+
+    /** @brief compresses the pending records and stops the background thread */
+    ~RF24LogCompressSink();
+
+    void write(const char *data, size_t length, uint8_t logLevel);
+
+    /** @brief compress the pending records, wait until they are written, and flush the next sink */
+    void flush();
+
+    /** @brief the number of records dropped because every block was busy */
+    uint64_t dropped() { return _dropped.load(std::memory_order_relaxed); }
+
+    /** @brief the number of uncompressed bytes written to this sink */
+    uint64_t bytesIn() { return _bytesIn.load(std::memory_order_relaxed); }
+
+    /** @brief the number of compressed bytes (including headers) written to the next sink */
+    uint64_t bytesOut() { return _bytesOut.load(std::memory_order_relaxed); }
+
+private:
+
+    /** @brief A block of the uncompressed stream */
+    struct Block
+    {
+        char *data;
+        size_t used;
+        /** @brief The most severe level in the block (for the next sink) */
+        uint8_t logLevel;
+    };
+
+    /** @brief queue the block being filled for compression; the caller holds _mutex */
+    bool closeBlockLocked();
+
+    /** @brief the background thread that compresses the blocks */
+    void run();
+
+    RF24LogSink *_next;
+    size_t _blockSize;
+    uint8_t _blockCount;
+    std::chrono::milliseconds _maxLatency;
+
+    Block *_blocks;
+    /** @brief The block being filled */
+    uint8_t _filling;
+    /** @brief The number of blocks closed (and queued for compression) so far */
+    std::atomic<uint32_t> _closed;
+    /** @brief The number of blocks compressed so far (released without taking _mutex) */
+    std::atomic<uint32_t> _compressed;
+    /** @brief The number of flush() calls waiting for the background thread */
+    std::atomic<uint8_t> _flushing;
+    /** @brief Was the stream header written? */
+    bool _started;
+    /** @brief When the block being filled has to be closed */
+    std::chrono::steady_clock::time_point _deadline;
+    /** @brief The output of the compressor (a block header and the compressed data) */
+    char *_output;
+
+    /** @brief guards the block being filled */
+    std::mutex _mutex;
+    /** @brief wakes the background thread */
+    std::condition_variable _wakeup;
+    /** @brief signals flush() when a block was written */
+    std::condition_variable _written;
+    std::thread _compressor;
+    bool _stopping;
+
+    std::atomic<uint64_t> _dropped;
+    std::atomic<uint64_t> _bytesIn;
+    std::atomic<uint64_t> _bytesOut;
+};
+
+#endif // defined (RF24LOG_HOSTED)
+#endif /* SRC_RF24LOGSINKS_COMPRESSSINK_H_ */
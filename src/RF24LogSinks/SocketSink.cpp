@@ -0,0 +1,363 @@
+/**
+ * @file SocketSink.cpp
+ * @date Created 19 Oct 2026
+ * @author Brendan Doherty (2bndy5)
+ * @copyright Copyright (C) <br>
+ *     2026    Brendan Doherty (2bndy5) <br>
+ * This General Public License does not permit incorporating your program into
+ * proprietary programs.  If your program is a subroutine library, you may
+ * consider it more useful to permit linking proprietary applications with the
+ * library.  If this is what you want to do, use the GNU Lesser General
+ * Public License instead of this License.
+ */
+
+#include "SocketSink.h"
+
+#if defined (RF24LOG_POSIX)
+#include <arpa/inet.h>  // htonl(), ntohl()
+#include <errno.h>      // errno, EINTR, EAGAIN
+#include <fcntl.h>      // fcntl(), O_NONBLOCK
+#include <string.h>     // memcpy(), memmove(), memset(), strncpy()
+#include <sys/socket.h> // socket(), connect(), send(), sendmmsg()
+#include <sys/uio.h>    // struct iovec
+#include <sys/un.h>     // struct sockaddr_un
+#include <unistd.h>     // close()
+#include "../RF24LogLevel.h"
+#include "../RF24LogParts/Memory.h"
+
+#ifndef MSG_NOSIGNAL
+#define MSG_NOSIGNAL 0 // SO_NOSIGPIPE is used instead
+#endif
+
+/** @brief The number of datagrams passed to 1 `sendmmsg()` */
+#define RF24LOG_SOCKET_BATCH 64
+
+/****************************************************************************/
+
+/** @brief read the length of a buffered frame */
+static inline uint32_t frameLength(const char *frame)
+{
+    uint32_t length;
+    memcpy(&length, frame, RF24LOG_FRAME_HEADER_SIZE);
+    return ntohl(length);
+}
+
+/****************************************************************************/
+
+RF24LogSocketSink::RF24LogSocketSink(const char *path, bool datagrams, size_t bufferSize,
+                                     uint32_t maxLatency, uint32_t retryInterval)
+    : _maxLatency(maxLatency), _retryInterval(retryInterval),
+      _records(0), _sent(0), _dropped(0), _sendCalls(0), _connections(0)
+{
+    strncpy(_path, path, sizeof(_path) - 1);
+    _path[sizeof(_path) - 1] = 0;
+    _datagrams = datagrams;
+    _socket = -1;
+    // from the memory budget (maybe smaller); without it, all of the records are dropped (and counted)
+    _bufferSize = bufferSize;
+    _buffer = static_cast<char *>(RF24LogMemory::allocate(&_bufferSize, RF24LOG_FRAME_HEADER_SIZE + 1));
+    _used = 0;
+    _partial = 0;
+    _stopping = false;
+    if (maxLatency)
+    {
+        _flusher = std::thread(&RF24LogSocketSink::run, this);
+    }
+}
+
+/****************************************************************************/
+
+RF24LogSocketSink::~RF24LogSocketSink()
+{
+    {
+        std::lock_guard<std::mutex> lock(_mutex);
+        _stopping = true;
+    }
+    _wakeup.notify_one();
+    if (_flusher.joinable())
+    {
+        _flusher.join();
+    }
+    std::lock_guard<std::mutex> lock(_mutex);
+    _nextAttempt = std::chrono::steady_clock::time_point();
+    sendLocked();
+    disconnectLocked();
+    RF24LogMemory::release(_buffer);
+}
+
+/****************************************************************************/
+
+void RF24LogSocketSink::write(const char *data, size_t length, uint8_t logLevel)
+{
+    std::unique_lock<std::mutex> lock(_mutex);
+    _records.fetch_add(1, std::memory_order_relaxed);
+    size_t frame = RF24LOG_FRAME_HEADER_SIZE + length;
+    if (frame > _bufferSize)
+    {
+        _dropped.fetch_add(1, std::memory_order_relaxed);
+        return;
+    }
+    if (_used + frame > _bufferSize)
+    {
+        sendLocked();
+        if (_used + frame > _bufferSize)
+        {
+            _dropped.fetch_add(1, std::memory_order_relaxed); // the collector is slow or gone
+            return;
+        }
+    }
+
+    uint32_t networkLength = htonl((uint32_t)length);
+    memcpy(_buffer + _used, &networkLength, RF24LOG_FRAME_HEADER_SIZE);
+    memcpy(_buffer + _used + RF24LOG_FRAME_HEADER_SIZE, data, length);
+    if (_used == 0 && _maxLatency.count())
+    {
+        _deadline = std::chrono::steady_clock::now() + _maxLatency;
+        _wakeup.notify_one();
+    }
+    _used += frame;
+
+    // send at half capacity, so records can still be buffered while the collector catches up
+    if (_used >= _bufferSize / 2
+        || rf24LogIsUrgent(logLevel))
+    {
+        sendLocked();
+    }
+}
+
+/****************************************************************************/
+
+void RF24LogSocketSink::flush()
+{
+    std::lock_guard<std::mutex> lock(_mutex);
+    sendLocked();
+}
+
+/****************************************************************************/
+
+bool RF24LogSocketSink::isConnected()
+{
+    std::lock_guard<std::mutex> lock(_mutex);
+    return _socket >= 0;
+}
+
+/****************************************************************************/
+
+bool RF24LogSocketSink::connectLocked()
+{
+    std::chrono::steady_clock::time_point now = std::chrono::steady_clock::now();
+    if (now < _nextAttempt)
+    {
+        return false;
+    }
+    _nextAttempt = now + _retryInterval;
+
+    int fd = socket(AF_UNIX, _datagrams ? SOCK_DGRAM : SOCK_STREAM, 0);
+    if (fd < 0)
+    {
+        return false;
+    }
+    fcntl(fd, F_SETFL, fcntl(fd, F_GETFL) | O_NONBLOCK);
+    fcntl(fd, F_SETFD, FD_CLOEXEC);
+#if defined (SO_NOSIGPIPE)
+    int on = 1;
+    setsockopt(fd, SOL_SOCKET, SO_NOSIGPIPE, &on, sizeof(on));
+#endif
+
+    struct sockaddr_un address;
+    memset(&address, 0, sizeof(address));
+    address.sun_family = AF_UNIX;
+    memcpy(address.sun_path, _path, sizeof(_path));
+    // a Unix domain socket connects (or fails) immediately, even when non-blocking
+    if (connect(fd, reinterpret_cast<struct sockaddr *>(&address), sizeof(address)) != 0)
+    {
+        close(fd);
+        return false;
+    }
+    _socket = fd;
+    _connections.fetch_add(1, std::memory_order_relaxed);
+    return true;
+}
+
+/****************************************************************************/
+
+void RF24LogSocketSink::disconnectLocked()
+{
+    if (_socket < 0)
+    {
+        return;
+    }
+    close(_socket);
+    _socket = -1;
+    if (_partial)
+    {
+        // the rest of this frame would be misread on the next connection
+        size_t frame = RF24LOG_FRAME_HEADER_SIZE + frameLength(_buffer);
+        memmove(_buffer, _buffer + frame, _used - frame);
+        _used -= frame;
+        _partial = 0;
+        _dropped.fetch_add(1, std::memory_order_relaxed);
+    }
+}
+
+/****************************************************************************/
+
+void RF24LogSocketSink::sendLocked()
+{
+    if (_used == 0 || (_socket < 0 && !connectLocked()))
+    {
+        return;
+    }
+    if (!(_datagrams ? sendDatagrams() : sendStream()))
+    {
+        disconnectLocked(); // reconnect later
+    }
+}
+
+/****************************************************************************/
+
+bool RF24LogSocketSink::sendStream()
+{
+    while (_used > _partial)
+    {
+        ssize_t result = send(_socket, _buffer + _partial, _used - _partial, MSG_NOSIGNAL);
+        _sendCalls.fetch_add(1, std::memory_order_relaxed);
+        if (result < 0)
+        {
+            if (errno == EINTR)
+            {
+                continue;
+            }
+            // a full socket buffer keeps the records buffered here; other errors lose the connection
+            return errno == EAGAIN || errno == EWOULDBLOCK || errno == ENOBUFS;
+        }
+        // remove the completely sent frames; remember how much of the next one was sent
+        size_t done = _partial + (size_t)result;
+        size_t bytes = 0;
+        uint64_t count = 0;
+        while (bytes + RF24LOG_FRAME_HEADER_SIZE <= done
+               && bytes + RF24LOG_FRAME_HEADER_SIZE + frameLength(_buffer + bytes) <= done)
+        {
+            bytes += RF24LOG_FRAME_HEADER_SIZE + frameLength(_buffer + bytes);
+            ++count;
+        }
+        consume(bytes, count);
+        _partial = done - bytes;
+    }
+    return true;
+}
+
+/****************************************************************************/
+
+bool RF24LogSocketSink::sendDatagrams()
+{
+    while (_used)
+    {
+        struct iovec iov[RF24LOG_SOCKET_BATCH];
+        unsigned count = 0;
+        for (size_t offset = 0; offset < _used && count < RF24LOG_SOCKET_BATCH; ++count)
+        {
+            uint32_t length = frameLength(_buffer + offset);
+            iov[count].iov_base = _buffer + offset + RF24LOG_FRAME_HEADER_SIZE;
+            iov[count].iov_len = length;
+            offset += RF24LOG_FRAME_HEADER_SIZE + length;
+        }
+
+#if defined (__linux__)
+        struct mmsghdr messages[RF24LOG_SOCKET_BATCH];
+        memset(messages, 0, sizeof(messages[0]) * count);
+        for (unsigned i = 0; i < count; ++i)
+        {
+            messages[i].msg_hdr.msg_iov = &iov[i];
+            messages[i].msg_hdr.msg_iovlen = 1;
+        }
+        int result = sendmmsg(_socket, messages, count, MSG_NOSIGNAL);
+        _sendCalls.fetch_add(1, std::memory_order_relaxed);
+#else
+        int result = 0;
+        for (unsigned i = 0; i < count; ++i)
+        {
+            _sendCalls.fetch_add(1, std::memory_order_relaxed);
+            if (send(_socket, iov[i].iov_base, iov[i].iov_len, MSG_NOSIGNAL) < 0)
+            {
+                result = result ? result : -1;
+                break;
+            }
+            ++result;
+        }
+#endif
+
+        if (result < 0)
+        {
+            if (errno == EINTR)
+            {
+                continue;
+            }
+            if (errno == EMSGSIZE)
+            {
+                // too large for a datagram: drop it, keep the others
+                consume(RF24LOG_FRAME_HEADER_SIZE + iov[0].iov_len, 0);
+                _dropped.fetch_add(1, std::memory_order_relaxed);
+                continue;
+            }
+            return errno == EAGAIN || errno == EWOULDBLOCK || errno == ENOBUFS;
+        }
+        size_t bytes = 0;
+        for (int i = 0; i < result; ++i)
+        {
+            bytes += RF24LOG_FRAME_HEADER_SIZE + iov[i].iov_len;
+        }
+        consume(bytes, (uint64_t)result);
+        if ((unsigned)result < count)
+        {
+            return true; // the socket buffer is full; try the rest later
+        }
+    }
+    return true;
+}
+
+/****************************************************************************/
+
+void RF24LogSocketSink::consume(size_t bytes, uint64_t count)
+{
+    if (bytes == 0)
+    {
+        return;
+    }
+    memmove(_buffer, _buffer + bytes, _used - bytes);
+    _used -= bytes;
+    _sent.fetch_add(count, std::memory_order_relaxed);
+}
+
+/****************************************************************************/
+
+void RF24LogSocketSink::run()
+{
+    std::unique_lock<std::mutex> lock(_mutex);
+    while (!_stopping)
+    {
+        if (_used == 0)
+        {
+            _wakeup.wait(lock);
+            continue;
+        }
+        std::chrono::steady_clock::time_point due = _deadline;
+        if (_socket < 0 && _nextAttempt > due)
+        {
+            due = _nextAttempt;
+        }
+        std::chrono::steady_clock::time_point now = std::chrono::steady_clock::now();
+        if (now < due)
+        {
+            _wakeup.wait_until(lock, due);
+            continue;
+        }
+        sendLocked();
+        if (_used)
+        {
+            _deadline = now + _maxLatency; // the collector is slow or gone; try again later
+        }
+    }
+}
+
+#endif // defined (RF24LOG_POSIX)
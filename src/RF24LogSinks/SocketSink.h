@@ -0,0 +1,147 @@
+/**
+ * @file SocketSink.h
+ * @brief sink that sends batches of formatted log messages over a Unix domain socket
+ * @date Created 19 Oct 2026
+ * @author Brendan Doherty (2bndy5)
+ * @copyright Copyright (C) <br>
+ *     2026    Brendan Doherty (2bndy5) <br>
+ * This General Public License does not permit incorporating your program into
+ * proprietary programs.  If your program is a subroutine library, you may
+ * consider it more useful to permit linking proprietary applications with the
+ * library.  If this is what you want to do, use the GNU Lesser General
+ * Public License instead of this License.
+ */
+
+#ifndef SRC_RF24LOGSINKS_SOCKETSINK_H_
+#define SRC_RF24LOGSINKS_SOCKETSINK_H_
+
+#include "../RF24LogParts/Common.h" // RF24LOG_POSIX
+#include "../RF24LogParts/Sink.h"
+
+#if defined (RF24LOG_POSIX)
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <mutex>
+#include <thread>
+
+/** @brief The size of the length (a 32-bit unsigned integer in network byte order) that precedes each record of a stream */
+#define RF24LOG_FRAME_HEADER_SIZE 4
+
+/**
+ * @brief A sink that sends records to a local collector over a Unix domain socket.
+ *
+ * - In stream mode (`SOCK_STREAM`), each record is sent as a frame: its length
+ *   (@ref RF24LOG_FRAME_HEADER_SIZE bytes, in network byte order) followed by its bytes.
+ *   Buffered frames are sent with 1 `send()`.
+ * - In datagram mode (`SOCK_DGRAM`), each record is 1 datagram.
+ *   Buffered datagrams are sent with 1 `sendmmsg()` on Linux. Linux queues only
+ *   `net.unix.max_dgram_qlen` datagrams per socket, so the stream mode suits bursts better.
+ *
+ * Records are buffered until the buffer is half full, an @ref ERROR (or more severe) message is
+ * written, or the oldest record has waited @p maxLatency milliseconds (checked by a
+ * background thread).
+ *
+ * The socket is non-blocking, so a logging thread never waits for the collector. While the
+ * collector is slow or gone, records stay in the buffer; once the buffer is full, new records
+ * are dropped (and counted). A lost connection is retried every @p retryInterval
+ * milliseconds. A stream frame that was partly sent when the connection broke is dropped,
+ * so a new connection always starts at a frame.
+ */
+class RF24LogSocketSink : public RF24LogSink
+{
+public:
+
+    /**
+     * @brief Instance constructor (the connection is made by the first write)
+     * @param path The collector's socket path
+     * @param datagrams Send the records as datagrams (`true`) or as a length-prefixed stream (`false`)
+     * @param bufferSize The number of bytes buffered (including the length of each stream frame).
+     * The buffer is allocated from the RF24LogMemory budget, so it can be smaller; if it is
+     * refused, the records are dropped.
+     * @param maxLatency The maximum time (in milliseconds) a record waits in the buffer.
+     * Use `0` to disable the background thread.
+     * @param retryInterval The time (in milliseconds) between connection attempts
+     */
+    RF24LogSocketSink(const char *path, bool datagrams = false, size_t bufferSize = 65536,
+                      uint32_t maxLatency = 100, uint32_t retryInterval = 1000);
+
+    /** @brief tries to send the pending records, stops the background thread and closes the socket */
+    ~RF24LogSocketSink();
+
+    void write(const char *data, size_t length, uint8_t logLevel);
+
+    /** @brief try to send the buffered records now (without waiting for the collector) */
+    void flush();
+
+    /** @brief is the socket connected? */
+    bool isConnected();
+
+    /** @brief the number of records written to the sink */
+    uint64_t records() { return _records.load(std::memory_order_relaxed); }
+
+    /** @brief the number of records sent */
+    uint64_t sent() { return _sent.load(std::memory_order_relaxed); }
+
+    /** @brief the number of records dropped (buffer full, too large, or cut off by a lost connection) */
+    uint64_t dropped() { return _dropped.load(std::memory_order_relaxed); }
+
+    /** @brief the number of `send()`/`sendmmsg()` system calls made */
+    uint64_t sendCalls() { return _sendCalls.load(std::memory_order_relaxed); }
+
+    /** @brief the number of connections made */
+    uint64_t connections() { return _connections.load(std::memory_order_relaxed); }
+
+private:
+
+    /** @brief connect (unless the last attempt was too recent); the caller holds _mutex */
+    bool connectLocked();
+
+    /** @brief close the socket; the caller holds _mutex */
+    void disconnectLocked();
+
+    /** @brief send as many buffered records as the socket takes; the caller holds _mutex */
+    void sendLocked();
+
+    /** @brief send the buffered stream frames */
+    bool sendStream();
+
+    /** @brief send the buffered records as datagrams */
+    bool sendDatagrams();
+
+    /** @brief remove @p count whole frames (@p bytes bytes) from the front of the buffer */
+    void consume(size_t bytes, uint64_t count);
+
+    /** @brief the background thread that enforces the maximum latency and reconnects */
+    void run();
+
+    char _path[108];
+    bool _datagrams;
+    int _socket;
+    std::chrono::milliseconds _maxLatency;
+    std::chrono::milliseconds _retryInterval;
+    std::chrono::steady_clock::time_point _nextAttempt;
+
+    /** @brief The buffered frames (every record is stored with its length, even in datagram mode) */
+    char *_buffer;
+    size_t _bufferSize;
+    size_t _used;
+    /** @brief The number of bytes of the first frame already sent (stream mode) */
+    size_t _partial;
+    /** @brief When the buffered records have to be sent */
+    std::chrono::steady_clock::time_point _deadline;
+
+    std::mutex _mutex;
+    std::condition_variable _wakeup;
+    std::thread _flusher;
+    bool _stopping;
+
+    std::atomic<uint64_t> _records;
+    std::atomic<uint64_t> _sent;
+    std::atomic<uint64_t> _dropped;
+    std::atomic<uint64_t> _sendCalls;
+    std::atomic<uint64_t> _connections;
+};
+
+#endif // defined (RF24LOG_POSIX)
+#endif /* SRC_RF24LOGSINKS_SOCKETSINK_H_ */
@@ -0,0 +1,565 @@
+/**
+ * @file UringSink.cpp
+ * @date Created 19 Oct 2026
+ * @author Brendan Doherty (2bndy5)
+ * @copyright Copyright (C) <br>
+ *     2026    Brendan Doherty (2bndy5) <br>
+ * This General Public License does not permit incorporating your program into
+ * proprietary programs.  If your program is a subroutine library, you may
+ * consider it more useful to permit linking proprietary applications with the
+ * library.  If this is what you want to do, use the GNU Lesser General
+ * Public License instead of this License.
+ */
+
+#include "UringSink.h"
+
+#if defined (RF24LOG_POSIX)
+#include <errno.h>    // errno, EINTR, EAGAIN
+#include <string.h>   // memcpy(), memset()
+#include <unistd.h>   // pwrite(), lseek(), close()
+#include "../RF24LogLevel.h"
+#include "../RF24LogParts/Memory.h"
+
+#if defined (__linux__) && defined (__has_include)
+#if __has_include(<linux/io_uring.h>)
+#include <sys/mman.h>    // mmap(), munmap()
+#include <sys/syscall.h> // syscall(), __NR_io_uring_*
+#include <sys/uio.h>     // struct iovec
+#include <linux/io_uring.h>
+#if defined (__NR_io_uring_setup)
+/** @brief io_uring can be used (the C library may still lack wrappers, so the system calls are made directly) */
+#define RF24LOG_URING
+#endif
+#endif
+#endif
+
+/****************************************************************************/
+
+/** @brief write all of @p length bytes at @p offset */
+static bool pwriteAll(int fd, const char *data, size_t length, off_t offset)
+{
+    while (length)
+    {
+        ssize_t written = pwrite(fd, data, length, offset);
+        if (written < 0)
+        {
+            if (errno == EINTR)
+            {
+                continue;
+            }
+            return false;
+        }
+        if (written == 0)
+        {
+            return false;
+        }
+        data += written;
+        length -= (size_t)written;
+        offset += written;
+    }
+    return true;
+}
+
+/****************************************************************************/
+
+RF24LogUringSink::RF24LogUringSink(int fd, size_t bufferSize, uint8_t bufferCount, uint32_t maxLatency, bool useUring)
+    : _maxLatency(maxLatency), _maxQueueDepth(0), _records(0), _completions(0),
+      _totalLatencyUs(0), _maxLatencyUs(0), _errors(0)
+{
+    _fd = fd;
+    _bufferSize = bufferSize;
+    _bufferCount = bufferCount < 2 ? 2 : bufferCount;
+    _offset = lseek(fd, 0, SEEK_END);
+    if (_offset < 0)
+    {
+        _offset = 0; // not a regular file; the writes will fail and be counted as errors
+    }
+
+    // the buffers come from the memory budget (maybe smaller); without them, each record is written on its own
+    size_t bytes = bufferSize * _bufferCount;
+    char *data = static_cast<char *>(RF24LogMemory::allocate(&bytes, _bufferCount));
+    _bufferSize = bytes / _bufferCount;
+    _buffers = new Buffer[_bufferCount];
+    for (uint8_t i = 0; i < _bufferCount; ++i)
+    {
+        _buffers[i].data = data == nullptr ? nullptr : data + i * _bufferSize;
+        _buffers[i].used = 0;
+        _buffers[i].done = 0;
+        _buffers[i].offset = 0;
+        _buffers[i].inFlight = false;
+    }
+    _active = 0;
+    _inFlight = 0;
+
+    _ringFd = -1;
+    _fixedBuffers = false;
+    _sqRing = nullptr;
+    _cqRing = nullptr;
+    _sqes = nullptr;
+    if (useUring)
+    {
+        setupRing(_bufferCount);
+    }
+
+    _stopping = false;
+    if (maxLatency)
+    {
+        _flusher = std::thread(&RF24LogUringSink::run, this);
+    }
+}
+
+/****************************************************************************/
+
+RF24LogUringSink::~RF24LogUringSink()
+{
+    {
+        std::lock_guard<std::mutex> lock(_mutex);
+        _stopping = true;
+    }
+    _wakeup.notify_one();
+    if (_flusher.joinable())
+    {
+        _flusher.join();
+    }
+    flush();
+    closeRing();
+    lseek(_fd, _offset, SEEK_SET); // later writes to the file descriptor follow the records
+    RF24LogMemory::release(_buffers[0].data);
+    delete[] _buffers;
+}
+
+/****************************************************************************/
+
+void RF24LogUringSink::write(const char *data, size_t length, uint8_t logLevel)
+{
+    std::unique_lock<std::mutex> lock(_mutex);
+    _records.fetch_add(1, std::memory_order_relaxed);
+    if (_ringFd >= 0 && _inFlight)
+    {
+        reap(0); // collect the finished writes (only reads the completion ring)
+    }
+    while (_buffers[_active].used && _buffers[_active].used + length > _bufferSize)
+    {
+        submitLocked(lock); // other producers may fill the next buffer while the lock is released
+    }
+    if (length > _bufferSize || _bufferSize == 0)
+    {
+        // too large for a buffer: write it on its own at the next offset
+        off_t offset = _offset;
+        _offset += (off_t)length;
+        lock.unlock();
+        if (!pwriteAll(_fd, data, length, offset))
+        {
+            _errors.fetch_add(1, std::memory_order_relaxed);
+        }
+        return;
+    }
+
+    Buffer *buffer = &_buffers[_active];
+    memcpy(buffer->data + buffer->used, data, length);
+    if (buffer->used == 0 && _maxLatency.count())
+    {
+        _deadline = std::chrono::steady_clock::now() + _maxLatency;
+        _wakeup.notify_one();
+    }
+    buffer->used += length;
+
+    if (buffer->used >= _bufferSize
+        || rf24LogIsUrgent(logLevel))
+    {
+        submitLocked(lock);
+    }
+}
+
+/****************************************************************************/
+
+void RF24LogUringSink::flush()
+{
+    std::unique_lock<std::mutex> lock(_mutex);
+    submitLocked(lock);
+    while (_inFlight)
+    {
+        if (_ringFd >= 0)
+        {
+            reap(1);
+        }
+        else
+        {
+            _freed.wait(lock);
+        }
+    }
+}
+
+/****************************************************************************/
+
+uint8_t RF24LogUringSink::queueDepth()
+{
+    std::lock_guard<std::mutex> lock(_mutex);
+    return _inFlight;
+}
+
+/****************************************************************************/
+
+uint32_t RF24LogUringSink::averageLatency()
+{
+    uint64_t completions = _completions.load(std::memory_order_relaxed);
+    return completions ? (uint32_t)(_totalLatencyUs.load(std::memory_order_relaxed) / completions) : 0;
+}
+
+/****************************************************************************/
+
+void RF24LogUringSink::submitLocked(std::unique_lock<std::mutex> &lock)
+{
+    // keep a free buffer to fill while this one is written
+    while (true)
+    {
+        if (_buffers[_active].used == 0)
+        {
+            return; // nothing to write (or another thread wrote it while this one waited)
+        }
+        if (_inFlight < _bufferCount - 1)
+        {
+            break;
+        }
+        if (_ringFd >= 0)
+        {
+            reap(1);
+        }
+        else
+        {
+            _freed.wait(lock);
+        }
+    }
+
+    uint8_t index = _active;
+    Buffer *buffer = &_buffers[index];
+    buffer->offset = _offset;
+    buffer->done = 0;
+    buffer->inFlight = true;
+    buffer->submitted = std::chrono::steady_clock::now();
+    _offset += (off_t)buffer->used;
+    ++_inFlight;
+    if (_inFlight > _maxQueueDepth.load(std::memory_order_relaxed))
+    {
+        _maxQueueDepth.store(_inFlight, std::memory_order_relaxed);
+    }
+    for (uint8_t i = 0; i < _bufferCount; ++i)
+    {
+        if (!_buffers[i].inFlight)
+        {
+            _active = i;
+            break;
+        }
+    }
+
+    if (_ringFd >= 0)
+    {
+        if (!submitRing(index))
+        {
+            // the io_uring refused the write; don't lose the records
+            if (!pwriteAll(_fd, buffer->data, buffer->used, buffer->offset))
+            {
+                _errors.fetch_add(1, std::memory_order_relaxed);
+            }
+            complete(index);
+        }
+    }
+    else
+    {
+        writeSync(index, lock);
+    }
+}
+
+/****************************************************************************/
+
+void RF24LogUringSink::writeSync(uint8_t index, std::unique_lock<std::mutex> &lock)
+{
+    Buffer *buffer = &_buffers[index];
+    lock.unlock(); // the buffer belongs to this thread until complete(); others fill the active buffer
+    bool written = pwriteAll(_fd, buffer->data, buffer->used, buffer->offset);
+    lock.lock();
+    if (!written)
+    {
+        _errors.fetch_add(1, std::memory_order_relaxed);
+    }
+    complete(index);
+    _freed.notify_all();
+}
+
+/****************************************************************************/
+
+void RF24LogUringSink::complete(uint8_t index)
+{
+    Buffer *buffer = &_buffers[index];
+    uint64_t latency = (uint64_t)std::chrono::duration_cast<std::chrono::microseconds>(
+        std::chrono::steady_clock::now() - buffer->submitted).count();
+    _totalLatencyUs.fetch_add(latency, std::memory_order_relaxed);
+    if (latency > _maxLatencyUs.load(std::memory_order_relaxed))
+    {
+        _maxLatencyUs.store((uint32_t)latency, std::memory_order_relaxed);
+    }
+    _completions.fetch_add(1, std::memory_order_relaxed);
+    buffer->used = 0;
+    buffer->inFlight = false;
+    --_inFlight;
+}
+
+/****************************************************************************/
+
+void RF24LogUringSink::run()
+{
+    std::unique_lock<std::mutex> lock(_mutex);
+    while (!_stopping)
+    {
+        if (_buffers[_active].used == 0)
+        {
+            if (_ringFd >= 0 && _inFlight)
+            {
+                // nobody is logging; collect the completions now and then
+                _wakeup.wait_for(lock, _maxLatency);
+                reap(0);
+            }
+            else
+            {
+                _wakeup.wait(lock);
+            }
+        }
+        else if (std::chrono::steady_clock::now() >= _deadline)
+        {
+            submitLocked(lock);
+        }
+        else
+        {
+            _wakeup.wait_until(lock, _deadline);
+        }
+    }
+}
+
+/****************************************************************************/
+
+#if defined (RF24LOG_URING)
+
+bool RF24LogUringSink::setupRing(uint8_t entries)
+{
+    struct io_uring_params params;
+    memset(&params, 0, sizeof(params));
+    int fd = (int)syscall(__NR_io_uring_setup, (unsigned)entries, &params);
+    if (fd < 0)
+    {
+        return false; // not supported by the kernel, or forbidden (seccomp, io_uring_disabled)
+    }
+    _ringFd = fd;
+
+    _sqRingSize = params.sq_off.array + params.sq_entries * sizeof(uint32_t);
+    _cqRingSize = params.cq_off.cqes + params.cq_entries * sizeof(struct io_uring_cqe);
+    bool singleMap = params.features & IORING_FEAT_SINGLE_MMAP;
+    if (singleMap)
+    {
+        _sqRingSize = _cqRingSize = _sqRingSize > _cqRingSize ? _sqRingSize : _cqRingSize;
+    }
+    _sqesSize = params.sq_entries * sizeof(struct io_uring_sqe);
+
+    void *sqRing = mmap(nullptr, _sqRingSize, PROT_READ | PROT_WRITE, MAP_SHARED | MAP_POPULATE, fd, IORING_OFF_SQ_RING);
+    _sqRing = sqRing == MAP_FAILED ? nullptr : sqRing;
+    if (_sqRing && singleMap)
+    {
+        _cqRing = _sqRing;
+    }
+    else if (_sqRing)
+    {
+        void *cqRing = mmap(nullptr, _cqRingSize, PROT_READ | PROT_WRITE, MAP_SHARED | MAP_POPULATE, fd, IORING_OFF_CQ_RING);
+        _cqRing = cqRing == MAP_FAILED ? nullptr : cqRing;
+    }
+    void *sqes = mmap(nullptr, _sqesSize, PROT_READ | PROT_WRITE, MAP_SHARED | MAP_POPULATE, fd, IORING_OFF_SQES);
+    _sqes = sqes == MAP_FAILED ? nullptr : sqes;
+    if (_sqRing == nullptr || _cqRing == nullptr || _sqes == nullptr)
+    {
+        closeRing();
+        return false;
+    }
+
+    char *sq = static_cast<char *>(_sqRing);
+    _sqHead = reinterpret_cast<uint32_t *>(sq + params.sq_off.head);
+    _sqTail = reinterpret_cast<uint32_t *>(sq + params.sq_off.tail);
+    _sqMask = *reinterpret_cast<uint32_t *>(sq + params.sq_off.ring_mask);
+    _sqArray = reinterpret_cast<uint32_t *>(sq + params.sq_off.array);
+    char *cq = static_cast<char *>(_cqRing);
+    _cqHead = reinterpret_cast<uint32_t *>(cq + params.cq_off.head);
+    _cqTail = reinterpret_cast<uint32_t *>(cq + params.cq_off.tail);
+    _cqMask = *reinterpret_cast<uint32_t *>(cq + params.cq_off.ring_mask);
+    _cqes = cq + params.cq_off.cqes;
+
+    // registered buffers save the kernel from mapping the pages on every write
+    if (_bufferSize == 0)
+    {
+        return true;
+    }
+    struct iovec *iov = new struct iovec[_bufferCount];
+    for (uint8_t i = 0; i < _bufferCount; ++i)
+    {
+        iov[i].iov_base = _buffers[i].data;
+        iov[i].iov_len = _bufferSize;
+    }
+    _fixedBuffers = syscall(__NR_io_uring_register, fd, IORING_REGISTER_BUFFERS, iov, (unsigned)_bufferCount) == 0;
+    delete[] iov;
+    return true;
+}
+
+/****************************************************************************/
+
+void RF24LogUringSink::closeRing()
+{
+    if (_ringFd < 0)
+    {
+        return;
+    }
+    if (_sqes)
+    {
+        munmap(_sqes, _sqesSize);
+    }
+    if (_cqRing && _cqRing != _sqRing)
+    {
+        munmap(_cqRing, _cqRingSize);
+    }
+    if (_sqRing)
+    {
+        munmap(_sqRing, _sqRingSize);
+    }
+    _sqes = _cqRing = _sqRing = nullptr;
+    close(_ringFd); // also unregisters the buffers
+    _ringFd = -1;
+}
+
+/****************************************************************************/
+
+bool RF24LogUringSink::submitRing(uint8_t index)
+{
+    Buffer *buffer = &_buffers[index];
+    uint32_t tail = *_sqTail; // only changed by this object (under _mutex)
+    uint32_t slot = tail & _sqMask;
+    struct io_uring_sqe *sqe = static_cast<struct io_uring_sqe *>(_sqes) + slot;
+    memset(sqe, 0, sizeof(*sqe));
+    sqe->opcode = _fixedBuffers ? IORING_OP_WRITE_FIXED : IORING_OP_WRITE;
+    sqe->fd = _fd;
+    sqe->addr = (uint64_t)(uintptr_t)(buffer->data + buffer->done);
+    sqe->len = (uint32_t)(buffer->used - buffer->done);
+    sqe->off = (uint64_t)(buffer->offset + (off_t)buffer->done);
+    sqe->buf_index = index;
+    sqe->user_data = index;
+    _sqArray[slot] = slot;
+    __atomic_store_n(_sqTail, tail + 1, __ATOMIC_RELEASE);
+
+    while (true)
+    {
+        int submitted = (int)syscall(__NR_io_uring_enter, _ringFd, 1U, 0U, 0U, nullptr, 0);
+        if (submitted > 0)
+        {
+            return true;
+        }
+        if (submitted < 0 && errno == EINTR)
+        {
+            continue;
+        }
+        if (submitted == 0 || errno == EAGAIN || errno == EBUSY)
+        {
+            // the kernel is short of resources (or completions); make room and retry
+            if (_inFlight > 1)
+            {
+                reap(1);
+                continue;
+            }
+        }
+        __atomic_store_n(_sqTail, tail, __ATOMIC_RELEASE); // take the request back
+        return false;
+    }
+}
+
+/****************************************************************************/
+
+void RF24LogUringSink::reap(unsigned minimum)
+{
+    unsigned completed = 0;
+    while (true)
+    {
+        uint32_t head = *_cqHead; // only changed by this object (under _mutex)
+        uint32_t tail = __atomic_load_n(_cqTail, __ATOMIC_ACQUIRE);
+        while (head != tail)
+        {
+            struct io_uring_cqe *cqe = static_cast<struct io_uring_cqe *>(_cqes) + (head & _cqMask);
+            uint8_t index = (uint8_t)cqe->user_data;
+            int32_t result = cqe->res;
+            ++head;
+            __atomic_store_n(_cqHead, head, __ATOMIC_RELEASE);
+
+            Buffer *buffer = &_buffers[index];
+            if (result == -EINTR || result == -EAGAIN)
+            {
+                if (submitRing(index))
+                {
+                    continue;
+                }
+                result = -EINVAL;
+            }
+            if (result == -EINVAL || result == -EOPNOTSUPP)
+            {
+                // this kernel can't do the operation; write the rest synchronously
+                if (!pwriteAll(_fd, buffer->data + buffer->done, buffer->used - buffer->done,
+                               buffer->offset + (off_t)buffer->done))
+                {
+                    _errors.fetch_add(1, std::memory_order_relaxed);
+                }
+            }
+            else if (result <= 0)
+            {
+                _errors.fetch_add(1, std::memory_order_relaxed);
+            }
+            else
+            {
+                buffer->done += (size_t)result;
+                if (buffer->done < buffer->used && submitRing(index))
+                {
+                    continue; // a short write; the rest is in flight again
+                }
+                if (buffer->done < buffer->used)
+                {
+                    _errors.fetch_add(1, std::memory_order_relaxed);
+                }
+            }
+            complete(index);
+            ++completed;
+        }
+        if (completed >= minimum || _inFlight == 0)
+        {
+            return;
+        }
+        int waited = (int)syscall(__NR_io_uring_enter, _ringFd, 0U, minimum - completed, (unsigned)IORING_ENTER_GETEVENTS, nullptr, 0);
+        if (waited < 0 && errno != EINTR)
+        {
+            return;
+        }
+    }
+}
+
+#else // !defined (RF24LOG_URING)
+
+bool RF24LogUringSink::setupRing(uint8_t entries)
+{
+    (void)entries;
+    return false;
+}
+
+void RF24LogUringSink::closeRing() {}
+
+bool RF24LogUringSink::submitRing(uint8_t index)
+{
+    (void)index;
+    return false;
+}
+
+void RF24LogUringSink::reap(unsigned minimum)
+{
+    (void)minimum;
+}
+
+#endif // !defined (RF24LOG_URING)
+#endif // defined (RF24LOG_POSIX)
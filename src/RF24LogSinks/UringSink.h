@@ -0,0 +1,193 @@
+/**
+ * @file UringSink.h
+ * @brief sink that writes batches of formatted log messages to a file asynchronously with io_uring
+ * @date Created 19 Oct 2026
+ * @author Brendan Doherty (2bndy5)
+ * @copyright Copyright (C) <br>
+ *     2026    Brendan Doherty (2bndy5) <br>
+ * This General Public License does not permit incorporating your program into
+ * proprietary programs.  If your program is a subroutine library, you may
+ * consider it more useful to permit linking proprietary applications with the
+ * library.  If this is what you want to do, use the GNU Lesser General
+ * Public License instead of this License.
+ */
+
+#ifndef SRC_RF24LOGSINKS_URINGSINK_H_
+#define SRC_RF24LOGSINKS_URINGSINK_H_
+
+#include "../RF24LogParts/Common.h" // RF24LOG_POSIX
+#include "../RF24LogParts/Sink.h"
+
+#if defined (RF24LOG_POSIX)
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <mutex>
+#include <thread>
+#include <sys/types.h> // off_t
+
+/**
+ * @brief A sink that fills buffers with records and writes each full buffer to a file
+ * without waiting for the disk.
+ *
+ * On Linux, the buffers are registered with an io_uring and each full buffer is submitted
+ * as 1 write; up to `bufferCount - 1` writes stay in flight while the next buffer fills.
+ * Completions are collected from the shared completion ring by the logging threads (no
+ * system call and no helper thread per batch). The sink falls back to `pwrite()` (called
+ * with the lock released) when io_uring is unavailable (older kernels, seccomp filters, or
+ * a non-Linux OS).
+ *
+ * Like RF24LogWritevSink, a buffer is also written when an @ref ERROR (or more severe)
+ * message is written, and when its oldest record has waited @p maxLatency milliseconds.
+ *
+ * @note The file descriptor must be a regular file that is not opened with `O_APPEND`:
+ * every buffer is written at its own offset (starting at the end of the file), so writes that
+ * complete out of order still land in order.
+ */
+class RF24LogUringSink : public RF24LogSink
+{
+public:
+
+    /**
+     * @brief Instance constructor
+     * @param fd The file to write (it is not closed by this object)
+     * @param bufferSize The size of a buffer in bytes. The buffers are allocated from the
+     * RF24LogMemory budget, so they can be smaller; if they are refused, each record is
+     * written on its own.
+     * @param bufferCount The number of buffers (at least 2)
+     * @param maxLatency The maximum time (in milliseconds) a record waits in a buffer.
+     * Use `0` to disable the background thread.
+     * @param useUring Use `false` to always write with `pwrite()`
+     */
+    RF24LogUringSink(int fd, size_t bufferSize = 65536, uint8_t bufferCount = 8,
+                     uint32_t maxLatency = 100, bool useUring = true);
+
+    /** @brief writes the pending records, waits for the writes in flight and stops the background thread */
+    ~RF24LogUringSink();
+
+    void write(const char *data, size_t length, uint8_t logLevel);
+
+    /** @brief write the pending records and wait until every write has completed */
+    void flush();
+
+    /** @brief are the buffers written with io_uring (rather than `pwrite()`)? */
+    bool isAsync() { return _ringFd >= 0; }
+
+    /** @brief the number of buffers being written now */
+    uint8_t queueDepth();
+
+    /** @brief the largest number of buffers that were being written at once */
+    uint8_t maxQueueDepth() { return _maxQueueDepth.load(std::memory_order_relaxed); }
+
+    /** @brief the number of records written (or being buffered) */
+    uint64_t records() { return _records.load(std::memory_order_relaxed); }
+
+    /** @brief the number of buffers written */
+    uint64_t completions() { return _completions.load(std::memory_order_relaxed); }
+
+    /**
+     * @brief the average time (in microseconds) from submitting a buffer to collecting its completion.
+     *
+     * Completions are collected when records are written, so this is an upper bound of the
+     * time the kernel needed.
+     */
+    uint32_t averageLatency();
+
+    /** @brief the longest time (in microseconds) from submitting a buffer to collecting its completion */
+    uint32_t maxLatency() { return _maxLatencyUs.load(std::memory_order_relaxed); }
+
+    /** @brief the number of buffers (or parts of buffers) lost to write errors */
+    uint64_t errors() { return _errors.load(std::memory_order_relaxed); }
+
+private:
+
+    /** @brief A buffer of records */
+    struct Buffer
+    {
+        char *data;
+        /** @brief The number of bytes filled */
+        size_t used;
+        /** @brief The number of bytes written so far (while in flight) */
+        size_t done;
+        /** @brief Where the buffer goes in the file */
+        off_t offset;
+        std::chrono::steady_clock::time_point submitted;
+        bool inFlight;
+    };
+
+    /** @brief set up the io_uring and register the buffers; false if io_uring is unavailable */
+    bool setupRing(uint8_t entries);
+
+    /** @brief unmap and close the io_uring */
+    void closeRing();
+
+    /** @brief write the active buffer and make another buffer active (the caller holds @p lock) */
+    void submitLocked(std::unique_lock<std::mutex> &lock);
+
+    /** @brief queue the (rest of the) write of a buffer to the io_uring */
+    bool submitRing(uint8_t index);
+
+    /** @brief write a buffer with `pwrite()` (the caller holds @p lock, which is released meanwhile) */
+    void writeSync(uint8_t index, std::unique_lock<std::mutex> &lock);
+
+    /** @brief handle the completed writes; wait for at least @p minimum completions */
+    void reap(unsigned minimum);
+
+    /** @brief a buffer's write has finished (successfully or not) */
+    void complete(uint8_t index);
+
+    /** @brief the background thread that enforces the maximum latency */
+    void run();
+
+    int _fd;
+    size_t _bufferSize;
+    uint8_t _bufferCount;
+    std::chrono::milliseconds _maxLatency;
+    /** @brief The file offset of the next buffer */
+    off_t _offset;
+
+    Buffer *_buffers;
+    /** @brief The buffer being filled */
+    uint8_t _active;
+    /** @brief The number of buffers in flight */
+    uint8_t _inFlight;
+    /** @brief When the active buffer has to be written */
+    std::chrono::steady_clock::time_point _deadline;
+
+    /** @brief The io_uring (-1 when writing with `pwrite()`) */
+    int _ringFd;
+    /** @brief Were the buffers registered (for fixed-buffer writes)? */
+    bool _fixedBuffers;
+    void *_sqRing;
+    size_t _sqRingSize;
+    void *_cqRing;
+    size_t _cqRingSize;
+    void *_sqes;
+    size_t _sqesSize;
+    uint32_t *_sqHead;
+    uint32_t *_sqTail;
+    uint32_t _sqMask;
+    uint32_t *_sqArray;
+    uint32_t *_cqHead;
+    uint32_t *_cqTail;
+    uint32_t _cqMask;
+    void *_cqes;
+
+    /** @brief guards everything above */
+    std::mutex _mutex;
+    /** @brief signals the background thread, and buffers freed by `pwrite()` */
+    std::condition_variable _wakeup;
+    std::condition_variable _freed;
+    std::thread _flusher;
+    bool _stopping;
+
+    std::atomic<uint8_t> _maxQueueDepth;
+    std::atomic<uint64_t> _records;
+    std::atomic<uint64_t> _completions;
+    std::atomic<uint64_t> _totalLatencyUs;
+    std::atomic<uint32_t> _maxLatencyUs;
+    std::atomic<uint64_t> _errors;
+};
+
+#endif // defined (RF24LOG_POSIX)
+#endif /* SRC_RF24LOGSINKS_URINGSINK_H_ */
@@ -0,0 +1,335 @@
+/**
+ * @file WatchdogSink.cpp
+ * @date Created 19 Oct 2026
+ * @author Brendan Doherty (2bndy5)
+ * @copyright Copyright (C) <br>
+ *     2026    Brendan Doherty (2bndy5) <br>
+ * This General Public License does not permit incorporating your program into
+ * proprietary programs.  If your program is a subroutine library, you may
+ * consider it more useful to permit linking proprietary applications with the
+ * library.  If this is what you want to do, use the GNU Lesser General
+ * Public License instead of this License.
+ */
+
+#include "WatchdogSink.h"
+
+#if defined (RF24LOG_POSIX)
+#include <string.h> // memcpy()
+#include "../RF24LogParts/Memory.h"
+
+/** @brief The Entry::length of the unused bytes at the end of the buffer */
+#define RF24LOG_WATCHDOG_PADDING 0xFFFFFFFFUL
+/** @brief The Entry::length of a flush request */
+#define RF24LOG_WATCHDOG_FLUSH 0xFFFFFFFEUL
+
+/****************************************************************************/
+
+RF24LogWatchdogSink::RF24LogWatchdogSink(RF24LogSink *sink, RF24LogSink *fallback, uint32_t deadline,
+                                         size_t bufferSize, uint32_t probeInterval)
+    : _sink(sink), _fallback(fallback), _deadline(deadline), _probeInterval(probeInterval),
+      _size(bufferSize), _head(0), _tail(0), _used(0), _pushed(0), _popped(0), _healthy(true), _writing(false),
+      _idle(false), _stopping(false), _records(0), _written(0), _redirected(0), _lost(0), _failovers(0),
+      _recoveries(0), _lastLatency(0), _maxLatency(0)
+{
+    // from the memory budget (maybe smaller); without it, the records are lost (and counted)
+    _buffer = static_cast<char *>(RF24LogMemory::allocate(&_size, sizeof(Entry) + 1));
+    _thread = std::thread(&RF24LogWatchdogSink::run, this);
+}
+
+/****************************************************************************/
+
+RF24LogWatchdogSink::~RF24LogWatchdogSink()
+{
+    {
+        std::lock_guard<std::mutex> lock(_mutex);
+        _stopping = true;
+    }
+    _wakeup.notify_one();
+    _thread.join();
+
+    // the records of an unhealthy sink (without a fallback sink) can't be written anymore
+    Entry entry;
+    const char *data;
+    while (frontLocked(&entry, &data))
+    {
+        if (entry.length != RF24LOG_WATCHDOG_FLUSH)
+        {
+            _lost.fetch_add(1, std::memory_order_relaxed);
+        }
+        popLocked(&entry);
+    }
+    RF24LogMemory::release(_buffer);
+}
+
+/****************************************************************************/
+
+void RF24LogWatchdogSink::write(const char *data, size_t length, uint8_t logLevel)
+{
+    std::unique_lock<std::mutex> lock(_mutex);
+    _records.fetch_add(1, std::memory_order_relaxed);
+    checkLocked();
+    if (!_healthy && _fallback)
+    {
+        _fallback->write(data, length, logLevel);
+        _redirected.fetch_add(1, std::memory_order_relaxed);
+        return;
+    }
+    if (!pushLocked(data, (uint32_t)length, logLevel))
+    {
+        _lost.fetch_add(1, std::memory_order_relaxed);
+        return;
+    }
+    if (_idle && _healthy)
+    {
+        _idle = false;
+        _wakeup.notify_one();
+    }
+}
+
+/****************************************************************************/
+
+void RF24LogWatchdogSink::flush()
+{
+    std::unique_lock<std::mutex> lock(_mutex);
+    checkLocked();
+    // wait for the records queued so far, even if the flush marker doesn't fit behind them yet
+    bool marked = _healthy && pushLocked(nullptr, RF24LOG_WATCHDOG_FLUSH, 0);
+    uint64_t ticket = _pushed;
+    while (_healthy && _popped < ticket)
+    {
+        if (_idle)
+        {
+            _idle = false;
+            _wakeup.notify_one();
+        }
+        _drained.wait_for(lock, _deadline);
+        checkLocked();
+        if (!marked && _healthy && pushLocked(nullptr, RF24LOG_WATCHDOG_FLUSH, 0))
+        {
+            marked = true;
+            ticket = _pushed;
+        }
+    }
+    if (!_healthy && _fallback)
+    {
+        _fallback->flush();
+    }
+}
+
+/****************************************************************************/
+
+bool RF24LogWatchdogSink::isHealthy()
+{
+    std::lock_guard<std::mutex> lock(_mutex);
+    checkLocked();
+    return _healthy;
+}
+
+/****************************************************************************/
+
+bool RF24LogWatchdogSink::pushLocked(const char *data, uint32_t length, uint8_t logLevel)
+{
+    size_t bytes = data == nullptr ? 0 : length;
+    size_t need = sizeof(Entry) + bytes;
+    // the entry starts at the beginning of the buffer instead (even if _head is at its end)
+    bool wrap = _size - _head < need;
+    size_t padding = wrap ? _size - _head : 0;
+    if (_used + padding + need > _size)
+    {
+        return false;
+    }
+    if (wrap)
+    {
+        if (padding >= sizeof(Entry))
+        {
+            Entry pad = {RF24LOG_WATCHDOG_PADDING, 0};
+            memcpy(_buffer + _head, &pad, sizeof(Entry));
+        }
+        _used += padding;
+        _head = 0;
+    }
+    Entry entry = {length, logLevel};
+    memcpy(_buffer + _head, &entry, sizeof(Entry));
+    if (bytes)
+    {
+        memcpy(_buffer + _head + sizeof(Entry), data, bytes);
+    }
+    _head += need;
+    _used += need;
+    ++_pushed;
+    return true;
+}
+
+/****************************************************************************/
+
+bool RF24LogWatchdogSink::frontLocked(Entry *entry, const char **data)
+{
+    while (_used)
+    {
+        // skip the padding at the end of the buffer (too short for an Entry, or marked as padding)
+        if (_size - _tail >= sizeof(Entry))
+        {
+            memcpy(entry, _buffer + _tail, sizeof(Entry));
+            if (entry->length != RF24LOG_WATCHDOG_PADDING)
+            {
+                *data = _buffer + _tail + sizeof(Entry);
+                return true;
+            }
+        }
+        _used -= _size - _tail;
+        _tail = 0;
+    }
+    return false;
+}
+
+/****************************************************************************/
+
+void RF24LogWatchdogSink::popLocked(const Entry *entry)
+{
+    size_t need = sizeof(Entry) + (entry->length == RF24LOG_WATCHDOG_FLUSH ? 0 : entry->length);
+    _tail += need;
+    _used -= need;
+    if (!_used)
+    {
+        _head = 0; // the next records start at the beginning of the buffer
+        _tail = 0;
+    }
+    ++_popped;
+}
+
+/****************************************************************************/
+
+void RF24LogWatchdogSink::checkLocked()
+{
+    if (_healthy && _writing && std::chrono::steady_clock::now() - _writeStart > _deadline)
+    {
+        failoverLocked();
+    }
+}
+
+/****************************************************************************/
+
+void RF24LogWatchdogSink::failoverLocked()
+{
+    _healthy = false;
+    _failovers.fetch_add(1, std::memory_order_relaxed);
+    if (_fallback == nullptr)
+    {
+        return; // the records wait for the sink to recover
+    }
+
+    // the entry being written by the background thread stays (at the front of the buffer)
+    Entry entry;
+    const char *data;
+    size_t keptTail = _tail, keptUsed = 0;
+    if (_writing && frontLocked(&entry, &data))
+    {
+        keptTail = _tail;
+        keptUsed = sizeof(Entry) + (entry.length == RF24LOG_WATCHDOG_FLUSH ? 0 : entry.length);
+        _tail += keptUsed;
+        _used -= keptUsed;
+    }
+    while (frontLocked(&entry, &data))
+    {
+        if (entry.length != RF24LOG_WATCHDOG_FLUSH)
+        {
+            _fallback->write(data, entry.length, entry.logLevel);
+            _redirected.fetch_add(1, std::memory_order_relaxed);
+        }
+        popLocked(&entry);
+    }
+    if (keptUsed)
+    {
+        _tail = keptTail;
+        _head = keptTail + keptUsed;
+        _used = keptUsed;
+    }
+}
+
+/****************************************************************************/
+
+std::chrono::steady_clock::duration RF24LogWatchdogSink::timedLocked(std::unique_lock<std::mutex> &lock,
+                                                                     const char *data, uint32_t length,
+                                                                     uint8_t logLevel)
+{
+    _writeStart = std::chrono::steady_clock::now();
+    _writing = true;
+    lock.unlock();
+    if (data == nullptr)
+    {
+        _sink->flush();
+    }
+    else
+    {
+        _sink->write(data, length, logLevel);
+    }
+    std::chrono::steady_clock::duration latency = std::chrono::steady_clock::now() - _writeStart;
+    lock.lock();
+    _writing = false;
+
+    long long micros = std::chrono::duration_cast<std::chrono::microseconds>(latency).count();
+    uint32_t latencyMicros = micros > 0xFFFFFFFFLL ? 0xFFFFFFFFUL : (uint32_t)micros;
+    _lastLatency.store(latencyMicros, std::memory_order_relaxed);
+    if (latencyMicros > _maxLatency.load(std::memory_order_relaxed))
+    {
+        _maxLatency.store(latencyMicros, std::memory_order_relaxed);
+    }
+    return latency;
+}
+
+/****************************************************************************/
+
+void RF24LogWatchdogSink::run()
+{
+    std::unique_lock<std::mutex> lock(_mutex);
+    while (true)
+    {
+        if (!_healthy)
+        {
+            // probe the sink until it responds within the deadline again
+            if (!_stopping)
+            {
+                _wakeup.wait_for(lock, _probeInterval);
+            }
+            if (_stopping)
+            {
+                break;
+            }
+            if (timedLocked(lock, nullptr, 0, 0) <= _deadline)
+            {
+                _healthy = true;
+                _recoveries.fetch_add(1, std::memory_order_relaxed);
+            }
+            continue;
+        }
+
+        Entry entry;
+        const char *data;
+        if (!frontLocked(&entry, &data))
+        {
+            if (_stopping)
+            {
+                break;
+            }
+            _idle = true;
+            _wakeup.wait(lock);
+            continue;
+        }
+        bool isFlush = entry.length == RF24LOG_WATCHDOG_FLUSH;
+        std::chrono::steady_clock::duration latency = timedLocked(lock, isFlush ? nullptr : data, entry.length,
+                                                                  entry.logLevel);
+        popLocked(&entry);
+        if (!isFlush)
+        {
+            _written.fetch_add(1, std::memory_order_relaxed);
+        }
+        if (_healthy && latency > _deadline)
+        {
+            failoverLocked(); // slow, but nobody logged while it was blocked
+        }
+        _drained.notify_all();
+    }
+    _drained.notify_all();
+}
+
+#endif // defined (RF24LOG_POSIX)
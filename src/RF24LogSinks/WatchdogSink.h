@@ -0,0 +1,183 @@
+/**
+ * @file WatchdogSink.h
+ * @brief sink that supervises another sink's write latency and fails over when it stalls
+ * @date Created 19 Oct 2026
+ * @author Brendan Doherty (2bndy5)
+ * @copyright Copyright (C) <br>
+ *     2026    Brendan Doherty (2bndy5) <br>
+ * This General Public License does not permit incorporating your program into
+ * proprietary programs.  If your program is a subroutine library, you may
+ * consider it more useful to permit linking proprietary applications with the
+ * library.  If this is what you want to do, use the GNU Lesser General
+ * Public License instead of this License.
+ */
+
+#ifndef SRC_RF24LOGSINKS_WATCHDOGSINK_H_
+#define SRC_RF24LOGSINKS_WATCHDOGSINK_H_
+
+#include "../RF24LogParts/Common.h" // RF24LOG_POSIX
+#include "../RF24LogParts/Sink.h"
+
+#if defined (RF24LOG_POSIX)
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <mutex>
+#include <thread>
+
+/**
+ * @brief A sink that keeps a stalled sink (a wedged network mount, a full pipe, a stuck serial
+ * adapter...) from blocking the threads that log.
+ *
+ * The records are queued in a buffer in memory, and a background thread writes them to the
+ * supervised sink, timing each write. The sink is marked unhealthy when a write takes longer
+ * than the deadline (this is noticed by the next record logged while the write is still
+ * blocked, or when the write returns). Then:
+ * - with a fallback sink, the queued records (except the one being written) and the next
+ *   records are written to the fallback sink instead, by the threads that log them.
+ * - without a fallback sink, the records stay in the buffer until the sink recovers; the
+ *   records that don't fit in the buffer are lost (and counted).
+ *
+ * Once the blocked write returns, the thread probes the sink with a flush() every
+ * `probeInterval` milliseconds, and re-attaches it when a probe completes within the
+ * deadline. The records written to the fallback sink stay there.
+ *
+ * A background thread cannot interrupt a blocked write, so destroying this sink waits for
+ * the supervised sink's write in progress (if any) to return.
+ */
+class RF24LogWatchdogSink : public RF24LogSink
+{
+public:
+
+    /**
+     * @brief Instance constructor
+     * @param sink The supervised sink
+     * @param fallback The sink that receives the records while @p sink is unhealthy (`nullptr`
+     * to keep them in the buffer). It should not block (like a RF24LogWritevSink to `stderr`).
+     * @param deadline The maximum time (in milliseconds) that a write (or a flush) of @p sink
+     * may take
+     * @param bufferSize The size (in bytes) of the buffer of queued records. It is allocated from
+     * the RF24LogMemory budget, so it can be smaller; if it is refused, the records are lost.
+     * @param probeInterval The time (in milliseconds) between the probes of an unhealthy @p sink
+     */
+    RF24LogWatchdogSink(RF24LogSink *sink, RF24LogSink *fallback = nullptr, uint32_t deadline = 100,
+                        size_t bufferSize = 65536, uint32_t probeInterval = 1000);
+
+    /** @brief writes the queued records (if the sink is healthy) and stops the background thread */
+    ~RF24LogWatchdogSink();
+
+    void write(const char *data, size_t length, uint8_t logLevel);
+
+    /**
+     * @brief wait for the queued records to be written and flushed (while the sink is healthy;
+     * this waits no longer than the deadline for a stalled sink), then flush the fallback sink
+     * (while the sink is unhealthy)
+     */
+    void flush();
+
+    /** @brief is the supervised sink receiving the records? */
+    bool isHealthy();
+
+    /** @brief the number of records written to this sink */
+    uint64_t records() { return _records.load(std::memory_order_relaxed); }
+
+    /** @brief the number of records written to the supervised sink */
+    uint64_t written() { return _written.load(std::memory_order_relaxed); }
+
+    /** @brief the number of records written to the fallback sink */
+    uint64_t redirected() { return _redirected.load(std::memory_order_relaxed); }
+
+    /** @brief the number of records lost because they didn't fit in the buffer */
+    uint64_t lost() { return _lost.load(std::memory_order_relaxed); }
+
+    /** @brief the number of times the supervised sink was marked unhealthy */
+    uint32_t failovers() { return _failovers.load(std::memory_order_relaxed); }
+
+    /** @brief the number of times the supervised sink was re-attached */
+    uint32_t recoveries() { return _recoveries.load(std::memory_order_relaxed); }
+
+    /** @brief the time (in microseconds) taken by the last write (or probe) of the supervised sink */
+    uint32_t lastLatency() { return _lastLatency.load(std::memory_order_relaxed); }
+
+    /** @brief the longest time (in microseconds) taken by a write (or probe) of the supervised sink */
+    uint32_t maxLatency() { return _maxLatency.load(std::memory_order_relaxed); }
+
+private:
+
+    /** @brief The header of a queued record (followed by its bytes) */
+    struct Entry
+    {
+        /** @brief The number of bytes of the record (or a marker for a padding or a flush) */
+        uint32_t length;
+        uint8_t logLevel;
+    };
+
+    /** @brief queue a record (or a flush marker if @p data is nullptr); false if it doesn't fit */
+    bool pushLocked(const char *data, uint32_t length, uint8_t logLevel);
+
+    /** @brief the oldest queued record (false if there is none) */
+    bool frontLocked(Entry *entry, const char **data);
+
+    /** @brief release the record from frontLocked() */
+    void popLocked(const Entry *entry);
+
+    /** @brief mark the sink unhealthy if its write in progress exceeded the deadline */
+    void checkLocked();
+
+    /** @brief mark the sink unhealthy, and move the queued records to the fallback sink */
+    void failoverLocked();
+
+    /**
+     * @brief write a record to the supervised sink (or flush it if @p data is nullptr) with
+     * @p lock released, timing the call
+     */
+    std::chrono::steady_clock::duration timedLocked(std::unique_lock<std::mutex> &lock, const char *data,
+                                                    uint32_t length, uint8_t logLevel);
+
+    /** @brief the background thread that writes (and probes) the supervised sink */
+    void run();
+
+    RF24LogSink *_sink;
+    RF24LogSink *_fallback;
+    std::chrono::milliseconds _deadline;
+    std::chrono::milliseconds _probeInterval;
+
+    /** @brief The queued records (a ring of entries that never wrap around the end) */
+    char *_buffer;
+    size_t _size;
+    /** @brief The offsets of the next entry to write, and of the oldest entry */
+    size_t _head;
+    size_t _tail;
+    /** @brief The number of bytes between the oldest entry and the next entry (with any padding) */
+    size_t _used;
+    /** @brief The number of entries queued, and of entries that left the buffer */
+    uint64_t _pushed;
+    uint64_t _popped;
+
+    /** @brief Is the supervised sink receiving the records? */
+    bool _healthy;
+    /** @brief Is the background thread in a call to the supervised sink (since _writeStart)? */
+    bool _writing;
+    std::chrono::steady_clock::time_point _writeStart;
+    /** @brief Is the background thread waiting for records? */
+    bool _idle;
+    bool _stopping;
+
+    /** @brief guards everything above (but not the calls to the supervised sink) */
+    std::mutex _mutex;
+    std::condition_variable _wakeup;
+    std::condition_variable _drained;
+    std::thread _thread;
+
+    std::atomic<uint64_t> _records;
+    std::atomic<uint64_t> _written;
+    std::atomic<uint64_t> _redirected;
+    std::atomic<uint64_t> _lost;
+    std::atomic<uint32_t> _failovers;
+    std::atomic<uint32_t> _recoveries;
+    std::atomic<uint32_t> _lastLatency;
+    std::atomic<uint32_t> _maxLatency;
+};
+
+#endif // defined (RF24LOG_POSIX)
+#endif /* SRC_RF24LOGSINKS_WATCHDOGSINK_H_ */
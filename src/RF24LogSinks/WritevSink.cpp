@@ -0,0 +1,215 @@
+/**
+ * @file WritevSink.cpp
+ * @date Created 19 Oct 2026
+ * @author Brendan Doherty (2bndy5)
+ * @copyright Copyright (C) <br>
+ *     2026    Brendan Doherty (2bndy5) <br>
+ * This General Public License does not permit incorporating your program into
+ * proprietary programs.  If your program is a subroutine library, you may
+ * consider it more useful to permit linking proprietary applications with the
+ * library.  If this is what you want to do, use the GNU Lesser General
+ * Public License instead of this License.
+ */
+
+#include "WritevSink.h"
+
+#if defined (RF24LOG_POSIX)
+#include <errno.h>   // errno, EINTR, EAGAIN
+#include <limits.h>  // IOV_MAX
+#include <poll.h>    // poll()
+#include <string.h>  // memcpy()
+#include "../RF24LogLevel.h"
+#include "../RF24LogParts/Memory.h"
+
+#ifndef IOV_MAX
+#define IOV_MAX 1024
+#endif
+
+/****************************************************************************/
+
+RF24LogWritevSink::RF24LogWritevSink(int fd, size_t maxBytes, uint16_t maxRecords, uint32_t maxLatency)
+    : _maxLatency(maxLatency), _records(0), _writeCalls(0), _errors(0)
+{
+    _fd = fd;
+    maxRecords = maxRecords < 1 ? 1 : (maxRecords > IOV_MAX ? IOV_MAX : maxRecords);
+
+    // both batches come from the memory budget (maybe smaller); without them, each record is written on its own
+    size_t bytes = maxBytes * 2;
+    char *buffer = static_cast<char *>(RF24LogMemory::allocate(&bytes, 2));
+    size_t records = (size_t)maxRecords * 2;
+    struct iovec *iov = RF24LogMemory::allocateArray<struct iovec>(&records, 2);
+    if (buffer == nullptr || iov == nullptr)
+    {
+        RF24LogMemory::release(buffer);
+        RF24LogMemory::releaseArray(iov, records);
+        buffer = nullptr;
+        iov = nullptr;
+        bytes = 0;
+        records = 0;
+    }
+    _maxBytes = bytes / 2;
+    _maxRecords = (uint16_t)(records / 2);
+    for (uint8_t i = 0; i < 2; ++i)
+    {
+        _batches[i].buffer = buffer == nullptr ? nullptr : buffer + i * _maxBytes;
+        _batches[i].used = 0;
+        _batches[i].iov = iov == nullptr ? nullptr : iov + i * _maxRecords;
+        _batches[i].count = 0;
+    }
+    _active = &_batches[0];
+    _spare = &_batches[1];
+    _stopping = false;
+    if (maxLatency)
+    {
+        _flusher = std::thread(&RF24LogWritevSink::run, this);
+    }
+}
+
+/****************************************************************************/
+
+RF24LogWritevSink::~RF24LogWritevSink()
+{
+    {
+        std::lock_guard<std::mutex> lock(_mutex);
+        _stopping = true;
+    }
+    _wakeup.notify_one();
+    if (_flusher.joinable())
+    {
+        _flusher.join();
+    }
+    flush();
+    RF24LogMemory::release(_batches[0].buffer);
+    RF24LogMemory::releaseArray(_batches[0].iov, (size_t)_maxRecords * 2);
+}
+
+/****************************************************************************/
+
+void RF24LogWritevSink::write(const char *data, size_t length, uint8_t logLevel)
+{
+    std::unique_lock<std::mutex> lock(_mutex);
+    _records.fetch_add(1, std::memory_order_relaxed);
+    while (_active->count && _active->used + length > _maxBytes)
+    {
+        flushLocked(lock); // other producers may add to the next batch while the lock is released
+    }
+    if (length > _maxBytes || _maxBytes == 0)
+    {
+        // too large for a batch: write it on its own (still in order)
+        std::lock_guard<std::mutex> io(_ioMutex);
+        struct iovec single = {const_cast<char *>(data), length};
+        writeAll(&single, 1);
+        return;
+    }
+
+    Batch *batch = _active;
+    memcpy(batch->buffer + batch->used, data, length);
+    batch->iov[batch->count].iov_base = batch->buffer + batch->used;
+    batch->iov[batch->count].iov_len = length;
+    batch->used += length;
+    if (batch->count++ == 0 && _maxLatency.count())
+    {
+        _deadline = std::chrono::steady_clock::now() + _maxLatency;
+        _wakeup.notify_one();
+    }
+
+    if (batch->count >= _maxRecords || batch->used >= _maxBytes
+        || rf24LogIsUrgent(logLevel))
+    {
+        flushLocked(lock);
+    }
+}
+
+/****************************************************************************/
+
+void RF24LogWritevSink::flush()
+{
+    std::unique_lock<std::mutex> lock(_mutex);
+    flushLocked(lock);
+}
+
+/****************************************************************************/
+
+void RF24LogWritevSink::flushLocked(std::unique_lock<std::mutex> &lock)
+{
+    if (_active->count == 0)
+    {
+        return;
+    }
+    // waiting for the previous batch's system call makes the spare batch available (and keeps the order)
+    std::unique_lock<std::mutex> io(_ioMutex);
+    Batch *batch = _active;
+    _active = _spare;
+    _spare = batch;
+    lock.unlock(); // producers can fill the other batch during the system call
+
+    writeAll(batch->iov, batch->count);
+    batch->used = 0;
+    batch->count = 0;
+
+    io.unlock();
+    lock.lock();
+}
+
+/****************************************************************************/
+
+void RF24LogWritevSink::writeAll(struct iovec *iov, uint16_t count)
+{
+    while (count)
+    {
+        ssize_t written = writev(_fd, iov, count);
+        _writeCalls.fetch_add(1, std::memory_order_relaxed);
+        if (written < 0)
+        {
+            if (errno == EINTR)
+            {
+                continue;
+            }
+            if (errno == EAGAIN || errno == EWOULDBLOCK)
+            {
+                struct pollfd ready = {_fd, POLLOUT, 0};
+                poll(&ready, 1, -1);
+                continue;
+            }
+            _errors.fetch_add(1, std::memory_order_relaxed);
+            return;
+        }
+        // skip the records that were completely written; finish a partially written record next
+        size_t done = (size_t)written;
+        while (count && done >= iov->iov_len)
+        {
+            done -= iov->iov_len;
+            ++iov;
+            --count;
+        }
+        if (count)
+        {
+            iov->iov_base = static_cast<char *>(iov->iov_base) + done;
+            iov->iov_len -= done;
+        }
+    }
+}
+
+/****************************************************************************/
+
+void RF24LogWritevSink::run()
+{
+    std::unique_lock<std::mutex> lock(_mutex);
+    while (!_stopping)
+    {
+        if (_active->count == 0)
+        {
+            _wakeup.wait(lock);
+        }
+        else if (std::chrono::steady_clock::now() >= _deadline)
+        {
+            flushLocked(lock);
+        }
+        else
+        {
+            _wakeup.wait_until(lock, _deadline);
+        }
+    }
+}
+
+#endif // defined (RF24LOG_POSIX)
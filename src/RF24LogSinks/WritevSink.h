@@ -0,0 +1,120 @@
+/**
+ * @file WritevSink.h
+ * @brief sink that batches formatted log messages into `writev()` calls on a file descriptor
+ * @date Created 19 Oct 2026
+ * @author Brendan Doherty (2bndy5)
+ * @copyright Copyright (C) <br>
+ *     2026    Brendan Doherty (2bndy5) <br>
+ * This General Public License does not permit incorporating your program into
+ * proprietary programs.  If your program is a subroutine library, you may
+ * consider it more useful to permit linking proprietary applications with the
+ * library.  If this is what you want to do, use the GNU Lesser General
+ * Public License instead of this License.
+ */
+
+#ifndef SRC_RF24LOGSINKS_WRITEVSINK_H_
+#define SRC_RF24LOGSINKS_WRITEVSINK_H_
+
+#include "../RF24LogParts/Common.h" // RF24LOG_POSIX
+#include "../RF24LogParts/Sink.h"
+
+#if defined (RF24LOG_POSIX)
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <mutex>
+#include <thread>
+#include <sys/uio.h> // struct iovec
+
+/**
+ * @brief A sink that accumulates records and writes them to a file descriptor with 1 `writev()`.
+ *
+ * A batch is written when it holds @p maxBytes or @p maxRecords, when its oldest record
+ * has waited @p maxLatency milliseconds (checked by a background thread), and immediately
+ * when an @ref ERROR (or more severe) message is written. A record is never split across
+ * batches; a record that is larger than a whole batch is written on its own.
+ *
+ * While a batch is written, new records fill a second batch, so producers only wait for
+ * the system call when both batches are full.
+ */
+class RF24LogWritevSink : public RF24LogSink
+{
+public:
+
+    /**
+     * @brief Instance constructor
+     * @param fd The file descriptor to write (it is not closed by this object)
+     * @param maxBytes The size of a batch in bytes. The batches are allocated from the
+     * RF24LogMemory budget, so they can be smaller; if they are refused, each record is
+     * written on its own.
+     * @param maxRecords The number of records in a batch (limited to `IOV_MAX`)
+     * @param maxLatency The maximum time (in milliseconds) a record waits in a batch.
+     * Use `0` to disable the background thread (batches are then only written when full,
+     * on errors and by flush()).
+     */
+    RF24LogWritevSink(int fd, size_t maxBytes = 65536, uint16_t maxRecords = 256, uint32_t maxLatency = 100);
+
+    /** @brief writes the pending records and stops the background thread */
+    ~RF24LogWritevSink();
+
+    void write(const char *data, size_t length, uint8_t logLevel);
+
+    void flush();
+
+    /** @brief the number of records written (or being batched) */
+    uint64_t records() { return _records.load(std::memory_order_relaxed); }
+
+    /** @brief the number of `writev()` system calls made */
+    uint64_t writeCalls() { return _writeCalls.load(std::memory_order_relaxed); }
+
+    /** @brief the number of batches (or parts of batches) lost to write errors */
+    uint64_t errors() { return _errors.load(std::memory_order_relaxed); }
+
+private:
+
+    /** @brief A batch of records */
+    struct Batch
+    {
+        char *buffer;
+        size_t used;
+        struct iovec *iov;
+        uint16_t count;
+    };
+
+    /** @brief write the active batch (the caller holds @p lock on _mutex) */
+    void flushLocked(std::unique_lock<std::mutex> &lock);
+
+    /** @brief write a sequence of whole records (retrying partial writes) */
+    void writeAll(struct iovec *iov, uint16_t count);
+
+    /** @brief the background thread that enforces the maximum latency */
+    void run();
+
+    int _fd;
+    size_t _maxBytes;
+    uint16_t _maxRecords;
+    std::chrono::milliseconds _maxLatency;
+
+    /** @brief The batch being filled */
+    Batch *_active;
+    /** @brief The batch being written (or free) */
+    Batch *_spare;
+    Batch _batches[2];
+    /** @brief When the active batch has to be written */
+    std::chrono::steady_clock::time_point _deadline;
+
+    /** @brief guards the active batch */
+    std::mutex _mutex;
+    /** @brief serializes the system calls (and guards the spare batch) */
+    std::mutex _ioMutex;
+    std::condition_variable _wakeup;
+    std::thread _flusher;
+    bool _stopping;
+
+    std::atomic<uint64_t> _records;
+    std::atomic<uint64_t> _writeCalls;
+    std::atomic<uint64_t> _errors;
+};
+
+#endif // defined (RF24LOG_POSIX)
+#endif /* SRC_RF24LOGSINKS_WRITEVSINK_H_ */
@@ -27,7 +27,7 @@ ArduinoPrintLogger::ArduinoPrintLogger(Print *stream)
 
 void ArduinoPrintLogger::appendTimestamp()
 {
-    unsigned long now = millis();
+    unsigned long now = headerTime();
     uint16_t w = numbCharsToPrint(now);
     appendChar(' ', (w < 10 ? 10 - w : 0));
     appendUInt(now, 10);
@@ -16,10 +16,11 @@
 #if defined (PICO_BUILD)
 #include <pico/stdlib.h> // to_ms_since_boot(), get_absolute_time()
 #else
-#include <ctime> // time_t, struct tm*, time(), localtime(), strftime()
+#include <ctime> // time_t, struct tm*, time(), localtime(), localtime_r(), strftime()
 #endif
 
 #include "NativePrintLogger.h"
+#include "../RF24LogParts/Profiler.h" // RF24LOG_PROFILE_SINK()
 
 /****************************************************************************/
 
@@ -31,18 +32,24 @@ NativePrintLogger::NativePrintLogger()
 
 void NativePrintLogger::appendTimestamp()
 {
+    RF24LOG_PROFILE_SINK();
     #if defined(PICO_BUILD)
-    printf_P("%10lu", to_ms_since_boot(get_absolute_time()));
+    printf_P("%10lu", (unsigned long)headerTime());
     printf_P("%c", RF24LOG_DELIMITER);
     #else // !defined (PICO_BUILD) && !defined (ARDUINO)
     char buffer[21];
-    time_t rawtime;
+    time_t rawtime = (time_t)(headerTime() / 1000000);
     struct tm* timeinfo;
-    time(&rawtime);
+    #if defined(RF24LOG_POSIX)
+    struct tm local;
+    timeinfo = localtime_r(&rawtime, &local); // localtime() isn't thread-safe
+    #else
     timeinfo = localtime(&rawtime);
+    #endif
 
     strftime(buffer, 20, "%F:%H:%M:%S", timeinfo);
-    buffer[20] = RF24LOG_DELIMITER;
+    buffer[19] = RF24LOG_DELIMITER;
+    buffer[20] = 0;
     printf_P("%s", buffer);
     #endif // defined (PICO_BUILD) && !defined (ARDUINO)
 }
@@ -51,6 +58,7 @@ void NativePrintLogger::appendTimestamp()
 
 void NativePrintLogger::appendChar(char data, uint16_t depth)
 {
+    RF24LOG_PROFILE_SINK();
     while (depth > 0)
     {
         --depth;
@@ -62,7 +70,7 @@ void NativePrintLogger::appendChar(char data, uint16_t depth)
 
 void NativePrintLogger::appendInt(long data)
 {
-
+    RF24LOG_PROFILE_SINK();
     printf_P("%li", (long)data);
 }
 
@@ -70,6 +78,7 @@ void NativePrintLogger::appendInt(long data)
 
 void NativePrintLogger::appendUInt(unsigned long data, uint8_t base)
 {
+    RF24LOG_PROFILE_SINK();
     if (base == 2)
     {
         if (!data)
@@ -109,6 +118,7 @@ void NativePrintLogger::appendUInt(unsigned long data, uint8_t base)
 
 void NativePrintLogger::appendDouble(double data, uint8_t precision)
 {
+    RF24LOG_PROFILE_SINK();
     char fmt_buf[64];
     sprintf(fmt_buf, "%%.%dF", precision); // prepares a fmt str ("%.nF")
     printf_P(fmt_buf, data);
@@ -118,6 +128,7 @@ void NativePrintLogger::appendDouble(double data, uint8_t precision)
 
 void NativePrintLogger::appendStr(const char* data)
 {
+    RF24LOG_PROFILE_SINK();
     printf_P("%s", data);
 }
 
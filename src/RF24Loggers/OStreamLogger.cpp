@@ -11,8 +11,9 @@
  * Public License instead of this License.
  */
 #ifndef ARDUINO
-#include <ctime> // for time_t, struct tm*, time(), localtime(), strftime()
+#include <ctime> // for time_t, struct tm*, time(), localtime(), localtime_r(), strftime()
 #include "OStreamLogger.h"
+#include "../RF24LogParts/Profiler.h" // RF24LOG_PROFILE_SINK()
 
 /****************************************************************************/
 
@@ -25,11 +26,16 @@ OStreamLogger::OStreamLogger(std::ostream *stream)
 
 void OStreamLogger::appendTimestamp()
 {
+    RF24LOG_PROFILE_SINK();
     char buffer[21];
-    time_t rawtime;
-    time(&rawtime);
+    time_t rawtime = (time_t)(headerTime() / 1000000);
 
+#if defined(RF24LOG_POSIX)
+    struct tm local;
+    strftime(buffer, 20, "%F:%H:%M:%S", localtime_r(&rawtime, &local)); // localtime() isn't thread-safe
+#else
     strftime(buffer, 20, "%F:%H:%M:%S", localtime(&rawtime));
+#endif
     buffer[19] = RF24LOG_DELIMITER;
     buffer[20] = 0;
     *_stream << buffer;
@@ -39,6 +45,7 @@ void OStreamLogger::appendTimestamp()
 
 void OStreamLogger::appendChar(char data, uint16_t depth)
 {
+    RF24LOG_PROFILE_SINK();
     while (depth)
     {
         --depth;
@@ -50,6 +57,7 @@ void OStreamLogger::appendChar(char data, uint16_t depth)
 
 void OStreamLogger::appendInt(long data)
 {
+    RF24LOG_PROFILE_SINK();
     *_stream << std::dec << data;
 }
 
@@ -57,6 +65,7 @@ void OStreamLogger::appendInt(long data)
 
 void OStreamLogger::appendUInt(unsigned long data, uint8_t base)
 {
+    RF24LOG_PROFILE_SINK();
     if (base == 2)
     {
         if (!data)
@@ -94,6 +103,7 @@ void OStreamLogger::appendUInt(unsigned long data, uint8_t base)
 
 void OStreamLogger::appendDouble(double data, uint8_t precision)
 {
+    RF24LOG_PROFILE_SINK();
     std::streamsize prev_precision = _stream->precision(precision);
     _stream->setf(std::ios::fixed, std::ios::floatfield);
     *_stream << data;
@@ -104,6 +114,7 @@ void OStreamLogger::appendDouble(double data, uint8_t precision)
 
 void OStreamLogger::appendStr(const char* data)
 {
+    RF24LOG_PROFILE_SINK();
     *_stream << data;
 }
 
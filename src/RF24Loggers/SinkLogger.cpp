@@ -0,0 +1,32 @@
+/**
+ * @file SinkLogger.cpp
+ * @date Created 19 Oct 2026
+ * @author Brendan Doherty (2bndy5)
+ * @copyright Copyright (C) <br>
+ *     2026    Brendan Doherty (2bndy5) <br>
+ * This General Public License does not permit incorporating your program into
+ * proprietary programs.  If your program is a subroutine library, you may
+ * consider it more useful to permit linking proprietary applications with the
+ * library.  If this is what you want to do, use the GNU Lesser General
+ * Public License instead of this License.
+ */
+
+#include "SinkLogger.h"
+
+#if defined (RF24LOG_HOSTED)
+
+/****************************************************************************/
+
+SinkLogger::SinkLogger(RF24LogSink *sink)
+{
+    _sink = sink;
+}
+
+/****************************************************************************/
+
+void SinkLogger::writeLine(const char *data, size_t length, uint8_t logLevel)
+{
+    _sink->write(data, length, logLevel);
+}
+
+#endif // defined (RF24LOG_HOSTED)
@@ -0,0 +1,43 @@
+/**
+ * @file SinkLogger.h
+ * @brief handler that formats log messages for a RF24LogSink
+ * @date Created 19 Oct 2026
+ * @author Brendan Doherty (2bndy5)
+ * @copyright Copyright (C) <br>
+ *     2026    Brendan Doherty (2bndy5) <br>
+ * This General Public License does not permit incorporating your program into
+ * proprietary programs.  If your program is a subroutine library, you may
+ * consider it more useful to permit linking proprietary applications with the
+ * library.  If this is what you want to do, use the GNU Lesser General
+ * Public License instead of this License.
+ */
+
+#ifndef SRC_RF24LOGGERS_SINKLOGGER_H_
+#define SRC_RF24LOGGERS_SINKLOGGER_H_
+
+#include "../RF24LogParts/LineFormatter.h"
+#include "../RF24LogParts/Sink.h"
+
+#if defined (RF24LOG_HOSTED)
+
+/** @brief Class to manage logging messages to a RF24LogSink (each message is written as 1 record). */
+class SinkLogger : public RF24LogLineFormatter
+{
+public:
+    /**
+     * @brief Construct a new SinkLogger object
+     * @param sink The destination of the formatted messages
+     */
+    SinkLogger(RF24LogSink *sink);
+
+protected:
+
+    void writeLine(const char *data, size_t length, uint8_t logLevel);
+
+private:
+    /** @brief The destination of the formatted messages */
+    RF24LogSink *_sink;
+};
+
+#endif // defined (RF24LOG_HOSTED)
+#endif /* SRC_RF24LOGGERS_SINKLOGGER_H_ */
@@ -12,6 +12,10 @@
  * Public License instead of this License.
  */
 #include <RF24Logging.h>
+#include "RF24LogParts/Profiler.h" // RF24LogProfiler (when RF24LOG_PROFILE is defined)
+#if defined (ARDUINO_ARCH_AVR)
+#include <util/atomic.h> // ATOMIC_BLOCK()
+#endif
 
 /****************************************************************************/
 
@@ -24,20 +28,89 @@ RF24Logging::RF24Logging()
 
 void RF24Logging::setHandler(RF24LogBaseHandler *handler)
 {
+#if defined (RF24LOG_HOSTED)
+    this->handler.store(handler, std::memory_order_release);
+    // retire the previous handler only after in-flight log calls have finished with it
+    RF24LogEpoch::synchronize();
+#elif defined (ARDUINO_ARCH_AVR)
+    // a pointer is 2 bytes on AVR; don't let an ISR read half of it
+    ATOMIC_BLOCK(ATOMIC_RESTORESTATE) { this->handler = handler; }
+#else
     this->handler = handler;
+#endif
 }
 
 /****************************************************************************/
 
 void RF24Logging::log(uint8_t logLevel, const char *vendorId, const char *message, ...)
 {
+    va_list args;
+    va_start(args, message);
+    write(logLevel, vendorId, message, &args);
+    va_end(args);
+}
+
+/****************************************************************************/
+
+#if defined (RF24LOG_HOSTED)
+void RF24Logging::logAt(const RF24LogSite *site, ...)
+{
+    va_list args;
+    va_start(args, site);
+    writeSite(site->logLevel, site, site->vendorId, &args);
+    va_end(args);
+}
+
+/****************************************************************************/
+
+void RF24Logging::logSite(uint8_t logLevel, const RF24LogSite *site, const char *vendorId, ...)
+{
+    va_list args;
+    va_start(args, vendorId);
+    writeSite(logLevel, site, vendorId, &args);
+    va_end(args);
+}
+
+/****************************************************************************/
+
+void RF24Logging::writeSite(uint8_t logLevel, const RF24LogSite *site, const char *vendorId, va_list *args)
+{
+    uint8_t mode = site->mode.load(std::memory_order_relaxed);
+    if (mode == RF24LOG_SITE_DISABLED)
+    {
+        return;
+    }
+    bool outer = RF24LogSites::isForced();
+    RF24LogSites::setForced(mode == RF24LOG_SITE_ENABLED);
+    rf24Logging.write(logLevel, vendorId, site->message, args);
+    RF24LogSites::setForced(outer);
+}
+#endif
+
+/****************************************************************************/
+
+void RF24Logging::write(uint8_t logLevel, const char *vendorId, const char *message, va_list *args)
+{
+#if defined (RF24LOG_HOSTED)
+    #if defined (RF24LOG_PROFILE)
+    bool profile = RF24LogProfiler::beginCall(logLevel, vendorId, message);
+    #endif
+    uint64_t token = RF24LogEpoch::readLock();
+    RF24LogBaseHandler *current = handler.load(std::memory_order_acquire);
+    if (current != nullptr)
+    {
+        current->log(logLevel, vendorId, message, args);
+    }
+    RF24LogEpoch::readUnlock(token);
+    #if defined (RF24LOG_PROFILE)
+    RF24LogProfiler::endCall(message, profile);
+    #endif
+#else
     if (handler != nullptr)
     {
-        va_list args;
-        va_start(args, message);
-        handler->log(logLevel, vendorId, message, &args);
-        va_end(args);
+        handler->log(logLevel, vendorId, message, args);
     }
+#endif
 }
 
 /****************************************************************************/
@@ -53,6 +126,22 @@ void RF24Logging::log(uint8_t logLevel, const __FlashStringHelper *vendorId, con
         va_end(args);
     }
 }
+
+/****************************************************************************/
+
+void RF24Logging::logAt(const RF24LogFlashSite *site, const __FlashStringHelper *vendorId, ...)
+{
+    RF24LogBaseHandler *current = rf24Logging.handler;
+    if (current != nullptr)
+    {
+        uint8_t logLevel = pgm_read_byte(&site->logLevel);
+        const char *message = (const char *)pgm_read_word(&site->message);
+        va_list args;
+        va_start(args, vendorId);
+        current->log(logLevel, vendorId, (const __FlashStringHelper *)message, &args);
+        va_end(args);
+    }
+}
 #endif
 
 /****************************************************************************/
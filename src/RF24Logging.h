@@ -30,14 +30,36 @@
 
 #include "RF24LogLevel.h"
 #include "RF24LogBaseHandler.h"
+#include "RF24LogParts/Epoch.h"
+#include "RF24LogParts/CallSite.h"
 
 #if defined (ARDUINO_ARCH_AVR)
     #define RF24LOG_FLASHIFY(A) F(A)
-    #define RF24Log_error(vendorId, message, ...) (rf24Logging.log(RF24LogLevel::ERROR, (const __FlashStringHelper*)(vendorId), RF24LOG_FLASHIFY(message), ##__VA_ARGS__))
-    #define RF24Log_warn(vendorId, message, ...) (rf24Logging.log(RF24LogLevel::WARN, (const __FlashStringHelper*)(vendorId), RF24LOG_FLASHIFY(message), ##__VA_ARGS__))
-    #define RF24Log_info(vendorId, message, ...) (rf24Logging.log(RF24LogLevel::INFO, (const __FlashStringHelper*)(vendorId), RF24LOG_FLASHIFY(message), ##__VA_ARGS__))
-    #define RF24Log_debug(vendorId, message, ...) (rf24Logging.log(RF24LogLevel::DEBUG, (const __FlashStringHelper*)(vendorId), RF24LOG_FLASHIFY(message), ##__VA_ARGS__))
+    #define RF24Log_error(vendorId, message, ...) RF24LOG_FLASH_CALL(RF24LogLevel::ERROR, vendorId, message, ##__VA_ARGS__)
+    #define RF24Log_warn(vendorId, message, ...) RF24LOG_FLASH_CALL(RF24LogLevel::WARN, vendorId, message, ##__VA_ARGS__)
+    #define RF24Log_info(vendorId, message, ...) RF24LOG_FLASH_CALL(RF24LogLevel::INFO, vendorId, message, ##__VA_ARGS__)
+    #define RF24Log_debug(vendorId, message, ...) RF24LOG_FLASH_CALL(RF24LogLevel::DEBUG, vendorId, message, ##__VA_ARGS__)
     #define RF24Log_log(logLevel, vendorId, message, ...) (rf24Logging.log(logLevel, (const __FlashStringHelper*)(vendorId), RF24LOG_FLASHIFY(message), ##__VA_ARGS__))
+
+    /** @brief The constant arguments of a call site, stored in flash (see RF24Logging::logAt()) */
+    struct RF24LogFlashSite
+    {
+        uint8_t logLevel;
+        const char *message;
+    };
+
+    /**
+     * @brief the expansion of the logging macros of a fixed level
+     *
+     * The level and the message are stored in a RF24LogFlashSite, so the call pushes 2 pointers
+     * (instead of 4 words) before the message's arguments. The @p vendorId (like a `PROGMEM`
+     * array) is passed by each call, so it can change between calls.
+     */
+    #define RF24LOG_FLASH_CALL(logLevel, vendorId, message, ...) __extension__({                                  \
+        static const char rf24LogMessage[] PROGMEM = message;                                                  \
+        static const RF24LogFlashSite rf24LogSite PROGMEM = {(uint8_t)(logLevel), rf24LogMessage};             \
+        RF24Logging::logAt(&rf24LogSite, (const __FlashStringHelper *)(vendorId), ##__VA_ARGS__);              \
+    })
 #else
 
     /**
@@ -47,7 +69,7 @@
      * @param ... the sequence of variables used to replace the format specifiers in the
      * same order for which they appear in the @p message
      */
-    #define RF24Log_error(vendorId, message, ...) (rf24Logging.log(RF24LogLevel::ERROR, vendorId, message, ##__VA_ARGS__))
+    #define RF24Log_error(vendorId, message, ...) RF24LOG_CALL(RF24LogLevel::ERROR, vendorId, message, ##__VA_ARGS__)
 
     /**
      * @brief output a message to WARN the reader
@@ -56,7 +78,7 @@
      * @param ... the sequence of variables used to replace the format specifiers in the
      * same order for which they appear in the @p message
      */
-    #define RF24Log_warn(vendorId, message, ...) (rf24Logging.log(RF24LogLevel::WARN, vendorId, message, ##__VA_ARGS__))
+    #define RF24Log_warn(vendorId, message, ...) RF24LOG_CALL(RF24LogLevel::WARN, vendorId, message, ##__VA_ARGS__)
 
     /**
      * @brief output an @ref INFO message
@@ -65,7 +87,7 @@
      * @param ... the sequence of variables used to replace the format specifiers in the
      * same order for which they appear in the @p message
      */
-    #define RF24Log_info(vendorId, message, ...) (rf24Logging.log(RF24LogLevel::INFO, vendorId, message, ##__VA_ARGS__))
+    #define RF24Log_info(vendorId, message, ...) RF24LOG_CALL(RF24LogLevel::INFO, vendorId, message, ##__VA_ARGS__)
 
     /**
      * @brief output a message to help developers @ref DEBUG their source code
@@ -74,7 +96,7 @@
      * @param ... the sequence of variables used to replace the format specifiers in the
      * same order for which they appear in the @p message
      */
-    #define RF24Log_debug(vendorId, message, ...) (rf24Logging.log(RF24LogLevel::DEBUG, vendorId, message, ##__VA_ARGS__))
+    #define RF24Log_debug(vendorId, message, ...) RF24LOG_CALL(RF24LogLevel::DEBUG, vendorId, message, ##__VA_ARGS__)
 
     /**
      * @brief output a log message of any level
@@ -85,15 +107,99 @@
      * @param ... the sequence of variables used to replace the format specifiers in the
      * same order for which they appear in the @p message
      */
-    #define RF24Log_log(logLevel, vendorId, message, ...) (rf24Logging.log(logLevel, vendorId, message, ##__VA_ARGS__))
+    #define RF24Log_log(logLevel, vendorId, message, ...) RF24LOG_CALL_LEVEL(logLevel, vendorId, message, ##__VA_ARGS__)
+
+    #if defined (RF24LOG_SITES)
+    /**
+     * @brief the value of @p value if it is a compile-time constant, or @p otherwise
+     *
+     * This keeps the RF24LogSite of a call site constant-initialized (no guard variable is
+     * needed to initialize it at runtime, which wouldn't be safe in a signal handler).
+     */
+    #define RF24LOG_IF_CONSTANT(value, otherwise) (__builtin_constant_p(value) ? (value) : (otherwise))
+
+    /**
+     * @brief the expansion of the logging macros of a fixed level
+     *
+     * When the @p message is a string literal, the call site owns a static RF24LogSite
+     * (registered in the `rf24log_sites` section, which costs no code). If the @p vendorId is
+     * also a compile-time constant, the call only passes the RF24LogSite to
+     * RF24Logging::logAt() before the message's arguments; otherwise, the @p vendorId is
+     * passed by each call to RF24Logging::logSite(). The site's switch is checked by the
+     * callee, so a call site's code is smaller than a call to RF24Logging::log() (see the
+     * SiteFootprint example). A @p message that isn't a string literal has no call site; it
+     * is passed to RF24Logging::log().
+     */
+    #define RF24LOG_CALL(logLevel, vendorId, message, ...) __extension__({                                       \
+        if (__builtin_constant_p(message))                                                                     \
+        {                                                                                                      \
+            static RF24LogSite rf24LogSite = {(uint8_t)(logLevel), {RF24LOG_SITE_DEFAULT}, (uint16_t)__LINE__, \
+                                              RF24LOG_IF_CONSTANT(vendorId, nullptr),                          \
+                                              RF24LOG_IF_CONSTANT(message, nullptr), __FILE__};                \
+            RF24LOG_SITE_REGISTER(rf24LogSite);                                                                \
+            if (__builtin_constant_p(vendorId))                                                                \
+            {                                                                                                  \
+                RF24Logging::logAt(&rf24LogSite, ##__VA_ARGS__);                                               \
+            }                                                                                                  \
+            else                                                                                               \
+            {                                                                                                  \
+                RF24Logging::logSite(logLevel, &rf24LogSite, vendorId, ##__VA_ARGS__);                         \
+            }                                                                                                  \
+        }                                                                                                      \
+        else                                                                                                   \
+        {                                                                                                      \
+            rf24Logging.log(logLevel, vendorId, message, ##__VA_ARGS__);                                       \
+        }                                                                                                      \
+    })
+
+    /**
+     * @brief the expansion of RF24Log_log(), whose level can change between calls
+     *
+     * Like @ref RF24LOG_CALL, but the @p logLevel and the @p vendorId are always passed by
+     * each call to RF24Logging::logSite(). (The RF24LogSite holds the @p logLevel only if it
+     * is a compile-time constant.)
+     */
+    #define RF24LOG_CALL_LEVEL(logLevel, vendorId, message, ...) __extension__({                                 \
+        if (__builtin_constant_p(message))                                                                     \
+        {                                                                                                      \
+            static RF24LogSite rf24LogSite = {(uint8_t)RF24LOG_IF_CONSTANT(logLevel, 0),                       \
+                                              {RF24LOG_SITE_DEFAULT}, (uint16_t)__LINE__,                      \
+                                              RF24LOG_IF_CONSTANT(vendorId, nullptr),                          \
+                                              RF24LOG_IF_CONSTANT(message, nullptr), __FILE__};                \
+            RF24LOG_SITE_REGISTER(rf24LogSite);                                                                \
+            RF24Logging::logSite(logLevel, &rf24LogSite, vendorId, ##__VA_ARGS__);                             \
+        }                                                                                                      \
+        else                                                                                                   \
+        {                                                                                                      \
+            rf24Logging.log(logLevel, vendorId, message, ##__VA_ARGS__);                                       \
+        }                                                                                                      \
+    })
+    #else
+    #define RF24LOG_CALL(logLevel, vendorId, message, ...) (rf24Logging.log(logLevel, vendorId, message, ##__VA_ARGS__))
+    #define RF24LOG_CALL_LEVEL(logLevel, vendorId, message, ...) RF24LOG_CALL(logLevel, vendorId, message, ##__VA_ARGS__)
+    #endif
 #endif
 
+/**
+ * @brief output a buffer of bytes (like a radio payload) as hexadecimal digits in groups of 4
+ * bytes, followed by an ASCII column (see the `H` specifier)
+ * @param logLevel the level of the logging message
+ * @param vendorId A scoping identity of the message's origin
+ * @param buffer The bytes to output
+ * @param length The number of bytes in the @p buffer
+ */
+#define RF24Log_hexdump(logLevel, vendorId, buffer, length) RF24Log_log(logLevel, vendorId, "%#4H", (const void *)(buffer), (int)(length))
+
 /** @brief This is the end-user's access point into the world of logging messages. */
 class RF24Logging
 {
 private:
     /** @brief The output stream handler configured by sethandler() */
+#if defined (RF24LOG_HOSTED)
+    std::atomic<RF24LogBaseHandler *> handler;
+#else
     RF24LogBaseHandler *handler;
+#endif
 
 public:
     /** @brief Initializes the handler to nullptr */
@@ -101,7 +207,13 @@ public:
 
     /**
      * @brief set the instance's handler
+     *
+     * On hosted platforms, this is safe to call while other threads are logging. The log
+     * calls take no locks; instead, this function waits until every log call that could
+     * still be using the previous handler (or handler chain) has finished. So, when this
+     * function returns, the previous handler can be reconfigured or destroyed.
      * @param handler The log handler where the messages will be redirected.
+     * @warning Do not call this from within a handler's log() method (or from a signal handler).
      */
     void setHandler(RF24LogBaseHandler *handler);
 
@@ -115,9 +227,54 @@ public:
      */
     void log(uint8_t logLevel, const char *vendorId, const char *message, ...);
 
+#if defined (RF24LOG_HOSTED)
+    /**
+     * @brief output a log message of @ref rf24Logging from a registered call site (used by the
+     * @ref LoggingAPI macros of a fixed level)
+     *
+     * This is the entry point of the call sites whose arguments are all constants: they only
+     * pass their RF24LogSite, so each call site's code is as small as it can be. A call site
+     * switched to @ref RF24LOG_SITE_DISABLED returns at once, and one switched to
+     * @ref RF24LOG_SITE_ENABLED bypasses the handlers' log level.
+     * @param site The call site (with the level, the vendorId and the message format string)
+     * @param ... the sequence of variables used to replace the format specifiers
+     */
+    static void logAt(const RF24LogSite *site, ...);
+
+    /**
+     * @brief like logAt(), for the call sites whose level or vendorId aren't constants (like
+     * the call sites of RF24Log_log())
+     * @param logLevel the level of the logging message
+     * @param site The call site (with the message format string)
+     * @param vendorId A scoping identity of the message's origin
+     * @param ... the sequence of variables used to replace the format specifiers
+     */
+    static void logSite(uint8_t logLevel, const RF24LogSite *site, const char *vendorId, ...);
+#endif
+
 #if defined (ARDUINO_ARCH_AVR)
     void log(uint8_t logLevel, const __FlashStringHelper *vendorId, const __FlashStringHelper *message, ...);
+
+    /**
+     * @brief output a log message of @ref rf24Logging from a call site of the @ref LoggingAPI
+     * macros of a fixed level (see @ref RF24LOG_FLASH_CALL)
+     * @param site The call site's constant arguments (in flash)
+     * @param vendorId A scoping identity of the message's origin
+     * @param ... the sequence of variables used to replace the format specifiers
+     */
+    static void logAt(const RF24LogFlashSite *site, const __FlashStringHelper *vendorId, ...);
 #endif
+
+private:
+
+    /** @brief forward a log message to the handler */
+    void write(uint8_t logLevel, const char *vendorId, const char *message, va_list *args);
+
+#if defined (RF24LOG_HOSTED)
+    /** @brief forward a log message from a call site to the handler of @ref rf24Logging */
+    static void writeSite(uint8_t logLevel, const RF24LogSite *site, const char *vendorId, va_list *args);
+#endif
+
 };
 
 /** @brief the singleton used for all your program's logging purposes. */
@@ -148,3 +305,190 @@ extern RF24Logging rf24Logging;
  * This example just prints a messaged for each supported log level.
  * This example accepts user input to change the log level used as a filter.
  */
+
+/**
+ * @example{lineno} IsrCapture.cpp
+ *
+ * This example (for POSIX platforms) logs from a signal handler, which stands in for
+ * a radio's IRQ handler. The messages are captured by a RF24LogIsrHandler and
+ * output later from the main program.
+ */
+
+/**
+ * @example{lineno} CallSites.cpp
+ *
+ * This example (for POSIX platforms) lists the registered call sites of the logging
+ * macros, then switches one call site on (regardless of the log level) and another off.
+ */
+
+/**
+ * @example{lineno} ProfileSites.cpp
+ *
+ * This example (for POSIX platforms) logs from 2 threads and then reports the most
+ * expensive log messages. It needs the RF24Log lib built with the `RF24LOG_PROFILE` option.
+ */
+
+/**
+ * @example{lineno} ShmBenchmark.cpp
+ *
+ * This example (for POSIX platforms) compares the cost of logging to stdout with the
+ * cost of logging to shared memory through a RF24LogShmHandler (in binary and in text form).
+ * The `rf24log-shmd` tool (in the repo's tools folder) is the process that normally
+ * formats and outputs the records from the shared memory.
+ */
+
+/**
+ * @example{lineno} WritevBatching.cpp
+ *
+ * This example (for POSIX platforms) writes a burst of log messages to stdout through
+ * a SinkLogger and a RF24LogWritevSink, and reports how few `writev()` calls were needed.
+ */
+
+/**
+ * @example{lineno} UringFileSink.cpp
+ *
+ * This example (for POSIX platforms) logs to a file through a RF24LogUringSink, first with
+ * io_uring (when the kernel allows it) and then with `pwrite()`, and reports the queue depth
+ * and completion latency of the writes.
+ */
+
+/**
+ * @example{lineno} SocketForwarding.cpp
+ *
+ * This example (for POSIX platforms) sends log messages to a local collector (like the
+ * `rf24log-recv` tool in the repo's tools folder) through a RF24LogSocketSink. The
+ * collector can be started, stopped and restarted while the example runs.
+ */
+
+/**
+ * @example{lineno} CompressedFile.cpp
+ *
+ * This example (for POSIX platforms) compresses the log messages with a RF24LogCompressSink
+ * before they are written to a file. The `rf24log-unlz` tool (in the repo's tools folder)
+ * turns the file back into text.
+ */
+
+/**
+ * @example{lineno} IndexedLog.cpp
+ *
+ * This example (for POSIX platforms) logs to an indexed binary log file with a
+ * RF24LogIndexedHandler, then uses a RF24LogIndexedReader to find the warnings and errors
+ * of 1 vendorId around an incident without reading most of the file. The `rf24log-query`
+ * tool (in the repo's tools folder) runs the same kind of query on the command line, on any
+ * of the lib's log formats.
+ */
+
+/**
+ * @example{lineno} ParallelFormatting.cpp
+ *
+ * This example (for POSIX platforms) logs from several threads through a
+ * RF24LogParallelHandler, which formats the messages on a pool of worker threads, and
+ * compares the throughput of different numbers of workers. Its sink checks that every
+ * thread's messages are written in the order they were logged.
+ */
+
+/**
+ * @example{lineno} HeaderPattern.cpp
+ *
+ * This example (for POSIX platforms) replaces the default header of a logger's lines with
+ * a RF24LogHeaderPattern, which shows the microseconds, the thread's name and ID and a
+ * sequence number of each log message.
+ */
+
+/**
+ * @example{lineno} LevelRouting.cpp
+ *
+ * This example (for POSIX platforms) routes the log messages by their level with a
+ * RF24LogRouterHandler: errors and warnings go to stderr, info messages are batched to
+ * stdout and the debug sublevels are kept in memory until an error occurs. The route table
+ * is then swapped while the program runs.
+ */
+
+/**
+ * @example{lineno} PriorityLanes.cpp
+ *
+ * This example (for POSIX platforms) floods a slow RF24LogSink with debug traces through a
+ * RF24LogLaneHandler, and measures how long the errors logged during the flood take to reach
+ * the sink. It then shows how the numbers in the header keep the order of the messages.
+ */
+
+/**
+ * @example{lineno} WaitStrategies.cpp
+ *
+ * This example (for POSIX platforms) outputs the messages captured by a RF24LogIsrHandler
+ * from a background thread, and reports the p50/p99/p99.9 latency of the messages and the
+ * CPU used for each RF24LogWaiter strategy. An optional argument pins the thread to a CPU core.
+ */
+
+/**
+ * @example{lineno} AdaptiveVerbosity.cpp
+ *
+ * This example (for POSIX platforms) logs through a RF24LogGovernorHandler to a slow console.
+ * During a log storm the governor sheds the debug and info messages, and it restores them 1
+ * step at a time once the storm is over. Each change of the threshold is reported as a warning.
+ */
+
+/**
+ * @example{lineno} EventLoop.cpp
+ *
+ * This example (for Linux) logs from a single-threaded `epoll` loop through a
+ * RF24LogEventHandler. The loop drains the buffered messages to a pipe with a budget per turn,
+ * and waits for the pipe to be writable when its slow reader lets it fill up.
+ */
+
+/**
+ * @example{lineno} StackTraces.cpp
+ *
+ * This example (for POSIX platforms) captures the errors with their stack traces through a
+ * RF24LogIsrHandler; the traces are only symbolized when the messages are output. Then, it
+ * logs an error straight to a logger (which symbolizes the trace at once), and measures the
+ * cost of capturing an error with and without a stack trace. It needs the RF24Log lib built
+ * with the `RF24LOG_STACK_TRACES` option.
+ */
+
+/**
+ * @example{lineno} FixedPointFormatting.cpp
+ *
+ * This example (for Linux) logs scaled integers with the `%k` specifier, then compares the
+ * integer-only rendering of RF24LogFixed with `printf("%.*f")` for millions of numbers and
+ * measures the speed of both. Define RF24LOG_FIXED_POINT to render `%f` the same way.
+ */
+
+/**
+ * @example{lineno} HexDump.cpp
+ *
+ * This example (for Linux) logs a radio payload with the `H` specifier and the
+ * RF24Log_hexdump() macro, captures one through a RF24LogIsrHandler, then compares the time to
+ * format a 32-byte payload with 1 `%02X` specifier per byte and with 1 `%H` specifier.
+ */
+
+/**
+ * @example{lineno} SinkFailover.cpp
+ *
+ * This example (for POSIX platforms) stalls the sink behind a RF24LogWatchdogSink, which
+ * fails over to a fallback sink (or keeps the records in its buffer) so that the log calls
+ * don't block, then re-attaches the sink once it responds again.
+ */
+
+/**
+ * @example{lineno} MemoryBudget.cpp
+ *
+ * This example (for POSIX platforms) sets a RF24LogMemory budget, then shows the memory used
+ * by a sink and by handlers that fit in it, are made smaller, are refused (and still log), or
+ * overdraw it, and how a re-created handler reuses the blocks of the previous one.
+ */
+
+/**
+ * @example{lineno} SiteFootprint.cpp
+ *
+ * This example (for Linux) measures the code of a call site of the @ref LoggingAPI macros
+ * (and of a direct call to RF24Logging::log()) in bytes, as compiled for the host.
+ */
+
+/**
+ * @example{lineno} SiteFootprint.ino
+ *
+ * This example measures the code of a call site of the @ref LoggingAPI macros (and of a
+ * direct call to RF24Logging::log()) in bytes, as compiled for the board, and prints it on
+ * the Arduino IDE's Serial Monitor.
+ */
@@ -39,6 +39,13 @@ void RF24LogDualHandler::log(uint8_t logLevel,
     va_end(args2);
 }
 
+void RF24LogDualHandler::logRecord(const RF24LogRecord *record)
+{
+    // a captured record can be output any number of times
+    handler1->logRecord(record);
+    handler2->logRecord(record);
+}
+
 void RF24LogDualHandler::setLogLevel(uint8_t logLevel)
 {
     handler1->setLogLevel(logLevel);
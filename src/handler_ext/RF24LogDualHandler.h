@@ -38,6 +38,8 @@ public:
              const char *message,
              va_list *args);
 
+    void logRecord(const RF24LogRecord *record);
+
     void setLogLevel(uint8_t logLevel);
 
 #if defined (ARDUINO_ARCH_AVR)
@@ -0,0 +1,209 @@
+/**
+ * @file RF24LogEventHandler.cpp
+ * @date Created 19 Oct 2026
+ * @author Brendan Doherty (2bndy5)
+ * @copyright Copyright (C) <br>
+ *     2026    Brendan Doherty (2bndy5) <br>
+ * This General Public License does not permit incorporating your program into
+ * proprietary programs.  If your program is a subroutine library, you may
+ * consider it more useful to permit linking proprietary applications with the
+ * library.  If this is what you want to do, use the GNU Lesser General
+ * Public License instead of this License.
+ */
+
+#include "RF24LogEventHandler.h"
+
+#if defined (RF24LOG_POSIX)
+#include <errno.h>    // errno, EAGAIN, EINTR
+#include <fcntl.h>    // fcntl(), O_NONBLOCK
+#include <string.h>   // memcpy()
+#include <sys/uio.h>  // writev()
+#include <unistd.h>   // read(), write(), close(), pipe()
+#include <chrono>
+#if defined (__linux__)
+#include <sys/eventfd.h> // eventfd()
+#endif
+#include "../RF24LogParts/ArgList.h"
+#include "../RF24LogParts/Memory.h"
+
+RF24LogEventHandler::RF24LogEventHandler(int fd, size_t bufferSize)
+    : _fd(fd), _eventFd(-1), _signalFd(-1), _size(bufferSize ? bufferSize : RF24LOG_LINE_SIZE), _head(0),
+      _length(0), _signaled(false), _blocked(false), _records(0), _dropped(0), _written(0)
+{
+    // from the memory budget (maybe smaller); without it, the messages are dropped (and counted)
+    _buffer = static_cast<char *>(RF24LogMemory::allocate(&_size, RF24LOG_LINE_SIZE));
+    fcntl(_fd, F_SETFL, fcntl(_fd, F_GETFL) | O_NONBLOCK);
+#if defined (__linux__)
+    _eventFd = eventfd(0, EFD_NONBLOCK | EFD_CLOEXEC);
+#else
+    int ends[2];
+    if (pipe(ends) == 0)
+    {
+        for (int end : ends)
+        {
+            fcntl(end, F_SETFL, fcntl(end, F_GETFL) | O_NONBLOCK);
+            fcntl(end, F_SETFD, FD_CLOEXEC);
+        }
+        _eventFd = ends[0];
+        _signalFd = ends[1];
+    }
+#endif
+}
+
+RF24LogEventHandler::~RF24LogEventHandler()
+{
+    if (_eventFd >= 0)
+    {
+        close(_eventFd);
+    }
+    if (_signalFd >= 0)
+    {
+        close(_signalFd);
+    }
+    RF24LogMemory::release(_buffer);
+}
+
+void RF24LogEventHandler::signalLocked()
+{
+    _signaled = true;
+#if defined (__linux__)
+    uint64_t one = 1;
+    ssize_t result = ::write(_eventFd, &one, sizeof(one));
+#else
+    char one = 1;
+    ssize_t result = ::write(_signalFd, &one, 1);
+#endif
+    (void)result; // a full counter (or pipe) is already readable
+}
+
+void RF24LogEventHandler::clearLocked()
+{
+    _signaled = false;
+#if defined (__linux__)
+    uint64_t count;
+    ssize_t result = read(_eventFd, &count, sizeof(count));
+#else
+    char bytes[64];
+    ssize_t result;
+    do
+    {
+        result = read(_eventFd, bytes, sizeof(bytes));
+    } while (result == (ssize_t)sizeof(bytes));
+#endif
+    (void)result;
+}
+
+void RF24LogEventHandler::append(const char *data, size_t length)
+{
+    std::lock_guard<std::mutex> lock(_mutex);
+    if (length > _size - _length || _size == 0)
+    {
+        _dropped.fetch_add(1, std::memory_order_relaxed);
+        return;
+    }
+    size_t tail = (_head + _length) % _size;
+    size_t first = length < _size - tail ? length : _size - tail;
+    memcpy(_buffer + tail, data, first);
+    memcpy(_buffer, data + first, length - first);
+    _length += length;
+    _records.fetch_add(1, std::memory_order_relaxed);
+    if (!_signaled)
+    {
+        signalLocked();
+    }
+}
+
+void RF24LogEventHandler::write(uint8_t logLevel,
+                                const char *vendorId,
+                                const char *message,
+                                va_list *args)
+{
+    char buffer[RF24LOG_LINE_SIZE];
+    RF24LogArgList argList(args);
+    size_t length = _formatter.format(buffer, sizeof(buffer), logLevel, vendorId, message, &argList, rf24LogNow());
+    append(buffer, length);
+}
+
+void RF24LogEventHandler::logRecord(const RF24LogRecord *record)
+{
+    if (!isLevelEnabled(record->logLevel) && !(record->flags & RF24LOG_RECORD_FORCED))
+    {
+        return;
+    }
+    char buffer[RF24LOG_LINE_SIZE];
+    RF24LogArgList argList(record->args, record->argsSize);
+    size_t length = _formatter.format(buffer, sizeof(buffer), record->logLevel, record->vendorId,
+                                      record->message, &argList, record->timestamp, &record->thread);
+    append(buffer, length);
+}
+
+size_t RF24LogEventHandler::drain(size_t maxBytes, uint32_t maxMicros)
+{
+    auto deadline = std::chrono::steady_clock::now() + std::chrono::microseconds(maxMicros);
+    size_t total = 0;
+    bool blocked = false;
+
+    std::lock_guard<std::mutex> lock(_mutex);
+    clearLocked();
+    while (_length && (!maxBytes || total < maxBytes))
+    {
+        size_t budget = maxBytes ? maxBytes - total : _length;
+        size_t length = _length < budget ? _length : budget;
+        size_t first = length < _size - _head ? length : _size - _head;
+        struct iovec chunks[2] = {{_buffer + _head, first}, {_buffer, length - first}};
+        ssize_t result = writev(_fd, chunks, length > first ? 2 : 1);
+        if (result < 0)
+        {
+            if (errno == EINTR)
+            {
+                continue;
+            }
+            if (errno == EAGAIN || errno == EWOULDBLOCK)
+            {
+                blocked = true;
+            }
+            else
+            {
+                // the output is broken: the buffered bytes can't be written
+                _head = 0;
+                _length = 0;
+            }
+            break;
+        }
+        if (result == 0)
+        {
+            blocked = true;
+            break;
+        }
+        _head = (_head + (size_t)result) % _size;
+        _length -= (size_t)result;
+        total += (size_t)result;
+        if (maxMicros && std::chrono::steady_clock::now() >= deadline)
+        {
+            break;
+        }
+    }
+    _blocked.store(blocked, std::memory_order_relaxed);
+    if (!_length)
+    {
+        _head = 0; // the next messages are contiguous
+    }
+    else if (blocked)
+    {
+        _signaled = true; // quiet until the event loop sees the output is writable
+    }
+    else
+    {
+        signalLocked(); // a budget was spent
+    }
+    _written.fetch_add(total, std::memory_order_relaxed);
+    return total;
+}
+
+size_t RF24LogEventHandler::pending()
+{
+    std::lock_guard<std::mutex> lock(_mutex);
+    return _length;
+}
+
+#endif // defined (RF24LOG_POSIX)
@@ -0,0 +1,148 @@
+/**
+ * @file RF24LogEventHandler.h
+ * @brief handler that buffers formatted log messages for an application's event loop
+ * @date Created 19 Oct 2026
+ * @author Brendan Doherty (2bndy5)
+ * @copyright Copyright (C) <br>
+ *     2026    Brendan Doherty (2bndy5) <br>
+ * This General Public License does not permit incorporating your program into
+ * proprietary programs.  If your program is a subroutine library, you may
+ * consider it more useful to permit linking proprietary applications with the
+ * library.  If this is what you want to do, use the GNU Lesser General
+ * Public License instead of this License.
+ */
+
+#ifndef SRC_HANDLER_EXT_RF24LOGEVENTHANDLER_H_
+#define SRC_HANDLER_EXT_RF24LOGEVENTHANDLER_H_
+
+#include "../RF24LogParts/Common.h" // RF24LOG_POSIX
+
+#if defined (RF24LOG_POSIX)
+#include <stddef.h>
+#include <stdint.h>
+#include <atomic>
+#include <mutex>
+#include "../RF24LogParts/AbstractHandler.h"
+#include "../RF24LogParts/LineFormatter.h"
+#include "../RF24LogParts/Record.h"
+
+/**
+ * @brief Module to extend the RF24LogBaseHandler mechanism for asynchronous output from a
+ * single-threaded event loop (like an `epoll` loop), without a logging thread.
+ *
+ * Logged messages are formatted (with the same formatting as the RF24LogLineFormatter
+ * loggers) into a ring buffer in memory. The handler's readiness file descriptor
+ * (eventFd(), an `eventfd` on Linux or the read end of a pipe elsewhere) becomes readable
+ * when there are bytes to write, and the event loop then calls drain(), which writes as much
+ * of the buffer as a byte or time budget allows to the output file descriptor, without ever
+ * blocking. The output file descriptor is made non-blocking by the constructor.
+ *
+ * When the output can't take more bytes, isBlocked() is true and the readiness file
+ * descriptor stays quiet: the event loop should then wait for the output file descriptor to
+ * be writable (like `EPOLLOUT`) before it calls drain() again. When the buffer is full, new
+ * messages are dropped (and counted).
+ */
+class RF24LogEventHandler : public RF24LogAbstractHandler
+{
+public:
+
+    /**
+     * @brief Instance constructor
+     * @param fd The output file descriptor (like a pipe, a socket or a file); it is not closed
+     * @param bufferSize The number of bytes buffered. The buffer is allocated from the
+     * RF24LogMemory budget, so it can be smaller; if it is refused, the messages are dropped.
+     */
+    RF24LogEventHandler(int fd, size_t bufferSize = 65536);
+
+    /** @brief closes the readiness file descriptor (the pending messages are not written) */
+    ~RF24LogEventHandler();
+
+    /** @brief the readiness file descriptor to register with the event loop (readable while there are bytes to drain) */
+    int eventFd() const { return _eventFd; }
+
+    /** @brief the output file descriptor */
+    int fd() const { return _fd; }
+
+    /**
+     * @brief write buffered bytes to the output file descriptor, without blocking.
+     *
+     * This clears the readiness file descriptor. It is signaled again if bytes remain once
+     * a budget is spent (but not when the output would block, see isBlocked()). If the output
+     * fails for another reason (like a closed pipe), the buffered bytes are discarded.
+     * @param maxBytes The most bytes to write (`0` for no limit)
+     * @param maxMicros The most microseconds to spend writing (`0` for no limit). It is
+     * checked after each system call, so it can be exceeded by 1 call.
+     * @return The number of bytes written
+     */
+    size_t drain(size_t maxBytes = 0, uint32_t maxMicros = 0);
+
+    /** @brief the number of bytes waiting to be drained */
+    size_t pending();
+
+    /** @brief did the last drain() stop because the output file descriptor would block? */
+    bool isBlocked() { return _blocked.load(std::memory_order_relaxed); }
+
+    /**
+     * @brief buffer a captured message (if its level is enabled), keeping its capture timestamp.
+     * @param record The captured message
+     */
+    void logRecord(const RF24LogRecord *record);
+
+    /** @brief the number of messages buffered */
+    uint64_t records() { return _records.load(std::memory_order_relaxed); }
+
+    /** @brief the number of messages dropped because the buffer was full */
+    uint64_t dropped() { return _dropped.load(std::memory_order_relaxed); }
+
+    /** @brief the number of bytes written to the output file descriptor */
+    uint64_t written() { return _written.load(std::memory_order_relaxed); }
+
+protected:
+
+    void write(uint8_t logLevel,
+               const char *vendorId,
+               const char *message,
+               va_list *args);
+
+private:
+
+    /** @brief formats the messages (the output is done by drain()) */
+    class Formatter : public RF24LogLineFormatter
+    {
+    protected:
+        void writeLine(const char *, size_t, uint8_t) {}
+    };
+
+    /** @brief copy a formatted message into the buffer (or drop it) and signal the event loop */
+    void append(const char *data, size_t length);
+
+    /** @brief make the readiness file descriptor readable; the caller holds _mutex */
+    void signalLocked();
+
+    /** @brief make the readiness file descriptor unreadable; the caller holds _mutex */
+    void clearLocked();
+
+    int _fd;
+    int _eventFd;
+    /** @brief The write end of the pipe that replaces the eventfd (or -1) */
+    int _signalFd;
+    Formatter _formatter;
+
+    std::mutex _mutex;
+    char *_buffer;
+    size_t _size;
+    /** @brief The offset of the oldest buffered byte */
+    size_t _head;
+    /** @brief The number of buffered bytes */
+    size_t _length;
+    /** @brief Is the readiness file descriptor readable (or held quiet while the output is blocked)? */
+    bool _signaled;
+    std::atomic<bool> _blocked;
+
+    std::atomic<uint64_t> _records;
+    std::atomic<uint64_t> _dropped;
+    std::atomic<uint64_t> _written;
+};
+
+#endif // defined (RF24LOG_POSIX)
+#endif /* SRC_HANDLER_EXT_RF24LOGEVENTHANDLER_H_ */
@@ -0,0 +1,237 @@
+/**
+ * @file RF24LogGovernorHandler.cpp
+ * @date Created 19 Oct 2026
+ * @author Brendan Doherty (2bndy5)
+ * @copyright Copyright (C) <br>
+ *     2026    Brendan Doherty (2bndy5) <br>
+ * This General Public License does not permit incorporating your program into
+ * proprietary programs.  If your program is a subroutine library, you may
+ * consider it more useful to permit linking proprietary applications with the
+ * library.  If this is what you want to do, use the GNU Lesser General
+ * Public License instead of this License.
+ */
+
+#include "RF24LogGovernorHandler.h"
+#include "../RF24LogParts/Record.h"
+
+/** @brief The threshold of each step (the configured log level applies at step 0) */
+static const uint8_t stepThresholds[RF24LOG_GOVERNOR_STEPS + 1] = {
+    RF24LogLevel::ALL,
+    RF24LogLevel::DEBUG,
+    RF24LogLevel::INFO + 7,
+    RF24LogLevel::INFO,
+    RF24LogLevel::WARN + 7
+};
+
+static const char governorVendorId[] = "RF24LogGovernor";
+
+/** @brief the number of steps that keep the messages of a level */
+static uint8_t stepsKeeping(uint8_t logLevel)
+{
+    uint8_t steps = 0;
+    while (steps <= RF24LOG_GOVERNOR_STEPS && logLevel <= stepThresholds[steps])
+    {
+        ++steps;
+    }
+    return steps - 1;
+}
+
+RF24LogGovernorHandler::RF24LogGovernorHandler(RF24LogBaseHandler *handler, uint32_t maxRate, uint16_t window)
+    : _handler(handler), _maxRate(maxRate), _gauge(nullptr), _gaugeContext(nullptr), _logLevel(RF24LogLevel::ALL),
+      _threshold(RF24LogLevel::ALL), _step(0), _windowStart(rf24LogNow())
+{
+#if defined (RF24LOG_HOSTED)
+    _window = (RF24LogTime)(window ? window : 1) * 1000;
+#else
+    _window = window ? window : 1;
+#endif
+    for (uint8_t i = 0; i <= RF24LOG_GOVERNOR_STEPS; ++i)
+    {
+        _counts[i] = 0;
+    }
+}
+
+void RF24LogGovernorHandler::setGauge(RF24LogGauge gauge, void *context)
+{
+    _gaugeContext = context;
+    _gauge = gauge;
+}
+
+uint8_t RF24LogGovernorHandler::step()
+{
+    return _step;
+}
+
+uint8_t RF24LogGovernorHandler::threshold()
+{
+    return _threshold;
+}
+
+bool RF24LogGovernorHandler::admit(uint8_t logLevel)
+{
+    if (logLevel > _logLevel)
+    {
+        return false; // not counted: it isn't output even without pressure
+    }
+    ++_counts[stepsKeeping(logLevel)];
+
+    RF24LogTime now = rf24LogNow();
+#if defined (RF24LOG_HOSTED)
+    RF24LogTime start = _windowStart.load(std::memory_order_relaxed);
+    // only 1 of the threads that see the end of the period picks the next step
+    if ((now - start >= _window || now < start) && _windowStart.compare_exchange_strong(start, now))
+    {
+        govern(now >= start ? now - start : _window); // the clock may be set back
+    }
+#else
+    RF24LogTime start = _windowStart;
+    if (now - start >= _window)
+    {
+        _windowStart = now;
+        govern(now - start);
+    }
+#endif
+    return logLevel <= _threshold;
+}
+
+void RF24LogGovernorHandler::govern(RF24LogTime elapsed)
+{
+    // the rate of the messages that would be output at each step
+    uint32_t rates[RF24LOG_GOVERNOR_STEPS + 1];
+    uint64_t kept = 0;
+    RF24LogTime period = elapsed > _window ? elapsed : _window;
+#if defined (RF24LOG_HOSTED)
+    const uint64_t perSecond = 1000000;
+#else
+    const uint64_t perSecond = 1000;
+#endif
+    for (uint8_t i = RF24LOG_GOVERNOR_STEPS + 1; i-- > 0;)
+    {
+#if defined (RF24LOG_HOSTED)
+        kept += _counts[i].exchange(0, std::memory_order_relaxed);
+#else
+        kept += _counts[i];
+        _counts[i] = 0;
+#endif
+        rates[i] = (uint32_t)(kept * perSecond / period);
+    }
+    uint8_t gauge = _gauge != nullptr ? _gauge(_gaugeContext) : 0;
+
+    uint8_t current = _step;
+    uint8_t next = current;
+    if (rates[current] > _maxRate)
+    {
+        while (next < RF24LOG_GOVERNOR_STEPS && rates[next] > _maxRate)
+        {
+            ++next;
+        }
+    }
+    else if (gauge >= 90)
+    {
+        next = current < RF24LOG_GOVERNOR_STEPS ? current + 1 : current;
+    }
+    else if (current > 0 && rates[current - 1] <= _maxRate / 2 && gauge <= 50)
+    {
+        next = current - 1;
+    }
+    if (next != current)
+    {
+        setStep(next, rates[0]);
+    }
+}
+
+void RF24LogGovernorHandler::setStep(uint8_t step, uint32_t rate)
+{
+#if defined (RF24LOG_HOSTED)
+    uint8_t previous = _step.exchange(step);
+#else
+    uint8_t previous = _step;
+    _step = step;
+#endif
+    uint8_t threshold = refreshThreshold();
+    if (step > previous)
+    {
+        report("shedding messages above level 0%o (%d messages/s)", threshold, (int)rate);
+    }
+    else
+    {
+        report("restored messages up to level 0%o (%d messages/s)", threshold, (int)rate);
+    }
+}
+
+uint8_t RF24LogGovernorHandler::refreshThreshold()
+{
+#if defined (RF24LOG_HOSTED)
+    uint8_t step = _step.load();
+    uint8_t logLevel = _logLevel.load();
+    while (true)
+    {
+        uint8_t threshold = stepThresholds[step] < logLevel ? stepThresholds[step] : logLevel;
+        _threshold.store(threshold);
+        // the last thread to store a threshold sees the last change of either
+        uint8_t currentStep = _step.load();
+        uint8_t currentLevel = _logLevel.load();
+        if (currentStep == step && currentLevel == logLevel)
+        {
+            return threshold;
+        }
+        step = currentStep;
+        logLevel = currentLevel;
+    }
+#else
+    uint8_t threshold = stepThresholds[_step] < _logLevel ? stepThresholds[_step] : _logLevel;
+    _threshold = threshold;
+    return threshold;
+#endif
+}
+
+void RF24LogGovernorHandler::report(const char *message, ...)
+{
+    va_list args;
+    va_start(args, message);
+    _handler->log(RF24LogLevel::WARN, governorVendorId, message, &args);
+    va_end(args);
+}
+
+void RF24LogGovernorHandler::log(uint8_t logLevel,
+                                 const char *vendorId,
+                                 const char *message,
+                                 va_list *args)
+{
+    if (admit(logLevel))
+    {
+        _handler->log(logLevel, vendorId, message, args);
+    }
+}
+
+void RF24LogGovernorHandler::logRecord(const RF24LogRecord *record)
+{
+    if (record->flags & RF24LOG_RECORD_FORCED)
+    {
+        _handler->logRecord(record); // forced past every threshold
+    }
+    else if (admit(record->logLevel))
+    {
+        _handler->logRecord(record);
+    }
+}
+
+void RF24LogGovernorHandler::setLogLevel(uint8_t logLevel)
+{
+    _logLevel = logLevel;
+    refreshThreshold();
+    _handler->setLogLevel(logLevel);
+}
+
+#if defined (ARDUINO_ARCH_AVR)
+void RF24LogGovernorHandler::log(uint8_t logLevel,
+                                 const __FlashStringHelper *vendorId,
+                                 const __FlashStringHelper *message,
+                                 va_list *args)
+{
+    if (admit(logLevel))
+    {
+        _handler->log(logLevel, vendorId, message, args);
+    }
+}
+#endif
@@ -0,0 +1,144 @@
+/**
+ * @file RF24LogGovernorHandler.h
+ * @brief handler that lowers the verbosity while logging is under pressure
+ * @date Created 19 Oct 2026
+ * @author Brendan Doherty (2bndy5)
+ * @copyright Copyright (C) <br>
+ *     2026    Brendan Doherty (2bndy5) <br>
+ * This General Public License does not permit incorporating your program into
+ * proprietary programs.  If your program is a subroutine library, you may
+ * consider it more useful to permit linking proprietary applications with the
+ * library.  If this is what you want to do, use the GNU Lesser General
+ * Public License instead of this License.
+ */
+
+#ifndef SRC_HANDLER_EXT_RF24LOGGOVERNORHANDLER_H_
+#define SRC_HANDLER_EXT_RF24LOGGOVERNORHANDLER_H_
+
+#include "../RF24LogBaseHandler.h"
+#include "../RF24LogLevel.h"
+#include "../RF24LogParts/Common.h" // RF24LOG_HOSTED, RF24LogTime
+#if defined (RF24LOG_HOSTED)
+#include <atomic>
+#endif
+
+/** @brief The number of shedding steps of a RF24LogGovernorHandler (after the unrestricted step 0) */
+#define RF24LOG_GOVERNOR_STEPS 4
+
+/**
+ * @brief A gauge of the pressure on the output, as a percentage (see RF24LogGovernorHandler::setGauge())
+ * @param context The pointer given to RF24LogGovernorHandler::setGauge()
+ * @return How full the output is: `0` when it is idle and `100` (or more) when it can't keep up
+ */
+typedef uint8_t (*RF24LogGauge)(void *context);
+
+/**
+ * @brief Module to extend the RF24LogBaseHandler mechanism for shedding the least severe log
+ * messages while the output can't keep up, so a log storm during an incident doesn't make the
+ * incident worse.
+ *
+ * The governor counts the messages it is given per period (of `window` milliseconds) and
+ * raises the effective log level threshold of the wrapped handler 1 step at a time:
+ * 1. the @ref DEBUG sublevels are dropped,
+ * 2. @ref DEBUG is dropped,
+ * 3. the @ref INFO sublevels are dropped,
+ * 4. @ref INFO is dropped (errors and warnings are never dropped by the governor).
+ *
+ * The pressure is measured by the rate of the messages that would be output (each period
+ * picks the least restrictive step whose rate fits `maxRate`), or by an optional gauge (like
+ * the fill level of a queue, or the latency of a sink), which raises the threshold 1 step per
+ * period while it reads 90 or more. The threshold is lowered 1 step per period once the
+ * messages of the previous step would fit in half of `maxRate` and the gauge reads 50 or less.
+ *
+ * Every change of the threshold is reported with 1 @ref WARN message (of the vendorId
+ * `"RF24LogGovernor"`) to the wrapped handler.
+ */
+class RF24LogGovernorHandler : public RF24LogBaseHandler
+{
+public:
+
+    /**
+     * @brief Instance constructor
+     * @param handler The handler that outputs the messages
+     * @param maxRate The number of messages per second that the output can take
+     * @param window The period (in milliseconds) over which the messages are counted
+     */
+    RF24LogGovernorHandler(RF24LogBaseHandler *handler, uint32_t maxRate, uint16_t window = 250);
+
+    /**
+     * @brief measure the pressure with a gauge (in addition to the rate of messages)
+     * @param gauge A function that returns the pressure on the output (or nullptr for none).
+     * It is called once per period, by a logging thread.
+     * @param context The pointer passed to the @p gauge
+     */
+    void setGauge(RF24LogGauge gauge, void *context);
+
+    /** @brief the current shedding step (`0` when no message is dropped by the governor) */
+    uint8_t step();
+
+    /** @brief the current effective log level threshold */
+    uint8_t threshold();
+
+    void log(uint8_t logLevel,
+             const char *vendorId,
+             const char *message,
+             va_list *args);
+
+    void logRecord(const RF24LogRecord *record);
+
+    /** @brief set the log level of the wrapped handler (the threshold when there is no pressure) */
+    void setLogLevel(uint8_t logLevel);
+
+#if defined (ARDUINO_ARCH_AVR)
+    void log(uint8_t logLevel,
+             const __FlashStringHelper *vendorId,
+             const __FlashStringHelper *message,
+             va_list *args);
+#endif
+
+private:
+
+    /** @brief count a message, and tell if it passes the current threshold */
+    bool admit(uint8_t logLevel);
+
+    /** @brief pick the step for the next period, from the messages counted in the @p elapsed time */
+    void govern(RF24LogTime elapsed);
+
+    /** @brief change the step (and report it) */
+    void setStep(uint8_t step, uint32_t rate);
+
+    /**
+     * @brief set the threshold of the current step and log level.
+     *
+     * The threshold is computed from 1 snapshot of both, and computed again if either changed
+     * meanwhile (by setLogLevel() and a period's end in other threads).
+     * @return The threshold that was set
+     */
+    uint8_t refreshThreshold();
+
+    /** @brief output a report of the governor */
+    void report(const char *message, ...);
+
+    RF24LogBaseHandler *_handler;
+    uint32_t _maxRate;
+    RF24LogTime _window;
+    RF24LogGauge _gauge;
+    void *_gaugeContext;
+
+#if defined (RF24LOG_HOSTED)
+    std::atomic<uint8_t> _logLevel;
+    std::atomic<uint8_t> _threshold;
+    std::atomic<uint8_t> _step;
+    std::atomic<RF24LogTime> _windowStart;
+    /** @brief The number of messages in this period, by the number of steps that keep them */
+    std::atomic<uint32_t> _counts[RF24LOG_GOVERNOR_STEPS + 1];
+#else
+    uint8_t _logLevel;
+    volatile uint8_t _threshold;
+    uint8_t _step;
+    RF24LogTime _windowStart;
+    uint32_t _counts[RF24LOG_GOVERNOR_STEPS + 1];
+#endif
+};
+
+#endif /* SRC_HANDLER_EXT_RF24LOGGOVERNORHANDLER_H_ */
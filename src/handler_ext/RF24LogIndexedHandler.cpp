@@ -0,0 +1,293 @@
+/**
+ * @file RF24LogIndexedHandler.cpp
+ * @date Created 19 Oct 2026
+ * @author Brendan Doherty (2bndy5)
+ * @copyright Copyright (C) <br>
+ *     2026    Brendan Doherty (2bndy5) <br>
+ * This General Public License does not permit incorporating your program into
+ * proprietary programs.  If your program is a subroutine library, you may
+ * consider it more useful to permit linking proprietary applications with the
+ * library.  If this is what you want to do, use the GNU Lesser General
+ * Public License instead of this License.
+ */
+
+#include "RF24LogIndexedHandler.h"
+
+#if defined (RF24LOG_POSIX)
+#include <errno.h>    // errno, EINTR
+#include <fcntl.h>    // open()
+#include <string.h>   // memcpy(), memset(), strlen()
+#include <sys/stat.h> // fstat()
+#include <unistd.h>   // pwrite(), pread(), ftruncate(), close()
+#include "../RF24LogLevel.h"
+#include "../RF24LogParts/ArgList.h"
+#include "../RF24LogParts/Memory.h"
+#include "../RF24LogParts/Record.h"
+
+/** @brief write all of @p length bytes at @p offset */
+static bool pwriteAll(int fd, const void *data, size_t length, uint64_t offset)
+{
+    const char *bytes = static_cast<const char *>(data);
+    while (length)
+    {
+        ssize_t written = pwrite(fd, bytes, length, (off_t)offset);
+        if (written <= 0)
+        {
+            if (written < 0 && errno == EINTR)
+            {
+                continue;
+            }
+            return false;
+        }
+        bytes += written;
+        length -= (size_t)written;
+        offset += (uint64_t)written;
+    }
+    return true;
+}
+
+RF24LogIndexedHandler::RF24LogIndexedHandler(size_t blockSize)
+{
+    _fd = -1;
+    _end = 0;
+    // from the memory budget (maybe smaller); without it, the messages are dropped (and counted)
+    size_t size = sizeof(RF24LogIndexedBlockHeader) + (blockSize < 1024 ? 1024 : blockSize);
+    _block = static_cast<char *>(RF24LogMemory::allocate(&size, sizeof(RF24LogIndexedBlockHeader) + 1024));
+    _blockSize = _block == nullptr ? 0 : size - sizeof(RF24LogIndexedBlockHeader);
+    // without (some of) these, close() reads more of the summaries back from the file
+    _indexCapacity = RF24LOG_INDEXED_INDEX_ENTRIES;
+    _index = RF24LogMemory::allocateArray<RF24LogIndexedIndexEntry>(&_indexCapacity, 1);
+    if (_index == nullptr)
+    {
+        _indexCapacity = 0;
+    }
+    _blockCount = 0;
+    _used = 0;
+    _info.clear();
+    _dropped = 0;
+}
+
+RF24LogIndexedHandler::~RF24LogIndexedHandler()
+{
+    close();
+    RF24LogMemory::release(_block);
+    RF24LogMemory::releaseArray(_index, _indexCapacity);
+}
+
+bool RF24LogIndexedHandler::open(const char *path)
+{
+    close();
+    std::lock_guard<std::mutex> lock(_mutex);
+    int fd = ::open(path, O_RDWR | O_CREAT | O_CLOEXEC, 0644);
+    if (fd < 0)
+    {
+        return false;
+    }
+    struct stat info;
+    if (fstat(fd, &info) != 0)
+    {
+        ::close(fd);
+        return false;
+    }
+    if (info.st_size == 0)
+    {
+        RF24LogIndexedFileHeader header;
+        memset(&header, 0, sizeof(header));
+        memcpy(header.magic, RF24LOG_INDEXED_MAGIC, sizeof(RF24LOG_INDEXED_MAGIC));
+        header.version = RF24LOG_INDEXED_VERSION;
+        if (!pwriteAll(fd, &header, sizeof(header), 0))
+        {
+            ::close(fd);
+            return false;
+        }
+        _blockCount = 0;
+        _end = sizeof(header);
+    }
+    else
+    {
+        // append after the last complete block (dropping the old index, or a torn block)
+        std::vector<RF24LogIndexedIndexEntry> index;
+        if (!RF24LogIndexedReader::readIndex(fd, &index, &_end) || ftruncate(fd, (off_t)_end) != 0)
+        {
+            ::close(fd);
+            return false;
+        }
+        _blockCount = index.size();
+        for (size_t i = 0; i < _blockCount && i < _indexCapacity; ++i)
+        {
+            _index[i] = index[i];
+        }
+    }
+    _fd = fd;
+    _used = 0;
+    _info.clear();
+    return true;
+}
+
+void RF24LogIndexedHandler::close()
+{
+    std::lock_guard<std::mutex> lock(_mutex);
+    if (_fd < 0)
+    {
+        return;
+    }
+    writeBlockLocked();
+    writeIndexLocked();
+    ::close(_fd);
+    _fd = -1;
+    _blockCount = 0;
+}
+
+void RF24LogIndexedHandler::flush()
+{
+    std::lock_guard<std::mutex> lock(_mutex);
+    writeBlockLocked();
+}
+
+uint64_t RF24LogIndexedHandler::dropped()
+{
+    std::lock_guard<std::mutex> lock(_mutex);
+    return _dropped;
+}
+
+void RF24LogIndexedHandler::write(uint8_t logLevel,
+                                  const char *vendorId,
+                                  const char *message,
+                                  va_list *args)
+{
+    uint8_t packed[RF24LOG_INDEXED_ARGS_SIZE];
+    uint16_t argsSize = RF24LogArgList::pack(packed, sizeof(packed), message, args);
+    store(logLevel, 0, vendorId, message, packed, argsSize, rf24LogNow());
+}
+
+void RF24LogIndexedHandler::logRecord(const RF24LogRecord *record)
+{
+    if (!isLevelEnabled(record->logLevel) && !(record->flags & RF24LOG_RECORD_FORCED))
+    {
+        return;
+    }
+    store(record->logLevel, record->flags, record->vendorId, record->message,
+          record->args, record->argsSize, record->timestamp);
+}
+
+void RF24LogIndexedHandler::store(uint8_t logLevel,
+                                  uint8_t flags,
+                                  const char *vendorId,
+                                  const char *message,
+                                  const uint8_t *args,
+                                  uint16_t argsSize,
+                                  RF24LogTime timestamp)
+{
+    size_t vendorLength = strlen(vendorId);
+    size_t messageLength = strlen(message);
+    size_t size = sizeof(RF24LogIndexedRecord) + vendorLength + messageLength + 2 + argsSize;
+    uint64_t vendorHash = RF24LogIndexedBlockInfo::hashVendor(vendorId, vendorLength);
+
+    std::lock_guard<std::mutex> lock(_mutex);
+    if (_fd < 0 || size > _blockSize || vendorLength > UINT16_MAX || messageLength > UINT16_MAX)
+    {
+        ++_dropped;
+        return;
+    }
+    if (_used + size > _blockSize)
+    {
+        writeBlockLocked();
+    }
+
+    RF24LogIndexedRecord header;
+    header.timestamp = timestamp;
+    header.logLevel = logLevel;
+    header.flags = flags;
+    header.vendorLength = (uint16_t)vendorLength;
+    header.messageLength = (uint16_t)messageLength;
+    header.argsSize = argsSize;
+    char *data = _block + sizeof(RF24LogIndexedBlockHeader) + _used;
+    memcpy(data, &header, sizeof(header));
+    data += sizeof(header);
+    memcpy(data, vendorId, vendorLength + 1);
+    data += vendorLength + 1;
+    memcpy(data, message, messageLength + 1);
+    data += messageLength + 1;
+    memcpy(data, args, argsSize);
+    _used += size;
+    _info.add(timestamp, logLevel, vendorHash);
+
+    if (rf24LogIsUrgent(logLevel))
+    {
+        writeBlockLocked();
+    }
+}
+
+void RF24LogIndexedHandler::writeBlockLocked()
+{
+    if (_used == 0 || _fd < 0)
+    {
+        return;
+    }
+    RF24LogIndexedBlockHeader header;
+    header.magic = RF24LOG_INDEXED_BLOCK_MAGIC;
+    header.dataSize = (uint32_t)_used;
+    header.info = _info;
+    memcpy(_block, &header, sizeof(header));
+    size_t size = sizeof(header) + _used;
+    if (pwriteAll(_fd, _block, size, _end))
+    {
+        if (_blockCount < _indexCapacity)
+        {
+            _index[_blockCount] = {_end, _info};
+        }
+        ++_blockCount;
+        _end += size;
+    }
+    else
+    {
+        _dropped += _info.records;
+    }
+    _used = 0;
+    _info.clear();
+}
+
+void RF24LogIndexedHandler::writeIndexLocked()
+{
+    size_t count = _blockCount < _indexCapacity ? _blockCount : _indexCapacity;
+    uint64_t offset = _end;
+    bool written = pwriteAll(_fd, _index, count * sizeof(RF24LogIndexedIndexEntry), offset);
+    offset += count * sizeof(RF24LogIndexedIndexEntry);
+
+    // the summaries that didn't fit in memory are read back from the headers of the blocks
+    RF24LogIndexedBlockHeader block;
+    uint64_t blockOffset = sizeof(RF24LogIndexedFileHeader);
+    if (written && count < _blockCount && count)
+    {
+        blockOffset = _index[count - 1].offset;
+        written = pread(_fd, &block, sizeof(block), (off_t)blockOffset) == (ssize_t)sizeof(block);
+        blockOffset += sizeof(block) + block.dataSize;
+    }
+    while (written && count < _blockCount)
+    {
+        RF24LogIndexedIndexEntry batch[32];
+        size_t batched = 0;
+        while (batched < 32 && count + batched < _blockCount && blockOffset < _end
+               && pread(_fd, &block, sizeof(block), (off_t)blockOffset) == (ssize_t)sizeof(block)
+               && block.magic == RF24LOG_INDEXED_BLOCK_MAGIC)
+        {
+            batch[batched++] = {blockOffset, block.info};
+            blockOffset += sizeof(block) + block.dataSize;
+        }
+        written = batched && pwriteAll(_fd, batch, batched * sizeof(RF24LogIndexedIndexEntry), offset);
+        offset += batched * sizeof(RF24LogIndexedIndexEntry);
+        count += batched;
+    }
+
+    // without the trailer, a reader hops from block header to block header instead
+    if (written)
+    {
+        RF24LogIndexedTrailer trailer;
+        trailer.magic = RF24LOG_INDEXED_TRAILER_MAGIC;
+        trailer.blockCount = (uint32_t)count;
+        trailer.indexOffset = _end;
+        pwriteAll(_fd, &trailer, sizeof(trailer), offset);
+    }
+}
+
+#endif // defined (RF24LOG_POSIX)
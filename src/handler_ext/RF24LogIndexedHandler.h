@@ -0,0 +1,138 @@
+/**
+ * @file RF24LogIndexedHandler.h
+ * @brief handler that writes log messages to an indexed binary log file
+ * @date Created 19 Oct 2026
+ * @author Brendan Doherty (2bndy5)
+ * @copyright Copyright (C) <br>
+ *     2026    Brendan Doherty (2bndy5) <br>
+ * This General Public License does not permit incorporating your program into
+ * proprietary programs.  If your program is a subroutine library, you may
+ * consider it more useful to permit linking proprietary applications with the
+ * library.  If this is what you want to do, use the GNU Lesser General
+ * Public License instead of this License.
+ */
+
+#ifndef SRC_HANDLER_EXT_RF24LOGINDEXEDHANDLER_H_
+#define SRC_HANDLER_EXT_RF24LOGINDEXEDHANDLER_H_
+
+#include "../RF24LogParts/Common.h" // RF24LOG_POSIX
+
+#if defined (RF24LOG_POSIX)
+#include <mutex>
+#include "../RF24LogParts/AbstractHandler.h"
+#include "../RF24LogParts/IndexedLog.h"
+
+/** @brief The maximum number of bytes of packed arguments stored per message */
+#ifndef RF24LOG_INDEXED_ARGS_SIZE
+#define RF24LOG_INDEXED_ARGS_SIZE 256
+#endif
+
+/**
+ * @brief The number of block summaries kept in memory for the index (1024 blocks of 64 KiB
+ * cover 64 MiB of messages). The summaries of any more blocks are read back from the file.
+ */
+#ifndef RF24LOG_INDEXED_INDEX_ENTRIES
+#define RF24LOG_INDEXED_INDEX_ENTRIES 1024
+#endif
+
+/**
+ * @brief Module to extend the RF24LogBaseHandler mechanism for logging to an indexed
+ * binary log file (see RF24LogParts/IndexedLog.h).
+ *
+ * Messages are stored unformatted (the vendorId, message and packed arguments) in blocks.
+ * Each block's header summarizes it (its time range, the levels present and a bloom filter
+ * of its vendorIds), and close() appends an index of all the summaries, so a
+ * RF24LogIndexedReader only reads the blocks that can match its filters.
+ *
+ * A block is written when it is full, and right away when an @ref ERROR (or more severe)
+ * message is logged. A file that was not closed (its writer crashed) stays readable up to
+ * its last complete block; open() repairs it before appending.
+ *
+ * The block and the summaries of @ref RF24LOG_INDEXED_INDEX_ENTRIES blocks are allocated from
+ * the RF24LogMemory budget, so logging never allocates memory. Once more blocks are written,
+ * close() reads their summaries back from the headers of the blocks in the file.
+ */
+class RF24LogIndexedHandler : public RF24LogAbstractHandler
+{
+public:
+
+    /**
+     * @brief Instance constructor
+     * @param blockSize The number of bytes of messages per block. The block is allocated from the
+     * RF24LogMemory budget, so it can be smaller; if it is refused, the messages are dropped.
+     * The summaries for the index can also get fewer entries (or none), which only makes close()
+     * read more of them back from the file.
+     */
+    RF24LogIndexedHandler(size_t blockSize = 65536);
+
+    /** @brief closes the file */
+    ~RF24LogIndexedHandler();
+
+    /**
+     * @brief create a file, or open an existing one to append to it.
+     *
+     * Messages are dropped until this succeeds.
+     * @param path The file's path
+     * @return true if the file is ready to use
+     */
+    bool open(const char *path);
+
+    /** @brief write the pending messages and the index, and close the file */
+    void close();
+
+    /** @brief write the pending messages (as a block) */
+    void flush();
+
+    /** @brief the number of messages dropped (no open file, too large, or write errors) */
+    uint64_t dropped();
+
+    /**
+     * @brief store a captured message (if its level is enabled) with its capture timestamp.
+     * @param record The captured message
+     */
+    void logRecord(const RF24LogRecord *record);
+
+protected:
+
+    void write(uint8_t logLevel,
+               const char *vendorId,
+               const char *message,
+               va_list *args);
+
+private:
+
+    /** @brief add a message to the block being filled */
+    void store(uint8_t logLevel,
+               uint8_t flags,
+               const char *vendorId,
+               const char *message,
+               const uint8_t *args,
+               uint16_t argsSize,
+               RF24LogTime timestamp);
+
+    /** @brief write the block being filled; the caller holds _mutex */
+    void writeBlockLocked();
+
+    /** @brief write the index and the trailer after the last block; the caller holds _mutex */
+    void writeIndexLocked();
+
+    int _fd;
+    /** @brief The file offset of the next block */
+    uint64_t _end;
+    /** @brief The block being filled (starting with the space for its header) */
+    char *_block;
+    size_t _blockSize;
+    /** @brief The number of bytes of messages in @ref _block */
+    size_t _used;
+    RF24LogIndexedBlockInfo _info;
+    /** @brief The summaries of the first blocks of the file (for the index) */
+    RF24LogIndexedIndexEntry *_index;
+    size_t _indexCapacity;
+    /** @brief The number of blocks in the file */
+    size_t _blockCount;
+    uint64_t _dropped;
+    std::mutex _mutex;
+};
+
+#endif // defined (RF24LOG_POSIX)
+#endif /* SRC_HANDLER_EXT_RF24LOGINDEXEDHANDLER_H_ */
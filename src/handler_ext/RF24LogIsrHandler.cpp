@@ -0,0 +1,137 @@
+/**
+ * @file RF24LogIsrHandler.cpp
+ * @date Created 19 Oct 2026
+ * @author Brendan Doherty (2bndy5)
+ * @copyright Copyright (C) <br>
+ *     2026    Brendan Doherty (2bndy5) <br>
+ * This General Public License does not permit incorporating your program into
+ * proprietary programs.  If your program is a subroutine library, you may
+ * consider it more useful to permit linking proprietary applications with the
+ * library.  If this is what you want to do, use the GNU Lesser General
+ * Public License instead of this License.
+ */
+
+#include "RF24LogIsrHandler.h"
+#include "../RF24LogLevel.h"
+
+RF24LogIsrHandler::RF24LogIsrHandler(RF24LogBaseHandler *handler,
+                                     RF24LogRecordSlot *slots,
+                                     RF24LogQueuePos count)
+    : queue(slots, count)
+{
+    this->handler = handler;
+#if defined (RF24LOG_POSIX)
+    waiter.store(nullptr);
+    stopping.store(false);
+#endif
+}
+
+void RF24LogIsrHandler::write(uint8_t logLevel,
+                              const char *vendorId,
+                              const char *message,
+                              va_list *args)
+{
+    queue.push(logLevel, vendorId, message, args);
+#if defined (RF24LOG_POSIX)
+    RF24LogWaiter *consumerWaiter = waiter.load(std::memory_order_acquire);
+    if (consumerWaiter != nullptr)
+    {
+        consumerWaiter->notify(rf24LogIsUrgent(logLevel)); // errors wake it at once
+    }
+#endif
+}
+
+#if defined (ARDUINO_ARCH_AVR)
+void RF24LogIsrHandler::write(uint8_t logLevel,
+                              const __FlashStringHelper *vendorId,
+                              const __FlashStringHelper *message,
+                              va_list *args)
+{
+    queue.push(logLevel, vendorId, message, args);
+}
+#endif
+
+void RF24LogIsrHandler::logRecord(const RF24LogRecord *record)
+{
+    if (!isLevelEnabled(record->logLevel) && !(record->flags & RF24LOG_RECORD_FORCED))
+    {
+        return;
+    }
+    RF24LogRecordSlot *slot = queue.claim();
+    if (slot == nullptr)
+    {
+        return;
+    }
+    slot->record = *record;
+    queue.publish(slot);
+#if defined (RF24LOG_POSIX)
+    RF24LogWaiter *consumerWaiter = waiter.load(std::memory_order_acquire);
+    if (consumerWaiter != nullptr)
+    {
+        consumerWaiter->notify(rf24LogIsUrgent(record->logLevel));
+    }
+#endif
+}
+
+RF24LogQueuePos RF24LogIsrHandler::poll(RF24LogQueuePos maxRecords)
+{
+    RF24LogQueuePos count = 0;
+    RF24LogRecord *record;
+    while (count < maxRecords && (record = queue.front()) != nullptr)
+    {
+        handler->logRecord(record);
+        queue.pop();
+        ++count;
+    }
+    return count;
+}
+
+RF24LogQueuePos RF24LogIsrHandler::dropped()
+{
+    return queue.dropped();
+}
+
+#if defined (RF24LOG_POSIX)
+void RF24LogIsrHandler::start(RF24LogWaiter *waiter, int cpu)
+{
+    stop();
+    stopping.store(false);
+    this->waiter.store(waiter, std::memory_order_release);
+    consumer = std::thread([this, waiter, cpu]() {
+        if (cpu >= 0)
+        {
+            RF24LogWaiter::pinThread(cpu);
+        }
+        while (true)
+        {
+            if (poll(64))
+            {
+                continue;
+            }
+            if (stopping.load(std::memory_order_seq_cst))
+            {
+                poll(); // the messages captured before stop() was called
+                return;
+            }
+            waiter->wait([this]() { return queue.size() != 0 || stopping.load(std::memory_order_relaxed); });
+        }
+    });
+}
+
+void RF24LogIsrHandler::stop()
+{
+    if (consumer.joinable())
+    {
+        stopping.store(true, std::memory_order_seq_cst);
+        RF24LogWaiter *consumerWaiter = waiter.load();
+        consumerWaiter->notify(true);
+        consumer.join();
+        waiter.store(nullptr);
+    }
+}
+
+RF24LogIsrHandler::~RF24LogIsrHandler()
+{
+    stop();
+}
+#endif
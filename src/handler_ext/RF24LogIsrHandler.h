@@ -0,0 +1,111 @@
+/**
+ * @file RF24LogIsrHandler.h
+ * @brief handler extention to capture log messages from interrupt (or signal) handlers
+ * @date Created 19 Oct 2026
+ * @author Brendan Doherty (2bndy5)
+ * @copyright Copyright (C) <br>
+ *     2026    Brendan Doherty (2bndy5) <br>
+ * This General Public License does not permit incorporating your program into
+ * proprietary programs.  If your program is a subroutine library, you may
+ * consider it more useful to permit linking proprietary applications with the
+ * library.  If this is what you want to do, use the GNU Lesser General
+ * Public License instead of this License.
+ */
+
+#ifndef SRC_HANDLER_EXT_RF24LOGISRHANDLER_H_
+#define SRC_HANDLER_EXT_RF24LOGISRHANDLER_H_
+
+#include "../RF24LogBaseHandler.h"
+#include "../RF24LogParts/AbstractHandler.h"
+#include "../RF24LogParts/RecordQueue.h"
+#if defined (RF24LOG_POSIX)
+#include <thread>
+#include "../RF24LogParts/Waiter.h"
+#endif
+
+/**
+ * @brief Module to extend the RF24LogBaseHandler mechanism for logging from an ISR.
+ *
+ * Logged messages are not formatted or output immediately. Instead, they are copied
+ * into a statically sized lock-free queue (without allocating memory, blocking or
+ * calling stdio/`Print` functions). The captured messages are output later (from
+ * the main program or a thread) by calling poll().
+ *
+ * On POSIX platforms, a signal handler is a suitable stand-in for an ISR, and the captured
+ * messages can also be output by a background thread (see start()).
+ */
+class RF24LogIsrHandler : public RF24LogAbstractHandler
+{
+private:
+    /** @brief The captured messages */
+    RF24LogRecordQueue queue;
+    /** @brief The handler that outputs the captured messages */
+    RF24LogBaseHandler *handler;
+#if defined (RF24LOG_POSIX)
+    /** @brief How the background thread waits for messages (nullptr if it is not started) */
+    std::atomic<RF24LogWaiter *> waiter;
+    std::thread consumer;
+    std::atomic<bool> stopping;
+#endif
+
+public:
+
+    /**
+     * @brief Instance constructor
+     * @param handler The handler used to output the captured messages (from poll()).
+     * @param slots The storage for captured messages (usually a static array).
+     * @param count The number of @p slots (rounded down to a power of 2). It must be at least
+     * 2; with fewer slots, every message is dropped (see dropped()).
+     */
+    RF24LogIsrHandler(RF24LogBaseHandler *handler, RF24LogRecordSlot *slots, RF24LogQueuePos count);
+
+    /**
+     * @brief output the captured messages.
+     *
+     * This must only be called from the main program (or a single thread), never from an ISR.
+     * @param maxRecords The maximum number of messages to output.
+     * @return The number of messages that were output.
+     */
+    RF24LogQueuePos poll(RF24LogQueuePos maxRecords = (RF24LogQueuePos)-1);
+
+    /** @brief the number of messages dropped because the queue was full */
+    RF24LogQueuePos dropped();
+
+    /**
+     * @brief queue a copy of a message that was captured earlier (if its level is enabled).
+     * @param record The captured message
+     */
+    void logRecord(const RF24LogRecord *record);
+
+#if defined (RF24LOG_POSIX)
+    /**
+     * @brief output the captured messages from a background thread (instead of calling poll()).
+     * @param waiter How the thread waits for messages (see RF24LogWaiter). It must remain valid
+     * until stop() is called.
+     * @param cpu The CPU core to pin the thread to (`-1` for any core)
+     */
+    void start(RF24LogWaiter *waiter, int cpu = -1);
+
+    /** @brief output the messages captured so far, then stop the background thread */
+    void stop();
+
+    /** @brief stops the background thread */
+    ~RF24LogIsrHandler();
+#endif
+
+protected:
+
+    void write(uint8_t logLevel,
+               const char *vendorId,
+               const char *message,
+               va_list *args);
+
+#if defined (ARDUINO_ARCH_AVR)
+    void write(uint8_t logLevel,
+               const __FlashStringHelper *vendorId,
+               const __FlashStringHelper *message,
+               va_list *args);
+#endif
+};
+
+#endif /* SRC_HANDLER_EXT_RF24LOGISRHANDLER_H_ */
@@ -0,0 +1,310 @@
+/**
+ * @file RF24LogLaneHandler.cpp
+ * @date Created 19 Oct 2026
+ * @author Brendan Doherty (2bndy5)
+ * @copyright Copyright (C) <br>
+ *     2026    Brendan Doherty (2bndy5) <br>
+ * This General Public License does not permit incorporating your program into
+ * proprietary programs.  If your program is a subroutine library, you may
+ * consider it more useful to permit linking proprietary applications with the
+ * library.  If this is what you want to do, use the GNU Lesser General
+ * Public License instead of this License.
+ */
+
+#include "RF24LogLaneHandler.h"
+
+#if defined (RF24LOG_POSIX)
+#include <chrono>
+#include "../RF24LogParts/ArgList.h"
+#include "../RF24LogParts/Memory.h"
+
+/** @brief The number of queued info/debug messages written between checks of the urgent lane */
+#define RF24LOG_LANE_URGENT_CHECK 64
+
+RF24LogLaneHandler::RF24LogLaneHandler(RF24LogSink *sink, uint32_t maxLatency, uint32_t slots)
+    : _sink(sink), _maxLatency(maxLatency), _sequence(0), _sleeping(false), _queued(0), _dequeued(0),
+      _flushers(0), _stopping(false)
+{
+    const uint8_t policies[RF24LOG_LANES] = {RF24LOG_LANE_SYNC, RF24LOG_LANE_BLOCK, RF24LOG_LANE_DROP};
+    for (uint8_t i = 0; i < RF24LOG_LANES; ++i)
+    {
+        // from the memory budget (maybe fewer); a lane without slots writes its messages synchronously
+        Lane *lane = &_lanes[i];
+        size_t granted = slots < 2 ? 2 : slots;
+        lane->slots = RF24LogMemory::allocateArray<Slot>(&granted, 2);
+        uint32_t count = 2;
+        while (count * 2 <= granted)
+        {
+            count *= 2;
+        }
+        for (size_t j = count; j < granted; ++j)
+        {
+            lane->slots[j].~Slot(); // beyond the power of 2
+        }
+        lane->queue.setSlots(lane->slots, count, sizeof(Slot));
+        lane->policy.store(lane->slots != nullptr ? policies[i] : RF24LOG_LANE_SYNC, std::memory_order_relaxed);
+        lane->written.store(0, std::memory_order_relaxed);
+        lane->dropped.store(0, std::memory_order_relaxed);
+    }
+    _thread = std::thread(&RF24LogLaneHandler::run, this);
+}
+
+RF24LogLaneHandler::~RF24LogLaneHandler()
+{
+    flush();
+    {
+        std::lock_guard<std::mutex> lock(_mutex);
+        _stopping.store(true);
+    }
+    _wakeup.notify_all();
+    _thread.join();
+    for (Lane &lane : _lanes)
+    {
+        RF24LogMemory::releaseArray(lane.slots, (size_t)lane.queue.capacity());
+    }
+}
+
+void RF24LogLaneHandler::setPolicy(uint8_t lane, uint8_t policy)
+{
+    if (lane < RF24LOG_LANES && _lanes[lane].slots != nullptr)
+    {
+        _lanes[lane].policy.store(policy, std::memory_order_relaxed);
+    }
+}
+
+void RF24LogLaneHandler::write(uint8_t logLevel,
+                               const char *vendorId,
+                               const char *message,
+                               va_list *args)
+{
+    deliver(logLevel, vendorId, message, args, nullptr);
+}
+
+void RF24LogLaneHandler::logRecord(const RF24LogRecord *record)
+{
+    if (!isLevelEnabled(record->logLevel) && !(record->flags & RF24LOG_RECORD_FORCED))
+    {
+        return;
+    }
+    deliver(record->logLevel, record->vendorId, record->message, nullptr, record);
+}
+
+void RF24LogLaneHandler::deliver(uint8_t logLevel,
+                                 const char *vendorId,
+                                 const char *message,
+                                 va_list *args,
+                                 const RF24LogRecord *record)
+{
+    uint32_t sequence = _sequence.fetch_add(1, std::memory_order_relaxed);
+    uint8_t laneIndex = laneOf(logLevel);
+    Lane *lane = &_lanes[laneIndex];
+    uint8_t policy = lane->policy.load(std::memory_order_relaxed);
+
+    if (policy == RF24LOG_LANE_SYNC)
+    {
+        if (record != nullptr)
+        {
+            RF24LogArgList argList(record->args, record->argsSize);
+            output(logLevel, vendorId, message, &argList, record->timestamp, &record->thread, sequence, true);
+        }
+        else
+        {
+            RF24LogArgList argList(args);
+            output(logLevel, vendorId, message, &argList, rf24LogNow(), nullptr, sequence, true);
+        }
+        lane->written.fetch_add(1, std::memory_order_relaxed);
+        return;
+    }
+
+    RF24LogQueuePos position;
+    Slot *slot;
+    while ((slot = static_cast<Slot *>(lane->queue.tryClaim(&position))) == nullptr)
+    {
+        // the lane is full
+        if (policy == RF24LOG_LANE_DROP)
+        {
+            lane->dropped.fetch_add(1, std::memory_order_relaxed);
+            return;
+        }
+        if (_sleeping.load(std::memory_order_seq_cst))
+        {
+            {
+                std::lock_guard<std::mutex> lock(_mutex);
+            }
+            _wakeup.notify_one();
+        }
+        std::this_thread::yield();
+    }
+
+    slot->number = sequence;
+    if (record != nullptr)
+    {
+        slot->record = *record;
+    }
+    else
+    {
+        slot->record.capture(logLevel, vendorId, message, args);
+    }
+    lane->queue.publish(slot);
+    _queued.fetch_add(1, std::memory_order_relaxed);
+
+    // the urgent lane wakes the thread at once; the others when they are half full
+    std::atomic_thread_fence(std::memory_order_seq_cst); // orders the publish with the check of _sleeping
+    if (_sleeping.load(std::memory_order_seq_cst) && (laneIndex == RF24LOG_LANE_URGENT || isHalfFull(lane)))
+    {
+        {
+            std::lock_guard<std::mutex> lock(_mutex);
+        }
+        _wakeup.notify_one();
+    }
+}
+
+void RF24LogLaneHandler::output(uint8_t logLevel,
+                                const char *vendorId,
+                                const char *message,
+                                RF24LogArgList *args,
+                                RF24LogTime timestamp,
+                                const RF24LogThread *thread,
+                                uint32_t sequence,
+                                bool urgent)
+{
+    char buffer[RF24LOG_LINE_SIZE];
+    size_t length = _formatter.format(buffer, sizeof(buffer), logLevel, vendorId, message, args, timestamp, sequence,
+                                      thread);
+    std::lock_guard<std::mutex> lock(_sinkMutex);
+    _sink->write(buffer, length, logLevel);
+    if (urgent)
+    {
+        _sink->flush();
+    }
+}
+
+void RF24LogLaneHandler::pop(Lane *lane)
+{
+    lane->queue.pop();
+    lane->written.fetch_add(1, std::memory_order_relaxed);
+    _dequeued.fetch_add(1, std::memory_order_seq_cst);
+}
+
+uint32_t RF24LogLaneHandler::drainUrgent()
+{
+    Lane *lane = &_lanes[RF24LOG_LANE_URGENT];
+    uint32_t count = 0;
+    Slot *slot;
+    while ((slot = front(lane)) != nullptr)
+    {
+        RF24LogRecord *record = &slot->record;
+        RF24LogArgList args(record->args, record->argsSize);
+        output(record->logLevel, record->vendorId, record->message, &args, record->timestamp, &record->thread,
+               slot->number, true);
+        pop(lane);
+        ++count;
+    }
+    return count;
+}
+
+uint32_t RF24LogLaneHandler::drain()
+{
+    uint32_t count = drainUrgent();
+    uint32_t batch = 0;
+    Lane *info = &_lanes[RF24LOG_LANE_INFO];
+    Lane *debug = &_lanes[RF24LOG_LANE_DEBUG];
+    while (true)
+    {
+        // merge the info and debug lanes by the messages' numbers
+        Slot *infoSlot = front(info);
+        Slot *debugSlot = front(debug);
+        Lane *lane;
+        Slot *slot;
+        if (infoSlot != nullptr && (debugSlot == nullptr || (int32_t)(infoSlot->number - debugSlot->number) < 0))
+        {
+            lane = info;
+            slot = infoSlot;
+        }
+        else if (debugSlot != nullptr)
+        {
+            lane = debug;
+            slot = debugSlot;
+        }
+        else
+        {
+            break;
+        }
+        RF24LogRecord *record = &slot->record;
+        RF24LogArgList args(record->args, record->argsSize);
+        output(record->logLevel, record->vendorId, record->message, &args, record->timestamp, &record->thread,
+               slot->number, false);
+        pop(lane);
+        ++batch;
+        if (batch % RF24LOG_LANE_URGENT_CHECK == 0)
+        {
+            count += drainUrgent(); // an urgent message never waits for a whole batch
+        }
+    }
+    if (batch)
+    {
+        std::lock_guard<std::mutex> lock(_sinkMutex);
+        _sink->flush();
+    }
+    return count + batch;
+}
+
+bool RF24LogLaneHandler::isWakeNeeded()
+{
+    if (_stopping.load() || front(&_lanes[RF24LOG_LANE_URGENT]) != nullptr)
+    {
+        return true;
+    }
+    if (_flushers.load(std::memory_order_seq_cst) && _dequeued.load() != _queued.load())
+    {
+        return true;
+    }
+    for (uint8_t i = RF24LOG_LANE_INFO; i < RF24LOG_LANES; ++i)
+    {
+        if (isHalfFull(&_lanes[i]))
+        {
+            return true;
+        }
+    }
+    return false;
+}
+
+void RF24LogLaneHandler::run()
+{
+    while (true)
+    {
+        if (drain() && _flushers.load(std::memory_order_seq_cst))
+        {
+            {
+                std::lock_guard<std::mutex> lock(_mutex);
+            }
+            _drained.notify_all();
+        }
+
+        std::unique_lock<std::mutex> lock(_mutex);
+        if (_stopping.load())
+        {
+            return; // flush() made sure nothing was left to write
+        }
+        _sleeping.store(true, std::memory_order_seq_cst);
+        std::atomic_thread_fence(std::memory_order_seq_cst); // orders it with the checks of the lanes
+        _wakeup.wait_for(lock, std::chrono::milliseconds(_maxLatency), [this]() { return isWakeNeeded(); });
+        _sleeping.store(false, std::memory_order_relaxed);
+    }
+}
+
+void RF24LogLaneHandler::flush()
+{
+    uint64_t target = _queued.load(std::memory_order_seq_cst);
+    _flushers.fetch_add(1, std::memory_order_seq_cst);
+    {
+        std::unique_lock<std::mutex> lock(_mutex);
+        _wakeup.notify_one();
+        _drained.wait(lock, [&]() { return _dequeued.load(std::memory_order_seq_cst) >= target; });
+    }
+    _flushers.fetch_sub(1, std::memory_order_relaxed);
+    std::lock_guard<std::mutex> lock(_sinkMutex);
+    _sink->flush();
+}
+
+#endif // defined (RF24LOG_POSIX)
@@ -0,0 +1,228 @@
+/**
+ * @file RF24LogLaneHandler.h
+ * @brief handler that delivers errors and warnings ahead of queued info and debug messages
+ * @date Created 19 Oct 2026
+ * @author Brendan Doherty (2bndy5)
+ * @copyright Copyright (C) <br>
+ *     2026    Brendan Doherty (2bndy5) <br>
+ * This General Public License does not permit incorporating your program into
+ * proprietary programs.  If your program is a subroutine library, you may
+ * consider it more useful to permit linking proprietary applications with the
+ * library.  If this is what you want to do, use the GNU Lesser General
+ * Public License instead of this License.
+ */
+
+#ifndef SRC_HANDLER_EXT_RF24LOGLANEHANDLER_H_
+#define SRC_HANDLER_EXT_RF24LOGLANEHANDLER_H_
+
+#include "../RF24LogParts/Common.h" // RF24LOG_POSIX
+
+#if defined (RF24LOG_POSIX)
+#include <atomic>
+#include <condition_variable>
+#include <mutex>
+#include <thread>
+#include "../RF24LogParts/AbstractHandler.h"
+#include "../RF24LogParts/LineFormatter.h"
+#include "../RF24LogParts/Record.h"
+#include "../RF24LogParts/RecordQueue.h"
+#include "../RF24LogParts/Sink.h"
+
+/** @brief The lane of @ref ERROR and @ref WARN messages (and any more severe levels) */
+#define RF24LOG_LANE_URGENT 0
+/** @brief The lane of @ref INFO messages */
+#define RF24LOG_LANE_INFO 1
+/** @brief The lane of @ref DEBUG messages (and any less severe levels) */
+#define RF24LOG_LANE_DEBUG 2
+/** @brief The number of lanes */
+#define RF24LOG_LANES 3
+
+/** @brief lane policy: the logging thread formats and writes the message (then flushes the sink) */
+#define RF24LOG_LANE_SYNC 0
+/** @brief lane policy: the message is queued; when the lane is full, the logging thread waits */
+#define RF24LOG_LANE_BLOCK 1
+/** @brief lane policy: the message is queued; when the lane is full, it is dropped (and counted) */
+#define RF24LOG_LANE_DROP 2
+
+/**
+ * @brief Module to extend the RF24LogBaseHandler mechanism for delivering the log messages of
+ * each class of levels through a separate lane.
+ *
+ * The class of a level is its octal "tens" digit (see @ref logLevels): errors and warnings
+ * share the urgent lane, while the info and debug messages have 1 lane each. Every lane has
+ * its own policy:
+ * - @ref RF24LOG_LANE_SYNC writes the message to the RF24LogSink from the logging thread,
+ *   so it never waits behind queued messages (the default of the urgent lane).
+ * - @ref RF24LOG_LANE_BLOCK queues the message, and makes the logging thread wait when the
+ *   lane is full (the default of the info lane).
+ * - @ref RF24LOG_LANE_DROP queues the message, and drops it when the lane is full (the
+ *   default of the debug lane), so debug messages are shed before anything else is delayed.
+ *
+ * A thread writes the queued messages to the sink. It wakes up at once for a queued urgent
+ * message (and writes the queued urgent messages before any other), and otherwise wakes up
+ * when a lane is half full or when its oldest message is `maxLatency` milliseconds old, so the
+ * info and debug messages are written in batches. The sink is flushed after each batch and
+ * after each urgent message.
+ *
+ * Every message is numbered when it is logged (including the messages that are dropped), and
+ * the info and debug lanes are merged by these numbers. Because urgent messages overtake the
+ * queued messages, readers that need the exact order can show the numbers with the `%n` field
+ * of a RF24LogHeaderPattern (see setHeaderPattern()); a gap in the numbers shows where
+ * messages were dropped.
+ */
+class RF24LogLaneHandler : public RF24LogAbstractHandler
+{
+public:
+
+    /**
+     * @brief Instance constructor
+     * @param sink The sink that receives the formatted messages
+     * @param maxLatency The maximum time (in milliseconds) that a queued message waits
+     * before the thread writes it
+     * @param slots The number of messages each lane can queue (rounded down to a power of 2).
+     * The slots are allocated from the RF24LogMemory budget, so there can be fewer; a lane
+     * whose slots are refused uses the @ref RF24LOG_LANE_SYNC policy.
+     */
+    RF24LogLaneHandler(RF24LogSink *sink, uint32_t maxLatency = 100, uint32_t slots = 1024);
+
+    /** @brief writes the queued messages and stops the thread */
+    ~RF24LogLaneHandler();
+
+    /**
+     * @brief change the policy of a lane (a lane without slots keeps the @ref RF24LOG_LANE_SYNC policy)
+     * @param lane The lane (like @ref RF24LOG_LANE_DEBUG)
+     * @param policy The policy (like @ref RF24LOG_LANE_DROP)
+     */
+    void setPolicy(uint8_t lane, uint8_t policy);
+
+    /**
+     * @brief use a compiled header layout for the messages (see RF24LogPrintfParser::setHeaderPattern()).
+     *
+     * The `%n` field of the @p pattern shows the number given to each message when it was logged.
+     * @param pattern The header layout (or `nullptr` for the default header)
+     */
+    void setHeaderPattern(RF24LogHeaderPattern *pattern) { _formatter.setHeaderPattern(pattern); }
+
+    /**
+     * @brief queue (or write) a captured message if its level is enabled, keeping its capture timestamp.
+     * @param record The captured message
+     */
+    void logRecord(const RF24LogRecord *record);
+
+    /** @brief wait for the messages queued so far to be written, then flush the sink */
+    void flush();
+
+    /**
+     * @brief the lane of a level
+     * @param logLevel The level of a logging message
+     * @return @ref RF24LOG_LANE_URGENT, @ref RF24LOG_LANE_INFO or @ref RF24LOG_LANE_DEBUG
+     */
+    static inline uint8_t laneOf(uint8_t logLevel)
+    {
+        uint8_t levelClass = static_cast<uint8_t>(logLevel >> 3);
+        return levelClass < 3 ? RF24LOG_LANE_URGENT : (levelClass == 3 ? RF24LOG_LANE_INFO : RF24LOG_LANE_DEBUG);
+    }
+
+    /** @brief the number of messages of a lane that were written to the sink */
+    uint64_t written(uint8_t lane) { return _lanes[lane].written.load(std::memory_order_relaxed); }
+
+    /** @brief the number of messages of a lane that were dropped because the lane was full */
+    uint64_t dropped(uint8_t lane) { return _lanes[lane].dropped.load(std::memory_order_relaxed); }
+
+protected:
+
+    void write(uint8_t logLevel,
+               const char *vendorId,
+               const char *message,
+               va_list *args);
+
+private:
+
+    /** @brief formats the messages (the output is done by the handler) */
+    class Formatter : public RF24LogLineFormatter
+    {
+    protected:
+        void writeLine(const char *, size_t, uint8_t) {}
+    };
+
+    /** @brief A queued message */
+    struct Slot : RF24LogRecordSlot
+    {
+        /** @brief The number given to the message when it was logged */
+        uint32_t number;
+    };
+
+    /** @brief A queue of messages for many producers and the handler's thread */
+    struct Lane
+    {
+        Slot *slots;
+        RF24LogRecordQueue queue;
+        std::atomic<uint8_t> policy;
+        std::atomic<uint64_t> written;
+        std::atomic<uint64_t> dropped;
+    };
+
+    /** @brief queue (or write) a message */
+    void deliver(uint8_t logLevel,
+                 const char *vendorId,
+                 const char *message,
+                 va_list *args,
+                 const RF24LogRecord *record);
+
+    /** @brief format a message and write it to the sink (then flush the sink if @p urgent) */
+    void output(uint8_t logLevel,
+                const char *vendorId,
+                const char *message,
+                RF24LogArgList *args,
+                RF24LogTime timestamp,
+                const RF24LogThread *thread,
+                uint32_t sequence,
+                bool urgent);
+
+    /** @brief the oldest queued message of a lane (or nullptr) */
+    Slot *front(Lane *lane) { return static_cast<Slot *>(lane->queue.frontSlot()); }
+
+    /** @brief release the message from front() */
+    void pop(Lane *lane);
+
+    /** @brief is a lane more than half full? */
+    bool isHalfFull(Lane *lane) { return lane->queue.size() > lane->queue.capacity() / 2; }
+
+    /** @brief write the queued urgent messages; returns the number written */
+    uint32_t drainUrgent();
+
+    /** @brief write all the queued messages (the urgent ones first); returns the number written */
+    uint32_t drain();
+
+    /** @brief is there a reason for the handler's thread to stop waiting? */
+    bool isWakeNeeded();
+
+    /** @brief the handler's thread */
+    void run();
+
+    RF24LogSink *_sink;
+    uint32_t _maxLatency;
+    Formatter _formatter;
+    Lane _lanes[RF24LOG_LANES];
+
+    /** @brief The number given to the next message */
+    std::atomic<uint32_t> _sequence;
+    /** @brief Serializes the writes to the sink */
+    std::mutex _sinkMutex;
+
+    std::thread _thread;
+    std::mutex _mutex;
+    std::condition_variable _wakeup;
+    std::condition_variable _drained;
+    /** @brief Is the handler's thread waiting (producers only notify it when it is)? */
+    std::atomic<bool> _sleeping;
+    /** @brief The number of messages queued, and of queued messages written */
+    std::atomic<uint64_t> _queued;
+    std::atomic<uint64_t> _dequeued;
+    /** @brief The number of threads waiting in flush() */
+    std::atomic<uint32_t> _flushers;
+    std::atomic<bool> _stopping;
+};
+
+#endif // defined (RF24LOG_POSIX)
+#endif /* SRC_HANDLER_EXT_RF24LOGLANEHANDLER_H_ */
@@ -0,0 +1,227 @@
+/**
+ * @file RF24LogParallelHandler.cpp
+ * @date Created 19 Oct 2026
+ * @author Brendan Doherty (2bndy5)
+ * @copyright Copyright (C) <br>
+ *     2026    Brendan Doherty (2bndy5) <br>
+ * This General Public License does not permit incorporating your program into
+ * proprietary programs.  If your program is a subroutine library, you may
+ * consider it more useful to permit linking proprietary applications with the
+ * library.  If this is what you want to do, use the GNU Lesser General
+ * Public License instead of this License.
+ */
+
+#include "RF24LogParallelHandler.h"
+
+#if defined (RF24LOG_POSIX)
+#include "../RF24LogLevel.h"
+#include "../RF24LogParts/ArgList.h"
+#include "../RF24LogParts/Memory.h"
+
+/** @brief The number of times a worker checks for a message before it sleeps */
+#define RF24LOG_PARALLEL_SPINS 256
+
+RF24LogParallelHandler::RF24LogParallelHandler(RF24LogSink *sink, unsigned workers, uint32_t slots, bool block)
+    : _formatNext(0), _emitNext(0), _emitting(false), _sleepers(0), _flushers(0),
+      _stopping(false), _records(0), _dropped(0)
+{
+    _sink = sink;
+    _block = block;
+
+    // the slots come from the memory budget (maybe fewer); without them, the messages are dropped (and counted)
+    size_t granted = slots < 4 ? 4 : slots; // the states of a slot need at least 3 positions
+    _slots = RF24LogMemory::allocateArray<Slot>(&granted, 4);
+    uint32_t count = 4;
+    while (count * 2 <= granted)
+    {
+        count *= 2;
+    }
+    for (size_t i = count; i < granted; ++i)
+    {
+        _slots[i].~Slot(); // beyond the power of 2
+    }
+    _queue.setSlots(_slots, count, sizeof(Slot));
+    if (_slots == nullptr)
+    {
+        return; // no workers either
+    }
+    if (workers == 0)
+    {
+        workers = std::thread::hardware_concurrency();
+    }
+    for (unsigned i = 0; i < (workers ? workers : 1); ++i)
+    {
+        _workers.emplace_back(&RF24LogParallelHandler::run, this);
+    }
+}
+
+RF24LogParallelHandler::~RF24LogParallelHandler()
+{
+    flush();
+    {
+        std::lock_guard<std::mutex> lock(_mutex);
+        _stopping.store(true);
+    }
+    _wakeup.notify_all();
+    for (std::thread &worker : _workers)
+    {
+        worker.join();
+    }
+    RF24LogMemory::releaseArray(_slots, (size_t)_queue.capacity());
+}
+
+RF24LogParallelHandler::Slot *RF24LogParallelHandler::claim()
+{
+    RF24LogQueuePos position;
+    Slot *slot;
+    while ((slot = static_cast<Slot *>(_queue.tryClaim(&position))) == nullptr)
+    {
+        // the slot still holds a message from the previous lap of the ring
+        if (!_block || _slots == nullptr)
+        {
+            _dropped.fetch_add(1, std::memory_order_relaxed);
+            return nullptr;
+        }
+        std::this_thread::yield();
+    }
+    return slot;
+}
+
+void RF24LogParallelHandler::publish(Slot *slot)
+{
+    _queue.publish(slot);
+    std::atomic_thread_fence(std::memory_order_seq_cst); // orders the publish with the check of _sleepers
+    if (_sleepers.load(std::memory_order_seq_cst))
+    {
+        // taking the mutex orders this with a worker that is between its check and its wait
+        {
+            std::lock_guard<std::mutex> lock(_mutex);
+        }
+        _wakeup.notify_all();
+    }
+}
+
+void RF24LogParallelHandler::write(uint8_t logLevel,
+                                   const char *vendorId,
+                                   const char *message,
+                                   va_list *args)
+{
+    Slot *slot = claim();
+    if (slot != nullptr)
+    {
+        slot->record.capture(logLevel, vendorId, message, args);
+        publish(slot);
+    }
+}
+
+void RF24LogParallelHandler::logRecord(const RF24LogRecord *record)
+{
+    if (!isLevelEnabled(record->logLevel) && !(record->flags & RF24LOG_RECORD_FORCED))
+    {
+        return;
+    }
+    Slot *slot = claim();
+    if (slot != nullptr)
+    {
+        slot->record = *record;
+        publish(slot);
+    }
+}
+
+void RF24LogParallelHandler::run()
+{
+    while (true)
+    {
+        // each worker takes the next sequence number, even if it isn't captured yet
+        uint32_t position = _formatNext.fetch_add(1, std::memory_order_relaxed);
+        Slot *slot = static_cast<Slot *>(_queue.slotAt(position));
+        bool captured = false;
+        for (uint16_t i = 0; i < RF24LOG_PARALLEL_SPINS && !captured; ++i)
+        {
+            captured = slot->sequence.load(std::memory_order_acquire) == position + 1;
+        }
+        if (!captured)
+        {
+            _sleepers.fetch_add(1, std::memory_order_seq_cst);
+            std::unique_lock<std::mutex> lock(_mutex);
+            _wakeup.wait(lock, [&]() {
+                return slot->sequence.load(std::memory_order_seq_cst) == position + 1 || _stopping.load();
+            });
+            _sleepers.fetch_sub(1, std::memory_order_relaxed);
+            if (slot->sequence.load(std::memory_order_acquire) != position + 1)
+            {
+                return; // stopping (flush() made sure nothing was left to format)
+            }
+        }
+
+        RF24LogRecord *record = &slot->record;
+        RF24LogArgList args(record->args, record->argsSize);
+        slot->length = (uint32_t)_formatter.format(slot->text, sizeof(slot->text), record->logLevel,
+                                                   record->vendorId, record->message, &args, record->timestamp,
+                                                   &record->thread);
+        slot->sequence.store(position + 2, std::memory_order_seq_cst);
+        emit();
+    }
+}
+
+void RF24LogParallelHandler::emit()
+{
+    while (true)
+    {
+        // 1 worker at a time writes to the sink; the others leave their messages to it
+        if (_emitting.exchange(true, std::memory_order_seq_cst))
+        {
+            return;
+        }
+        uint32_t position = _emitNext.load(std::memory_order_relaxed);
+        uint32_t written = 0;
+        Slot *slot;
+        while ((slot = static_cast<Slot *>(_queue.slotAt(position)))->sequence.load(std::memory_order_acquire)
+               == position + 2)
+        {
+            uint8_t logLevel = slot->record.logLevel;
+            _sink->write(slot->text, slot->length, logLevel);
+            if (rf24LogIsUrgent(logLevel))
+            {
+                _sink->flush();
+            }
+            _queue.release(position);
+            ++position;
+            ++written;
+        }
+        _emitNext.store(position, std::memory_order_seq_cst);
+        _emitting.store(false, std::memory_order_seq_cst);
+        if (written)
+        {
+            _records.fetch_add(written, std::memory_order_relaxed);
+            if (_flushers.load(std::memory_order_seq_cst))
+            {
+                {
+                    std::lock_guard<std::mutex> lock(_mutex);
+                }
+                _written.notify_all();
+            }
+        }
+        // a worker that formatted the next message while this one was writing left it here
+        if (_queue.slotAt(position)->sequence.load(std::memory_order_seq_cst) != position + 2)
+        {
+            return;
+        }
+    }
+}
+
+void RF24LogParallelHandler::flush()
+{
+    uint32_t target = _queue.claimed();
+    _flushers.fetch_add(1, std::memory_order_seq_cst);
+    {
+        std::unique_lock<std::mutex> lock(_mutex);
+        _written.wait(lock, [&]() {
+            return (int32_t)(_emitNext.load(std::memory_order_seq_cst) - target) >= 0;
+        });
+    }
+    _flushers.fetch_sub(1, std::memory_order_relaxed);
+    _sink->flush();
+}
+
+#endif // defined (RF24LOG_POSIX)
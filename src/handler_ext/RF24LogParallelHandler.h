@@ -0,0 +1,155 @@
+/**
+ * @file RF24LogParallelHandler.h
+ * @brief handler that formats log messages on a pool of worker threads
+ * @date Created 19 Oct 2026
+ * @author Brendan Doherty (2bndy5)
+ * @copyright Copyright (C) <br>
+ *     2026    Brendan Doherty (2bndy5) <br>
+ * This General Public License does not permit incorporating your program into
+ * proprietary programs.  If your program is a subroutine library, you may
+ * consider it more useful to permit linking proprietary applications with the
+ * library.  If this is what you want to do, use the GNU Lesser General
+ * Public License instead of this License.
+ */
+
+#ifndef SRC_HANDLER_EXT_RF24LOGPARALLELHANDLER_H_
+#define SRC_HANDLER_EXT_RF24LOGPARALLELHANDLER_H_
+
+#include "../RF24LogParts/Common.h" // RF24LOG_POSIX
+
+#if defined (RF24LOG_POSIX)
+#include <atomic>
+#include <condition_variable>
+#include <mutex>
+#include <thread>
+#include <vector>
+#include "../RF24LogParts/AbstractHandler.h"
+#include "../RF24LogParts/LineFormatter.h"
+#include "../RF24LogParts/Record.h"
+#include "../RF24LogParts/RecordQueue.h"
+#include "../RF24LogParts/Sink.h"
+
+/**
+ * @brief Module to extend the RF24LogBaseHandler mechanism for formatting log messages on
+ * several CPU cores.
+ *
+ * Logged messages are captured (like RF24LogIsrHandler does) into a ring of slots, and each
+ * slot's position is the message's sequence number. A pool of worker threads formats the
+ * captured messages (with the same formatting as the RF24LogLineFormatter loggers) into the
+ * slots' own buffers, so several messages are formatted at once. The formatted messages are
+ * then written to a RF24LogSink in the exact order in which they were captured: the worker
+ * that completes the oldest pending message writes it, and any following messages that are
+ * already formatted, to the sink.
+ *
+ * Producers never wait for the formatting. When the ring is full, a message is dropped (and
+ * counted), or, if the handler was constructed to block, the producer waits for a free slot.
+ * An @ref ERROR (or more severe) message also flushes the sink once it is written.
+ */
+class RF24LogParallelHandler : public RF24LogAbstractHandler
+{
+public:
+
+    /**
+     * @brief Instance constructor
+     * @param sink The sink that receives the formatted messages (in order)
+     * @param workers The number of worker threads (`0` for 1 per CPU core)
+     * @param slots The number of messages that can be pending (rounded down to a power of 2).
+     * The slots are allocated from the RF24LogMemory budget, so there can be fewer; if they are
+     * refused, the messages are dropped.
+     * @param block Make producers wait for a free slot instead of dropping messages
+     */
+    RF24LogParallelHandler(RF24LogSink *sink, unsigned workers = 0, uint32_t slots = 4096, bool block = false);
+
+    /** @brief writes the pending messages and stops the worker threads */
+    ~RF24LogParallelHandler();
+
+    /**
+     * @brief queue a captured message (if its level is enabled), keeping its capture timestamp.
+     * @param record The captured message
+     */
+    void logRecord(const RF24LogRecord *record);
+
+    /** @brief wait for the messages logged so far to be written, then flush the sink */
+    void flush();
+
+    /** @brief the number of worker threads */
+    inline unsigned workers() { return static_cast<unsigned>(_workers.size()); }
+
+    /** @brief the number of messages written to the sink */
+    uint64_t records() { return _records.load(std::memory_order_relaxed); }
+
+    /** @brief the number of messages dropped because the ring was full */
+    uint64_t dropped() { return _dropped.load(std::memory_order_relaxed); }
+
+protected:
+
+    void write(uint8_t logLevel,
+               const char *vendorId,
+               const char *message,
+               va_list *args);
+
+private:
+
+    /** @brief formats the captured messages (the output is done by the workers) */
+    class Formatter : public RF24LogLineFormatter
+    {
+    protected:
+        void writeLine(const char *, size_t, uint8_t) {}
+    };
+
+    /**
+     * @brief A pending message.
+     *
+     * The slot's state for the message at position `p` (see RF24LogRecordQueue) is `p` when it is
+     * free, `p + 1` when the message is captured and `p + 2` when it is formatted.
+     */
+    struct Slot : RF24LogRecordSlot
+    {
+        /** @brief The number of bytes of @ref text */
+        uint32_t length;
+        char text[RF24LOG_LINE_SIZE];
+    };
+
+    /** @brief reserve the slot of the next sequence number; nullptr if the ring is full */
+    Slot *claim();
+
+    /** @brief make a captured message visible to the workers */
+    void publish(Slot *slot);
+
+    /** @brief a worker thread */
+    void run();
+
+    /** @brief write the formatted messages that are next in sequence to the sink */
+    void emit();
+
+    RF24LogSink *_sink;
+    bool _block;
+    Slot *_slots;
+    /** @brief The ring of slots (workers take the positions in turn, in place of front() and pop()) */
+    RF24LogRecordQueue _queue;
+    Formatter _formatter;
+
+    /** @brief The next sequence number to format */
+    std::atomic<uint32_t> _formatNext;
+    /** @brief The next sequence number to write to the sink */
+    std::atomic<uint32_t> _emitNext;
+    /** @brief Set while a worker writes to the sink */
+    std::atomic<bool> _emitting;
+
+    std::vector<std::thread> _workers;
+    /** @brief The number of workers waiting for messages (producers only notify when it isn't 0) */
+    std::atomic<uint32_t> _sleepers;
+    std::mutex _mutex;
+    std::condition_variable _wakeup;
+    /** @brief Signals flush() when messages are written */
+    std::condition_variable _written;
+    /** @brief The number of threads waiting in flush() (workers only notify when it isn't 0) */
+    std::atomic<uint32_t> _flushers;
+    std::atomic<bool> _stopping;
+
+    std::atomic<uint64_t> _records;
+    std::atomic<uint64_t> _dropped;
+};
+
+#endif // defined (RF24LOG_POSIX)
+#endif /* SRC_HANDLER_EXT_RF24LOGPARALLELHANDLER_H_ */
@@ -0,0 +1,96 @@
+/**
+ * @file RF24LogRouterHandler.cpp
+ * @date Created 19 Oct 2026
+ * @author Brendan Doherty (2bndy5)
+ * @copyright Copyright (C) <br>
+ *     2026    Brendan Doherty (2bndy5) <br>
+ * This General Public License does not permit incorporating your program into
+ * proprietary programs.  If your program is a subroutine library, you may
+ * consider it more useful to permit linking proprietary applications with the
+ * library.  If this is what you want to do, use the GNU Lesser General
+ * Public License instead of this License.
+ */
+
+#include <string.h> // memset()
+#include "RF24LogRouterHandler.h"
+#include "../RF24LogParts/Record.h"
+#include "../RF24LogParts/Epoch.h"
+
+void RF24LogRouteTable::clear()
+{
+    memset(routes, RF24LOG_ROUTE_NONE, sizeof(routes));
+}
+
+void RF24LogRouteTable::set(uint8_t minLevel, uint8_t maxLevel, uint8_t route)
+{
+    for (uint16_t level = minLevel; level <= maxLevel; ++level)
+    {
+        routes[level] = route;
+    }
+}
+
+RF24LogRouterHandler::RF24LogRouterHandler(RF24LogBaseHandler *const *handlers,
+                                           uint8_t count,
+                                           const RF24LogRouteTable *table)
+    : _table(table)
+{
+    _count = count < RF24LOG_ROUTER_HANDLERS ? count : RF24LOG_ROUTER_HANDLERS;
+    for (uint8_t i = 0; i < _count; ++i)
+    {
+        _handlers[i] = handlers[i];
+    }
+}
+
+void RF24LogRouterHandler::setTable(const RF24LogRouteTable *table)
+{
+#if defined (RF24LOG_HOSTED)
+    _table.store(table, std::memory_order_release);
+    // retire the previous table only after in-flight log calls have finished with it
+    RF24LogEpoch::synchronize();
+#else
+    _table = table;
+#endif
+}
+
+void RF24LogRouterHandler::log(uint8_t logLevel,
+                               const char *vendorId,
+                               const char *message,
+                               va_list *args)
+{
+    RF24LogBaseHandler *handler = route(logLevel);
+    if (handler != nullptr)
+    {
+        handler->log(logLevel, vendorId, message, args);
+    }
+}
+
+void RF24LogRouterHandler::logRecord(const RF24LogRecord *record)
+{
+    RF24LogBaseHandler *handler = route(record->logLevel);
+    if (handler != nullptr)
+    {
+        handler->logRecord(record);
+    }
+}
+
+void RF24LogRouterHandler::setLogLevel(uint8_t logLevel)
+{
+    for (uint8_t i = 0; i < _count; ++i)
+    {
+        _handlers[i]->setLogLevel(logLevel);
+    }
+}
+
+#if defined (ARDUINO_ARCH_AVR)
+void RF24LogRouterHandler::log(uint8_t logLevel,
+                               const __FlashStringHelper *vendorId,
+                               const __FlashStringHelper *message,
+                               va_list *args)
+{
+    RF24LogBaseHandler *handler = route(logLevel);
+    if (handler != nullptr)
+    {
+        handler->log(logLevel, vendorId, message, args);
+    }
+}
+#endif
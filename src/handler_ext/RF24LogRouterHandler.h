@@ -0,0 +1,136 @@
+/**
+ * @file RF24LogRouterHandler.h
+ * @brief handler that routes each log message to 1 of several handlers by its level
+ * @date Created 19 Oct 2026
+ * @author Brendan Doherty (2bndy5)
+ * @copyright Copyright (C) <br>
+ *     2026    Brendan Doherty (2bndy5) <br>
+ * This General Public License does not permit incorporating your program into
+ * proprietary programs.  If your program is a subroutine library, you may
+ * consider it more useful to permit linking proprietary applications with the
+ * library.  If this is what you want to do, use the GNU Lesser General
+ * Public License instead of this License.
+ */
+
+#ifndef SRC_HANDLER_EXT_RF24LOGROUTERHANDLER_H_
+#define SRC_HANDLER_EXT_RF24LOGROUTERHANDLER_H_
+
+#include "../RF24LogBaseHandler.h"
+#include "../RF24LogParts/Common.h" // RF24LOG_HOSTED
+#if defined (RF24LOG_HOSTED)
+#include <atomic>
+#endif
+
+/** @brief The maximum number of handlers that a RF24LogRouterHandler routes to. */
+#if !defined(RF24LOG_ROUTER_HANDLERS)
+#define RF24LOG_ROUTER_HANDLERS 8
+#endif
+
+/** @brief The route of the levels whose messages are discarded. */
+#define RF24LOG_ROUTE_NONE 0xFF
+
+/**
+ * @brief A table of the handler (by its index) that receives the messages of each level.
+ *
+ * All levels are discarded (@ref RF24LOG_ROUTE_NONE) by a new table.
+ */
+struct RF24LogRouteTable
+{
+    /** @brief The route of each level (indexed by the raw level) */
+    uint8_t routes[256];
+
+    RF24LogRouteTable() { clear(); }
+
+    /** @brief discard the messages of all levels */
+    void clear();
+
+    /**
+     * @brief route a range of levels to a handler
+     * @param minLevel The first level of the range (like @ref RF24LogLevel::DEBUG + 1)
+     * @param maxLevel The last level of the range (inclusive)
+     * @param route The index of the handler, or @ref RF24LOG_ROUTE_NONE to discard the
+     * messages of these levels
+     */
+    void set(uint8_t minLevel, uint8_t maxLevel, uint8_t route);
+};
+
+/**
+ * @brief Module to extend the RF24LogBaseHandler mechanism for redirecting each log message
+ * to 1 of several RF24LogBaseHandler objects, chosen by the message's level.
+ *
+ * Unlike chaining RF24LogDualHandler objects, each message is only given to (and so only
+ * formatted by) the 1 handler that its level is routed to, and picking that handler takes 1
+ * lookup in a RF24LogRouteTable. The handlers still filter the messages by their own log
+ * levels (setLogLevel() sets the level of all of them).
+ *
+ * The route table can be replaced while other threads are logging: setTable() publishes a
+ * table that was completely built beforehand, so a message is routed either by the old
+ * table or by the new one. On hosted builds, setTable() waits for the log calls of
+ * @ref rf24Logging that may still use the old table (like RF24Logging::setHandler() does).
+ */
+class RF24LogRouterHandler : public RF24LogBaseHandler
+{
+public:
+
+    /**
+     * @brief Instance constructor
+     * @param handlers The handlers to route to (a route is an index of this array). The
+     * array is copied.
+     * @param count The number of @p handlers (at most @ref RF24LOG_ROUTER_HANDLERS)
+     * @param table The routes to use. It must remain valid while it is used.
+     */
+    RF24LogRouterHandler(RF24LogBaseHandler *const *handlers, uint8_t count, const RF24LogRouteTable *table);
+
+    /**
+     * @brief replace the route table.
+     *
+     * On hosted builds, the replaced table may be reused or destroyed once this returns: the
+     * log calls of @ref rf24Logging that were routing by it have finished. (The calling
+     * thread's own log call isn't waited on, nor is a router called by another handler's
+     * worker thread; keep the old table valid until that handler is flushed.) On other
+     * builds, the replaced table should remain valid (like when the tables are global or
+     * static objects).
+     * @param table The new routes. It must remain valid while it is used.
+     */
+    void setTable(const RF24LogRouteTable *table);
+
+    void log(uint8_t logLevel,
+             const char *vendorId,
+             const char *message,
+             va_list *args);
+
+    void logRecord(const RF24LogRecord *record);
+
+    void setLogLevel(uint8_t logLevel);
+
+#if defined (ARDUINO_ARCH_AVR)
+    void log(uint8_t logLevel,
+             const __FlashStringHelper *vendorId,
+             const __FlashStringHelper *message,
+             va_list *args);
+#endif
+
+private:
+
+    /** @brief the handler that receives the messages of a level (or nullptr) */
+    inline RF24LogBaseHandler *route(uint8_t logLevel)
+    {
+#if defined (RF24LOG_HOSTED)
+        uint8_t index = _table.load(std::memory_order_acquire)->routes[logLevel];
+#else
+        uint8_t index = _table->routes[logLevel];
+#endif
+        return index < _count ? _handlers[index] : nullptr;
+    }
+
+    RF24LogBaseHandler *_handlers[RF24LOG_ROUTER_HANDLERS];
+    uint8_t _count;
+
+#if defined (RF24LOG_HOSTED)
+    std::atomic<const RF24LogRouteTable *> _table;
+#else
+    const RF24LogRouteTable *volatile _table;
+#endif
+};
+
+#endif /* SRC_HANDLER_EXT_RF24LOGROUTERHANDLER_H_ */
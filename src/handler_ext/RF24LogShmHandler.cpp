@@ -0,0 +1,140 @@
+/**
+ * @file RF24LogShmHandler.cpp
+ * @date Created 19 Oct 2026
+ * @author Brendan Doherty (2bndy5)
+ * @copyright Copyright (C) <br>
+ *     2026    Brendan Doherty (2bndy5) <br>
+ * This General Public License does not permit incorporating your program into
+ * proprietary programs.  If your program is a subroutine library, you may
+ * consider it more useful to permit linking proprietary applications with the
+ * library.  If this is what you want to do, use the GNU Lesser General
+ * Public License instead of this License.
+ */
+
+#include "RF24LogShmHandler.h"
+
+#if defined (RF24LOG_POSIX)
+
+RF24LogShmHandler::RF24LogShmHandler(bool binary)
+{
+    this->binary = binary;
+}
+
+bool RF24LogShmHandler::open(const char *name, uint32_t slotCount, uint32_t slotSize)
+{
+    return ring.create(name, slotCount, slotSize);
+}
+
+void RF24LogShmHandler::close()
+{
+    ring.close();
+}
+
+uint64_t RF24LogShmHandler::dropped()
+{
+    return ring.isOpen() ? ring.dropped() : 0;
+}
+
+RF24LogShmRecord *RF24LogShmHandler::storeHeader(RF24LogShmSlot *slot,
+                                                 uint8_t logLevel,
+                                                 const char *vendorId,
+                                                 const char *message,
+                                                 RF24LogTime timestamp,
+                                                 uint8_t flags)
+{
+    size_t vendorLength = strlen(vendorId);
+    size_t messageLength = strlen(message);
+    if (sizeof(RF24LogShmRecord) + vendorLength + messageLength + 2 > ring.slotSize())
+    {
+        return nullptr;
+    }
+    RF24LogShmRecord *record = reinterpret_cast<RF24LogShmRecord *>(slot->data());
+    record->timestamp = timestamp;
+    record->logLevel = logLevel;
+    record->flags = flags;
+    record->vendorLength = (uint16_t)vendorLength;
+    record->messageLength = (uint16_t)messageLength;
+    memcpy((char *)record->vendorId(), vendorId, vendorLength + 1);
+    memcpy((char *)record->message(), message, messageLength + 1);
+    return record;
+}
+
+void RF24LogShmHandler::storeText(RF24LogShmSlot *slot,
+                                  uint8_t logLevel,
+                                  const char *vendorId,
+                                  const char *message,
+                                  RF24LogArgList *args,
+                                  RF24LogTime timestamp,
+                                  const RF24LogThread *thread)
+{
+    size_t length = format(slot->data(), ring.slotSize(), logLevel, vendorId, message, args, timestamp, thread);
+    ring.publish(slot, (uint16_t)length, RF24LOG_SHM_TEXT, logLevel);
+}
+
+void RF24LogShmHandler::write(uint8_t logLevel,
+                              const char *vendorId,
+                              const char *message,
+                              va_list *args)
+{
+    RF24LogShmSlot *slot = ring.isOpen() ? ring.claim() : nullptr;
+    if (slot == nullptr)
+    {
+        return;
+    }
+    RF24LogTime timestamp = rf24LogNow();
+    RF24LogShmRecord *record = binary ? storeHeader(slot, logLevel, vendorId, message, timestamp, 0) : nullptr;
+    if (record == nullptr)
+    {
+        RF24LogArgList argList(args);
+        storeText(slot, logLevel, vendorId, message, &argList, timestamp, nullptr);
+        return;
+    }
+    uint8_t *packed = (uint8_t *)record->args();
+    size_t room = ring.slotSize() - (size_t)((char *)packed - slot->data());
+    record->argsSize = RF24LogArgList::pack(packed, (uint16_t)room, message, args);
+    ring.publish(slot, (uint16_t)((char *)packed - slot->data() + record->argsSize), RF24LOG_SHM_BINARY, logLevel);
+}
+
+void RF24LogShmHandler::logRecord(const RF24LogRecord *record)
+{
+    if (!isLevelEnabled(record->logLevel) && !(record->flags & RF24LOG_RECORD_FORCED))
+    {
+        return;
+    }
+    RF24LogShmSlot *slot = ring.isOpen() ? ring.claim() : nullptr;
+    if (slot == nullptr)
+    {
+        return;
+    }
+    RF24LogShmRecord *stored = binary ? storeHeader(slot, record->logLevel, record->vendorId, record->message,
+                                                    record->timestamp, record->flags)
+                                      : nullptr;
+    uint8_t *packed = stored != nullptr ? (uint8_t *)stored->args() : nullptr;
+    if (stored == nullptr || (size_t)((char *)packed - slot->data()) + record->argsSize > ring.slotSize())
+    {
+        RF24LogArgList argList(record->args, record->argsSize);
+        storeText(slot, record->logLevel, record->vendorId, record->message, &argList, record->timestamp,
+                  &record->thread);
+        return;
+    }
+    stored->argsSize = record->argsSize;
+    memcpy(packed, record->args, record->argsSize);
+    ring.publish(slot, (uint16_t)((char *)packed - slot->data() + record->argsSize), RF24LOG_SHM_BINARY, record->logLevel);
+}
+
+void RF24LogShmHandler::writeLine(const char *data, size_t length, uint8_t logLevel)
+{
+    RF24LogShmSlot *slot = ring.isOpen() ? ring.claim() : nullptr;
+    if (slot == nullptr)
+    {
+        return;
+    }
+    if (length > ring.slotSize())
+    {
+        length = ring.slotSize();
+    }
+    memcpy(slot->data(), data, length);
+    ring.publish(slot, (uint16_t)length, RF24LOG_SHM_TEXT, logLevel);
+}
+
+#endif // defined (RF24LOG_POSIX)
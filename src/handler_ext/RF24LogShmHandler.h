@@ -0,0 +1,108 @@
+/**
+ * @file RF24LogShmHandler.h
+ * @brief handler extention to pass log messages to another process through shared memory
+ * @date Created 19 Oct 2026
+ * @author Brendan Doherty (2bndy5)
+ * @copyright Copyright (C) <br>
+ *     2026    Brendan Doherty (2bndy5) <br>
+ * This General Public License does not permit incorporating your program into
+ * proprietary programs.  If your program is a subroutine library, you may
+ * consider it more useful to permit linking proprietary applications with the
+ * library.  If this is what you want to do, use the GNU Lesser General
+ * Public License instead of this License.
+ */
+
+#ifndef SRC_HANDLER_EXT_RF24LOGSHMHANDLER_H_
+#define SRC_HANDLER_EXT_RF24LOGSHMHANDLER_H_
+
+#include "../RF24LogParts/Common.h" // RF24LOG_POSIX
+
+#if defined (RF24LOG_POSIX)
+#include "../RF24LogParts/LineFormatter.h"
+#include "../RF24LogParts/ShmRing.h"
+
+/**
+ * @brief Module to extend the RF24LogBaseHandler mechanism for logging through a
+ * RF24LogShmRing in POSIX shared memory.
+ *
+ * Logging only copies the message into the shared memory (without system calls, locks or
+ * memory allocation). A separate process (like the `rf24log-shmd` tool) formats and
+ * outputs the records, and can still read them after this process crashed.
+ *
+ * In binary form (the default), the vendorId, message and arguments are copied and the
+ * reader formats them. In text form, the message is formatted into the shared memory.
+ * Messages whose vendorId and message don't fit a slot are stored as (truncated) text.
+ */
+class RF24LogShmHandler : public RF24LogLineFormatter
+{
+private:
+    /** @brief The shared memory */
+    RF24LogShmRing ring;
+    /** @brief Are the messages stored in binary form? */
+    bool binary;
+
+public:
+
+    /**
+     * @brief Instance constructor
+     * @param binary Store messages in binary form (true) or as formatted text (false)
+     */
+    RF24LogShmHandler(bool binary = true);
+
+    /**
+     * @brief open (or create) the shared memory.
+     *
+     * Messages are dropped until this succeeds. Only 1 process can write to a ring.
+     * @param name The POSIX shared memory object's name (like `"/rf24log"`)
+     * @param slotCount The number of records the ring can hold (rounded down to a power of 2)
+     * @param slotSize The maximum number of bytes per record
+     * @return true if the shared memory is ready to use
+     */
+    bool open(const char *name, uint32_t slotCount = 4096, uint32_t slotSize = 256);
+
+    /** @brief stop logging to the shared memory (unread records stay readable) */
+    void close();
+
+    /** @brief the number of messages dropped because the ring was full */
+    uint64_t dropped();
+
+    /**
+     * @brief store a captured message (if its level is enabled) with its capture timestamp.
+     * @param record The captured message
+     */
+    void logRecord(const RF24LogRecord *record);
+
+protected:
+
+    void write(uint8_t logLevel,
+               const char *vendorId,
+               const char *message,
+               va_list *args);
+
+    void writeLine(const char *data, size_t length, uint8_t logLevel);
+
+private:
+
+    /**
+     * @brief fill the start of a binary record (all but the arguments) in a claimed slot
+     * @return The record, or nullptr if the vendorId and message don't fit in the slot.
+     */
+    RF24LogShmRecord *storeHeader(RF24LogShmSlot *slot,
+                                  uint8_t logLevel,
+                                  const char *vendorId,
+                                  const char *message,
+                                  RF24LogTime timestamp,
+                                  uint8_t flags);
+
+    /** @brief format a message as text in a claimed slot and publish it */
+    void storeText(RF24LogShmSlot *slot,
+                   uint8_t logLevel,
+                   const char *vendorId,
+                   const char *message,
+                   RF24LogArgList *args,
+                   RF24LogTime timestamp,
+                   const RF24LogThread *thread);
+};
+
+#endif // defined (RF24LOG_POSIX)
+#endif /* SRC_HANDLER_EXT_RF24LOGSHMHANDLER_H_ */
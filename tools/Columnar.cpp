@@ -0,0 +1,340 @@
+/**
+ * @file Columnar.cpp
+ * @brief rf24log-columnar: converts logs to a columnar log archive and aggregates over archives
+ * @date Created 19 Oct 2026
+ * @author Brendan Doherty (2bndy5)
+ * @copyright Copyright (C) <br>
+ *     2026    Brendan Doherty (2bndy5) <br>
+ * This General Public License does not permit incorporating your program into
+ * proprietary programs.  If your program is a subroutine library, you may
+ * consider it more useful to permit linking proprietary applications with the
+ * library.  If this is what you want to do, use the GNU Lesser General
+ * Public License instead of this License.
+ *
+ * usage: rf24log-columnar -o ARCHIVE [-r ROWS] FILE...
+ *   -o ARCHIVE  convert the logs to a new columnar log archive
+ *   -r ROWS     the number of rows per segment (default: 65536)
+ *   FILE        the logs: indexed log files (written by RF24LogIndexedHandler), or text
+ *               written by the lib's loggers (`-` for stdin; compressed logs can be piped
+ *               from rf24log-unlz)
+ *
+ * usage: rf24log-columnar [-g FIELDS] [-i SECONDS] [-l LEVELS] [-v VENDOR] [-f FROM] [-t TO] ARCHIVE
+ *   -g FIELDS   count the rows per `level`, `vendor` and/or `format` (comma separated)
+ *   -i SECONDS  count the rows per period of SECONDS (60 counts per minute)
+ *   -l LEVELS   only the rows of these levels (see rf24log-query)
+ *   -v VENDOR   only the rows of this vendorId
+ *   -f FROM     only the rows logged at or after this local time (`2026-10-19 10:07[:SS]`)
+ *   -t TO       only the rows logged at or before this local time
+ *
+ * usage: rf24log-columnar -d ARCHIVE
+ *   -d          print the rows of an archive as text
+ *
+ * The message of a line of text becomes a format string: its whole numbers become `%d`
+ * specifiers whose values are stored in the argument column, so the lines that only differ
+ * by their numbers share a format string (and `-g format` counts them together).
+ */
+
+#include <cctype>   // isalnum()
+#include <climits>  // INT_MAX
+#include <cstdio>   // fopen(), fread(), getline(), printf(), fprintf()
+#include <cstdlib>  // strtoul(), free()
+#include <cstring>  // memcpy(), memcmp(), strcmp(), strtok()
+#include <ctime>    // localtime_r(), strftime()
+#include <string>
+#include <unistd.h> // getopt()
+#include <vector>
+#include "RF24LogParts/ArgList.h"
+#include "RF24LogParts/ColumnarLog.h"
+#include "RF24LogParts/IndexedLog.h"
+#include "RF24LogParts/LineFormatter.h"
+#include "TextLog.h"
+
+/** @brief the maximum number of bytes of arguments taken from a line of text */
+#define COLUMNAR_TEXT_ARGS_SIZE 256
+
+/** @brief formats the rows of an archive (the output is done by the tool) */
+class ColumnarFormatter : public RF24LogLineFormatter
+{
+protected:
+    void writeLine(const char *, size_t, uint8_t) {}
+};
+
+/**
+ * @brief turn a message of text into a format string and packed arguments: the whole
+ * numbers (not part of a word, without leading zeros) become `%d` specifiers
+ */
+static void templateMessage(const char *message, size_t length, std::string *format, uint8_t *args, uint16_t *argsSize)
+{
+    format->clear();
+    *argsSize = 0;
+    size_t i = 0;
+    while (i < length)
+    {
+        char c = message[i];
+        bool wordBefore = i > 0 && (isalnum(static_cast<unsigned char>(message[i - 1])) || message[i - 1] == '_');
+        if (c >= '0' && c <= '9' && !wordBefore)
+        {
+            size_t end = i;
+            long long value = 0;
+            while (end < length && message[end] >= '0' && message[end] <= '9' && value <= INT_MAX)
+            {
+                value = value * 10 + (message[end++] - '0');
+            }
+            bool wordAfter = end < length && (isalnum(static_cast<unsigned char>(message[end])) || message[end] == '_');
+            if (!wordAfter && value <= INT_MAX && (c != '0' || end == i + 1)
+                && *argsSize + sizeof(int) <= COLUMNAR_TEXT_ARGS_SIZE)
+            {
+                int number = static_cast<int>(value);
+                memcpy(args + *argsSize, &number, sizeof(number));
+                *argsSize = static_cast<uint16_t>(*argsSize + sizeof(number));
+                format->append("%d");
+                i = end;
+                continue;
+            }
+            format->append(message + i, end - i);
+            i = end;
+            continue;
+        }
+        if (c == '%')
+        {
+            format->push_back('%');
+        }
+        format->push_back(c);
+        ++i;
+    }
+}
+
+/** @brief add an indexed log file to the archive */
+static bool convertIndexed(const char *name, RF24LogColumnarWriter *writer)
+{
+    RF24LogIndexedReader reader;
+    if (!reader.open(name))
+    {
+        return false;
+    }
+    RF24LogIndexedMessage message;
+    while (reader.next(&message))
+    {
+        if (!writer->add(message.timestamp, message.logLevel, message.vendorId, message.message,
+                         message.args, message.argsSize))
+        {
+            return false;
+        }
+    }
+    return true;
+}
+
+/** @brief add a text log to the archive */
+static bool convertText(FILE *in, RF24LogColumnarWriter *writer)
+{
+    char *line = nullptr;
+    size_t capacity = 0;
+    ssize_t length;
+    std::string vendorId;
+    std::string format;
+    uint8_t args[COLUMNAR_TEXT_ARGS_SIZE];
+    uint16_t argsSize;
+    RF24LogTime timestamp = 0;
+    bool result = true;
+    while (result && (length = getline(&line, &capacity, in)) > 0)
+    {
+        if (line[length - 1] == '\n')
+        {
+            --length;
+        }
+        TextLogLine parsed;
+        parseTextLine(line, static_cast<size_t>(length), &parsed);
+        if (parsed.timed)
+        {
+            timestamp = textTime(line);
+        }
+        vendorId.assign(parsed.vendorId, parsed.vendorLength);
+        templateMessage(parsed.message, parsed.messageLength, &format, args, &argsSize);
+        result = writer->add(timestamp, parsed.logLevel, vendorId.c_str(), format.c_str(), args, argsSize);
+    }
+    free(line);
+    return result;
+}
+
+/** @brief print the rows of an archive as text */
+static bool dump(const RF24LogColumnarArchive &archive)
+{
+    ColumnarFormatter formatter;
+    std::vector<RF24LogColumnarRow> rows;
+    char buffer[RF24LOG_LINE_SIZE];
+    for (size_t segment = 0; segment < archive.segmentCount(); ++segment)
+    {
+        if (!archive.readSegment(segment, &rows))
+        {
+            return false;
+        }
+        for (const RF24LogColumnarRow &row : rows)
+        {
+            RF24LogArgList args(row.args, row.argsSize);
+            size_t length = formatter.format(buffer, sizeof(buffer), row.logLevel, archive.vendor(row.vendor),
+                                             archive.format(row.format), &args, row.timestamp);
+            fwrite(buffer, 1, length, stdout);
+        }
+    }
+    return true;
+}
+
+/** @brief print the result of an aggregation (1 tab separated line per group) */
+static void printCounts(const RF24LogColumnarArchive &archive, const RF24LogColumnarQuery &query,
+                        const std::vector<RF24LogColumnarCount> &counts)
+{
+    for (const RF24LogColumnarCount &count : counts)
+    {
+        if (query.interval)
+        {
+            char text[32];
+            time_t seconds = static_cast<time_t>(count.time / 1000000);
+            struct tm local;
+            localtime_r(&seconds, &local);
+            strftime(text, sizeof(text), "%F:%H:%M:%S", &local);
+            printf("%s\t", text);
+        }
+        if (query.groupBy & RF24LOG_GROUP_LEVEL)
+        {
+            printf("%03o\t", count.logLevel);
+        }
+        if (query.groupBy & RF24LOG_GROUP_VENDOR)
+        {
+            printf("%s\t", archive.vendor(count.vendor));
+        }
+        if (query.groupBy & RF24LOG_GROUP_FORMAT)
+        {
+            printf("%s\t", archive.format(count.format));
+        }
+        printf("%llu\n", static_cast<unsigned long long>(count.count));
+    }
+}
+
+/** @brief parse the fields to group by */
+static bool parseGroups(char *text, uint8_t *groupBy)
+{
+    for (char *field = strtok(text, ","); field != nullptr; field = strtok(nullptr, ","))
+    {
+        if (strcmp(field, "level") == 0)
+        {
+            *groupBy |= RF24LOG_GROUP_LEVEL;
+        }
+        else if (strcmp(field, "vendor") == 0)
+        {
+            *groupBy |= RF24LOG_GROUP_VENDOR;
+        }
+        else if (strcmp(field, "format") == 0)
+        {
+            *groupBy |= RF24LOG_GROUP_FORMAT;
+        }
+        else
+        {
+            return false;
+        }
+    }
+    return true;
+}
+
+int main(int argc, char **argv)
+{
+    const char *outName = nullptr;
+    uint32_t segmentRows = 65536;
+    bool dumpRows = false;
+    RF24LogColumnarQuery query;
+    const char *vendorId = nullptr;
+    char ignored[32];
+    bool usage = false;
+    int option;
+    while ((option = getopt(argc, argv, "o:r:dg:i:l:v:f:t:")) != -1)
+    {
+        switch (option)
+        {
+            case 'o': outName = optarg; break;
+            case 'r': segmentRows = static_cast<uint32_t>(strtoul(optarg, nullptr, 0)); break;
+            case 'd': dumpRows = true; break;
+            case 'g': usage |= !parseGroups(optarg, &query.groupBy); break;
+            case 'i': query.interval = strtoul(optarg, nullptr, 0) * 1000000UL; break;
+            case 'l': usage |= !parseLevelRange(optarg, &query.minLevel, &query.maxLevel); break;
+            case 'v': vendorId = optarg; break;
+            case 'f': usage |= !parseTime(optarg, false, ignored, &query.from); break;
+            case 't': usage |= !parseTime(optarg, true, ignored, &query.to); break;
+            default: usage = true; break;
+        }
+    }
+    if (usage || optind == argc || (outName == nullptr && optind + 1 != argc))
+    {
+        fprintf(stderr, "usage: %s -o ARCHIVE [-r ROWS] FILE...\n"
+                        "       %s [-g FIELDS] [-i SECONDS] [-l LEVELS] [-v VENDOR] [-f FROM] [-t TO] ARCHIVE\n"
+                        "       %s -d ARCHIVE\n", argv[0], argv[0], argv[0]);
+        return 2;
+    }
+
+    if (outName != nullptr)
+    {
+        RF24LogColumnarWriter writer(segmentRows);
+        if (!writer.open(outName))
+        {
+            perror(outName);
+            return 1;
+        }
+        for (int i = optind; i < argc; ++i)
+        {
+            bool converted;
+            if (strcmp(argv[i], "-") == 0)
+            {
+                converted = convertText(stdin, &writer);
+            }
+            else
+            {
+                FILE *in = fopen(argv[i], "r");
+                if (in == nullptr)
+                {
+                    perror(argv[i]);
+                    return 1;
+                }
+                char magic[sizeof(RF24LOG_INDEXED_MAGIC)];
+                bool indexed = fread(magic, 1, sizeof(magic), in) == sizeof(magic)
+                               && memcmp(magic, RF24LOG_INDEXED_MAGIC, sizeof(magic)) == 0;
+                rewind(in);
+                converted = indexed ? convertIndexed(argv[i], &writer) : convertText(in, &writer);
+                fclose(in);
+            }
+            if (!converted)
+            {
+                fprintf(stderr, "%s: could not convert %s\n", outName, argv[i]);
+                return 1;
+            }
+        }
+        uint64_t rows = writer.rows();
+        if (!writer.close())
+        {
+            fprintf(stderr, "%s: could not write the archive\n", outName);
+            return 1;
+        }
+        fprintf(stderr, "%s: %llu rows\n", outName, static_cast<unsigned long long>(rows));
+        return 0;
+    }
+
+    RF24LogColumnarArchive archive;
+    if (!archive.open(argv[optind]))
+    {
+        fprintf(stderr, "%s: not a columnar log archive\n", argv[optind]);
+        return 1;
+    }
+    if (dumpRows)
+    {
+        return dump(archive) ? 0 : 1;
+    }
+    if (vendorId != nullptr && (query.vendor = archive.findVendor(vendorId)) < 0)
+    {
+        return 0; // no rows of that vendorId
+    }
+    std::vector<RF24LogColumnarCount> counts;
+    if (!archive.aggregate(query, &counts))
+    {
+        fprintf(stderr, "%s: the archive is corrupt\n", argv[optind]);
+        return 1;
+    }
+    printCounts(archive, query, counts);
+    return 0;
+}
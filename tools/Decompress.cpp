@@ -0,0 +1,135 @@
+/**
+ * @file Decompress.cpp
+ * @brief rf24log-unlz: turns the output of RF24LogCompressSink back into text
+ * @date Created 19 Oct 2026
+ * @author Brendan Doherty (2bndy5)
+ * @copyright Copyright (C) <br>
+ *     2026    Brendan Doherty (2bndy5) <br>
+ * This General Public License does not permit incorporating your program into
+ * proprietary programs.  If your program is a subroutine library, you may
+ * consider it more useful to permit linking proprietary applications with the
+ * library.  If this is what you want to do, use the GNU Lesser General
+ * Public License instead of this License.
+ *
+ * usage: rf24log-unlz [-o FILE] [FILE...]
+ *   -o FILE   write the text to FILE (default: stdout)
+ *   FILE      the compressed logs (default: stdin)
+ */
+
+#include <cstdio>   // fopen(), fread(), fwrite(), fprintf()
+#include <unistd.h> // getopt()
+#include <vector>
+#include "RF24LogParts/Lz.h"
+
+/** @brief read a little-endian word */
+static uint32_t getWord(const unsigned char *input)
+{
+    return static_cast<uint32_t>(input[0]) | static_cast<uint32_t>(input[1]) << 8
+           | static_cast<uint32_t>(input[2]) << 16 | static_cast<uint32_t>(input[3]) << 24;
+}
+
+/** @brief decompress 1 stream (or several appended streams); returns false if it is corrupt or truncated */
+static bool decompress(FILE *in, const char *name, FILE *out)
+{
+    std::vector<char> compressed;
+    std::vector<char> text(RF24LOG_LZ_MAX_BLOCK);
+    unsigned char header[RF24LOG_LZ_BLOCK_HEADER];
+    unsigned long long blocks = 0;
+    size_t got;
+    while ((got = fread(header, 1, sizeof(header), in)) == sizeof(header))
+    {
+        uint32_t rawSize = getWord(header);
+        uint32_t size = getWord(header + 4);
+        if (rawSize == RF24LOG_LZ_MAGIC)
+        {
+            if (size != RF24LOG_LZ_VERSION)
+            {
+                fprintf(stderr, "%s: unsupported version %u\n", name, size);
+                return false;
+            }
+            continue; // the start of a (possibly appended) stream
+        }
+        bool stored = rawSize & RF24LOG_LZ_STORED;
+        rawSize &= ~static_cast<uint32_t>(RF24LOG_LZ_STORED);
+        if (rawSize > RF24LOG_LZ_MAX_BLOCK || size > RF24LogLz::bound(RF24LOG_LZ_MAX_BLOCK))
+        {
+            fprintf(stderr, "%s: corrupt block header after %llu blocks\n", name, blocks);
+            return false;
+        }
+        compressed.resize(size);
+        if (fread(compressed.data(), 1, size, in) != size)
+        {
+            fprintf(stderr, "%s: the last block is truncated (after %llu blocks)\n", name, blocks);
+            return false;
+        }
+        if (stored)
+        {
+            fwrite(compressed.data(), 1, size, out);
+        }
+        else
+        {
+            long length = RF24LogLz::decompress(compressed.data(), size, text.data(), rawSize);
+            if (length != static_cast<long>(rawSize))
+            {
+                fprintf(stderr, "%s: corrupt block after %llu blocks\n", name, blocks);
+                return false;
+            }
+            fwrite(text.data(), 1, rawSize, out);
+        }
+        ++blocks;
+    }
+    if (got)
+    {
+        fprintf(stderr, "%s: the last block header is truncated (after %llu blocks)\n", name, blocks);
+        return false;
+    }
+    return true;
+}
+
+int main(int argc, char **argv)
+{
+    const char *outName = nullptr;
+    int option;
+    while ((option = getopt(argc, argv, "o:")) != -1)
+    {
+        switch (option)
+        {
+            case 'o': outName = optarg; break;
+            default:
+                fprintf(stderr, "usage: %s [-o FILE] [FILE...]\n", argv[0]);
+                return 2;
+        }
+    }
+
+    FILE *out = outName != nullptr ? fopen(outName, "w") : stdout;
+    if (out == nullptr)
+    {
+        perror(outName);
+        return 1;
+    }
+    int result = 0;
+    if (optind == argc)
+    {
+        result = decompress(stdin, "stdin", out) ? 0 : 1;
+    }
+    for (int i = optind; i < argc; ++i)
+    {
+        FILE *in = fopen(argv[i], "rb");
+        if (in == nullptr)
+        {
+            perror(argv[i]);
+            result = 1;
+            continue;
+        }
+        if (!decompress(in, argv[i], out))
+        {
+            result = 1;
+        }
+        fclose(in);
+    }
+    if (out != stdout)
+    {
+        fclose(out);
+    }
+    return result;
+}
@@ -0,0 +1,521 @@
+/**
+ * @file Query.cpp
+ * @brief rf24log-query: decodes & filters RF24Log output on all the CPU cores
+ * @date Created 19 Oct 2026
+ * @author Brendan Doherty (2bndy5)
+ * @copyright Copyright (C) <br>
+ *     2026    Brendan Doherty (2bndy5) <br>
+ * This General Public License does not permit incorporating your program into
+ * proprietary programs.  If your program is a subroutine library, you may
+ * consider it more useful to permit linking proprietary applications with the
+ * library.  If this is what you want to do, use the GNU Lesser General
+ * Public License instead of this License.
+ *
+ * usage: rf24log-query [-l LEVELS] [-v VENDOR] [-f FROM] [-t TO] [-s TEXT] [-j THREADS] [-c] [-o FILE] FILE...
+ *   -l LEVELS   only the messages of these levels: a level (`WARN` is WARN and its sub-levels,
+ *               `WARN+2` or `022` is only that level) or a range (`ERROR-WARN`, `-WARN`, `INFO-`)
+ *   -v VENDOR   only the messages of this vendorId
+ *   -f FROM     only the messages logged at or after this local time (`2026-10-19 10:07[:SS]`)
+ *   -t TO       only the messages logged at or before this local time
+ *   -s TEXT     only the messages that contain TEXT (in their formatted lines)
+ *   -j THREADS  the number of worker threads (default: 1 per CPU core)
+ *   -c          only print the number of matching lines
+ *   -o FILE     write the matching lines to FILE (default: stdout)
+ *   FILE        the logs: text written by the lib's loggers, indexed log files (written by
+ *               RF24LogIndexedHandler) or compressed logs (written by RF24LogCompressSink)
+ *
+ * Each file is mapped in memory and split into chunks at record boundaries (lines of text,
+ * blocks of the binary formats). The chunks are filtered by worker threads, and the results
+ * are written in the order of the file.
+ */
+
+#include <condition_variable>
+#include <cstdio>     // fopen(), fwrite(), fprintf()
+#include <cstdlib>    // strtoul()
+#include <cstring>    // memchr(), memrchr(), memcmp(), memmem()
+#include <fcntl.h>    // open()
+#include <mutex>
+#include <string>
+#include <sys/mman.h> // mmap(), munmap(), madvise()
+#include <sys/stat.h> // fstat()
+#include <thread>
+#include <unistd.h>   // getopt(), close()
+#include <vector>
+#include "RF24LogParts/ArgList.h"
+#include "RF24LogParts/IndexedLog.h"
+#include "RF24LogParts/LineFormatter.h"
+#include "RF24LogParts/Lz.h"
+#include "TextLog.h"
+
+/** @brief the nominal size of a chunk of text */
+#define QUERY_TEXT_CHUNK (4UL << 20)
+
+/** @brief formats the records of indexed log files (the output is done by the tool) */
+class QueryFormatter : public RF24LogLineFormatter
+{
+protected:
+    void writeLine(const char *, size_t, uint8_t) {}
+};
+
+/** @brief what to look for */
+struct Filter
+{
+    bool levels = false;
+    uint8_t minLevel = 0;
+    uint8_t maxLevel = 0xFF;
+    const char *vendor = nullptr;
+    size_t vendorLength = 0;
+    bool window = false;
+    /** @brief The time window as the text loggers print it (which sorts like the times) */
+    char fromText[32] = "0000-00-00:00:00:00";
+    char toText[32] = "9999-99-99:99:99:99";
+    /** @brief The time window as timestamps (see rf24LogNow()) */
+    RF24LogTime from = 0;
+    RF24LogTime to = static_cast<RF24LogTime>(-1);
+    const char *text = nullptr;
+    size_t textLength = 0;
+    bool countOnly = false;
+};
+
+/** @brief the result of filtering a chunk */
+struct Chunk
+{
+    /** @brief The matching lines */
+    std::string output;
+    uint64_t matches = 0;
+    /** @brief (compressed logs) The text up to the block's first line break (the end of the previous block's last line) */
+    std::string head;
+    /** @brief (compressed logs) The text after the block's last line break (the start of the next block's first line) */
+    std::string tail;
+    /** @brief (compressed logs) Does @ref head end with a line break? */
+    bool complete = false;
+    /** @brief An error to report (the chunk is corrupt) */
+    const char *error = nullptr;
+};
+
+/**
+ * @brief filter chunks 0 to @p count - 1 on @p threads worker threads and hand them to
+ * @p emit in order. At most 4 chunks per thread are held in memory.
+ */
+template <typename Work, typename Emit>
+static void runOrdered(size_t count, unsigned threads, Work work, Emit emit)
+{
+    std::vector<Chunk> chunks(count);
+    std::vector<char> done(count, 0);
+    std::mutex mutex;
+    std::condition_variable changed;
+    size_t next = 0;
+    size_t emitted = 0;
+    const size_t window = static_cast<size_t>(threads) * 4;
+
+    std::vector<std::thread> workers;
+    for (unsigned i = 0; i < threads && i < count; ++i)
+    {
+        workers.emplace_back([&]() {
+            while (true)
+            {
+                size_t index;
+                {
+                    std::unique_lock<std::mutex> lock(mutex);
+                    changed.wait(lock, [&]() { return next >= count || next < emitted + window; });
+                    if (next >= count)
+                    {
+                        return;
+                    }
+                    index = next++;
+                }
+                work(index, &chunks[index]);
+                {
+                    std::lock_guard<std::mutex> lock(mutex);
+                    done[index] = 1;
+                }
+                changed.notify_all();
+            }
+        });
+    }
+    while (emitted < count)
+    {
+        {
+            std::unique_lock<std::mutex> lock(mutex);
+            changed.wait(lock, [&]() { return done[emitted] != 0; });
+        }
+        emit(&chunks[emitted]);
+        Chunk().output.swap(chunks[emitted].output); // free the memory
+        {
+            std::lock_guard<std::mutex> lock(mutex);
+            ++emitted;
+        }
+        changed.notify_all();
+    }
+    for (std::thread &worker : workers)
+    {
+        worker.join();
+    }
+}
+
+/** @brief does a line of text (without its line break) match the filter? */
+static bool matchLine(const char *line, size_t length, const Filter &filter)
+{
+    TextLogLine parsed;
+    parseTextLine(line, length, &parsed);
+    if (filter.window
+        && (!parsed.timed || memcmp(line, filter.fromText, 19) < 0 || memcmp(line, filter.toText, 19) > 0))
+    {
+        return false;
+    }
+    if (filter.levels && (parsed.logLevel < filter.minLevel || parsed.logLevel > filter.maxLevel))
+    {
+        return false;
+    }
+    if (filter.vendor != nullptr
+        && (parsed.vendorLength != filter.vendorLength || memcmp(parsed.vendorId, filter.vendor, filter.vendorLength) != 0))
+    {
+        return false;
+    }
+    return filter.text == nullptr || memmem(line, length, filter.text, filter.textLength) != nullptr;
+}
+
+/** @brief filter the lines from @p begin to @p end (the last one may lack its line break) */
+static void filterLines(const char *begin, const char *end, const Filter &filter, Chunk *chunk)
+{
+    while (begin < end)
+    {
+        const char *lineBreak = static_cast<const char *>(memchr(begin, '\n', static_cast<size_t>(end - begin)));
+        const char *lineEnd = lineBreak != nullptr ? lineBreak : end;
+        if (matchLine(begin, static_cast<size_t>(lineEnd - begin), filter))
+        {
+            ++chunk->matches;
+            if (!filter.countOnly)
+            {
+                chunk->output.append(begin, lineEnd);
+                chunk->output.push_back('\n');
+            }
+        }
+        begin = lineEnd + 1;
+    }
+}
+
+/** @brief read a little-endian word */
+static uint32_t getWord(const char *input)
+{
+    const unsigned char *bytes = reinterpret_cast<const unsigned char *>(input);
+    return static_cast<uint32_t>(bytes[0]) | static_cast<uint32_t>(bytes[1]) << 8
+           | static_cast<uint32_t>(bytes[2]) << 16 | static_cast<uint32_t>(bytes[3]) << 24;
+}
+
+/** @brief the output of a query */
+struct Output
+{
+    FILE *out;
+    uint64_t matches;
+    bool failed;
+
+    void emit(const char *name, Chunk *chunk)
+    {
+        matches += chunk->matches;
+        fwrite(chunk->output.data(), 1, chunk->output.size(), out);
+        if (chunk->error != nullptr && !failed)
+        {
+            fprintf(stderr, "%s: %s\n", name, chunk->error);
+            failed = true;
+        }
+    }
+};
+
+/** @brief query a text log; the chunks end at line breaks */
+static void queryText(const char *data, size_t size, const Filter &filter, unsigned threads, Output *output, const char *name)
+{
+    std::vector<size_t> starts(1, 0);
+    for (size_t offset = QUERY_TEXT_CHUNK; offset < size; offset = starts.back() + QUERY_TEXT_CHUNK)
+    {
+        const void *lineBreak = memchr(data + offset, '\n', size - offset);
+        if (lineBreak == nullptr)
+        {
+            break;
+        }
+        starts.push_back(static_cast<size_t>(static_cast<const char *>(lineBreak) - data) + 1);
+    }
+    starts.push_back(size);
+    runOrdered(starts.size() - 1, threads,
+        [&](size_t i, Chunk *chunk) { filterLines(data + starts[i], data + starts[i + 1], filter, chunk); },
+        [&](Chunk *chunk) { output->emit(name, chunk); });
+}
+
+/** @brief query an indexed log file; the chunks are the blocks that the index can't rule out */
+static void queryIndexed(int fd, const char *data, const Filter &filter, unsigned threads, Output *output, const char *name)
+{
+    std::vector<RF24LogIndexedIndexEntry> index;
+    uint64_t end;
+    if (!RF24LogIndexedReader::readIndex(fd, &index, &end))
+    {
+        fprintf(stderr, "%s: unsupported indexed log file\n", name);
+        output->failed = true;
+        return;
+    }
+    uint32_t levels = RF24LogIndexedBlockInfo::levelMask(filter.minLevel, filter.maxLevel);
+    uint64_t vendorHash = filter.vendor != nullptr ? RF24LogIndexedBlockInfo::hashVendor(filter.vendor, filter.vendorLength) : 0;
+    std::vector<const RF24LogIndexedIndexEntry *> blocks;
+    for (const RF24LogIndexedIndexEntry &entry : index)
+    {
+        if (entry.info.overlaps(filter.from, filter.to)
+            && entry.info.hasLevels(levels)
+            && (filter.vendor == nullptr || entry.info.mayHaveVendor(vendorHash)))
+        {
+            blocks.push_back(&entry);
+        }
+    }
+
+    QueryFormatter formatter;
+    runOrdered(blocks.size(), threads,
+        [&](size_t i, Chunk *chunk) {
+            RF24LogIndexedBlockHeader header;
+            memcpy(&header, data + blocks[i]->offset, sizeof(header));
+            if (header.magic != RF24LOG_INDEXED_BLOCK_MAGIC || blocks[i]->offset + sizeof(header) + header.dataSize > end)
+            {
+                chunk->error = "corrupt block (skipped)";
+                return;
+            }
+            const char *records = data + blocks[i]->offset + sizeof(header);
+            size_t position = 0;
+            RF24LogIndexedMessage message;
+            char buffer[RF24LOG_LINE_SIZE];
+            while (RF24LogIndexedReader::parseRecord(records, header.dataSize, &position, &message))
+            {
+                if (message.timestamp < filter.from || message.timestamp > filter.to
+                    || message.logLevel < filter.minLevel || message.logLevel > filter.maxLevel
+                    || (filter.vendor != nullptr
+                        && (strlen(message.vendorId) != filter.vendorLength
+                            || memcmp(message.vendorId, filter.vendor, filter.vendorLength) != 0)))
+                {
+                    continue;
+                }
+                RF24LogArgList args(message.args, message.argsSize);
+                size_t length = formatter.format(buffer, sizeof(buffer), message.logLevel, message.vendorId,
+                                                 message.message, &args, message.timestamp);
+                if (filter.text == nullptr || memmem(buffer, length, filter.text, filter.textLength) != nullptr)
+                {
+                    ++chunk->matches;
+                    if (!filter.countOnly)
+                    {
+                        chunk->output.append(buffer, length);
+                    }
+                }
+            }
+        },
+        [&](Chunk *chunk) { output->emit(name, chunk); });
+}
+
+/** @brief a block of a compressed log */
+struct LzBlock
+{
+    size_t offset;
+    uint32_t rawSize;
+    uint32_t size;
+    bool stored;
+};
+
+/**
+ * @brief query a compressed log; the chunks are its blocks, which are decompressed in parallel.
+ *
+ * A line can span blocks, so the lines that start & end in a block are filtered by the worker
+ * and the line that crosses each block boundary is put together & filtered in order.
+ */
+static void queryCompressed(const char *data, size_t size, const Filter &filter, unsigned threads, Output *output, const char *name)
+{
+    std::vector<LzBlock> blocks;
+    size_t offset = 0;
+    const char *error = nullptr;
+    while (offset < size)
+    {
+        if (size - offset < RF24LOG_LZ_BLOCK_HEADER)
+        {
+            error = "the last block header is truncated";
+            break;
+        }
+        uint32_t rawSize = getWord(data + offset);
+        uint32_t blockSize = getWord(data + offset + 4);
+        offset += RF24LOG_LZ_BLOCK_HEADER;
+        if (rawSize == RF24LOG_LZ_MAGIC)
+        {
+            if (blockSize != RF24LOG_LZ_VERSION)
+            {
+                error = "unsupported version";
+                break;
+            }
+            continue; // the start of a (possibly appended) stream
+        }
+        bool stored = rawSize & RF24LOG_LZ_STORED;
+        rawSize &= ~static_cast<uint32_t>(RF24LOG_LZ_STORED);
+        if (rawSize > RF24LOG_LZ_MAX_BLOCK || blockSize > RF24LogLz::bound(RF24LOG_LZ_MAX_BLOCK))
+        {
+            error = "corrupt block header";
+            break;
+        }
+        if (size - offset < blockSize)
+        {
+            error = "the last block is truncated";
+            break;
+        }
+        blocks.push_back({offset, rawSize, blockSize, stored});
+        offset += blockSize;
+    }
+
+    std::string carry; // the start of a line that continues in the next block
+    runOrdered(blocks.size(), threads,
+        [&](size_t i, Chunk *chunk) {
+            static thread_local std::vector<char> text;
+            const LzBlock &block = blocks[i];
+            const char *begin = data + block.offset;
+            if (!block.stored)
+            {
+                text.resize(block.rawSize);
+                if (RF24LogLz::decompress(begin, block.size, text.data(), block.rawSize) != static_cast<long>(block.rawSize))
+                {
+                    chunk->error = "corrupt block (skipped)";
+                    return;
+                }
+                begin = text.data();
+            }
+            const char *end = begin + (block.stored ? block.size : block.rawSize);
+            const char *first = static_cast<const char *>(memchr(begin, '\n', static_cast<size_t>(end - begin)));
+            if (first == nullptr)
+            {
+                chunk->head.assign(begin, end);
+                return;
+            }
+            const char *last = static_cast<const char *>(memrchr(begin, '\n', static_cast<size_t>(end - begin)));
+            chunk->head.assign(begin, first + 1);
+            chunk->complete = true;
+            chunk->tail.assign(last + 1, end);
+            filterLines(first + 1, last + 1, filter, chunk);
+        },
+        [&](Chunk *chunk) {
+            carry += chunk->head;
+            if (chunk->complete)
+            {
+                Chunk line;
+                filterLines(carry.data(), carry.data() + carry.size(), filter, &line);
+                output->emit(name, &line);
+                carry.swap(chunk->tail);
+            }
+            output->emit(name, chunk);
+        });
+    if (!carry.empty())
+    {
+        Chunk line;
+        filterLines(carry.data(), carry.data() + carry.size(), filter, &line);
+        output->emit(name, &line);
+    }
+    if (error != nullptr)
+    {
+        fprintf(stderr, "%s: %s\n", name, error);
+        output->failed = true;
+    }
+}
+
+/** @brief query 1 file */
+static void query(const char *name, const Filter &filter, unsigned threads, Output *output)
+{
+    int fd = open(name, O_RDONLY | O_CLOEXEC);
+    struct stat info;
+    if (fd < 0 || fstat(fd, &info) != 0)
+    {
+        perror(name);
+        output->failed = true;
+        if (fd >= 0)
+        {
+            close(fd);
+        }
+        return;
+    }
+    size_t size = static_cast<size_t>(info.st_size);
+    if (size == 0)
+    {
+        close(fd);
+        return;
+    }
+    void *map = mmap(nullptr, size, PROT_READ, MAP_PRIVATE, fd, 0);
+    if (map == MAP_FAILED)
+    {
+        perror(name);
+        output->failed = true;
+        close(fd);
+        return;
+    }
+    const char *data = static_cast<const char *>(map);
+    if (size >= sizeof(RF24LOG_INDEXED_MAGIC) && memcmp(data, RF24LOG_INDEXED_MAGIC, sizeof(RF24LOG_INDEXED_MAGIC)) == 0)
+    {
+        queryIndexed(fd, data, filter, threads, output, name);
+    }
+    else if (size >= RF24LOG_LZ_BLOCK_HEADER && getWord(data) == RF24LOG_LZ_MAGIC)
+    {
+        madvise(map, size, MADV_SEQUENTIAL);
+        queryCompressed(data, size, filter, threads, output, name);
+    }
+    else
+    {
+        madvise(map, size, MADV_SEQUENTIAL);
+        queryText(data, size, filter, threads, output, name);
+    }
+    munmap(map, size);
+    close(fd);
+}
+
+int main(int argc, char **argv)
+{
+    Filter filter;
+    const char *outName = nullptr;
+    unsigned threads = std::thread::hardware_concurrency();
+    bool usage = false;
+    int option;
+    while ((option = getopt(argc, argv, "l:v:f:t:s:j:co:")) != -1)
+    {
+        switch (option)
+        {
+            case 'l': usage |= !parseLevelRange(optarg, &filter.minLevel, &filter.maxLevel); filter.levels = true; break;
+            case 'v': filter.vendor = optarg; filter.vendorLength = strlen(optarg); break;
+            case 'f': usage |= !parseTime(optarg, false, filter.fromText, &filter.from); filter.window = true; break;
+            case 't': usage |= !parseTime(optarg, true, filter.toText, &filter.to); filter.window = true; break;
+            case 's': filter.text = optarg; filter.textLength = strlen(optarg); break;
+            case 'j': threads = static_cast<unsigned>(strtoul(optarg, nullptr, 0)); break;
+            case 'c': filter.countOnly = true; break;
+            case 'o': outName = optarg; break;
+            default: usage = true; break;
+        }
+    }
+    if (usage || optind == argc)
+    {
+        fprintf(stderr, "usage: %s [-l LEVELS] [-v VENDOR] [-f FROM] [-t TO] [-s TEXT] [-j THREADS] [-c] [-o FILE] FILE...\n",
+                argv[0]);
+        return 2;
+    }
+    if (threads == 0)
+    {
+        threads = 1;
+    }
+    if (!filter.levels)
+    {
+        filter.minLevel = 0;
+        filter.maxLevel = 0xFF;
+    }
+
+    Output output = {outName != nullptr ? fopen(outName, "w") : stdout, 0, false};
+    if (output.out == nullptr)
+    {
+        perror(outName);
+        return 1;
+    }
+    for (int i = optind; i < argc; ++i)
+    {
+        query(argv[i], filter, threads, &output);
+    }
+    if (filter.countOnly)
+    {
+        fprintf(output.out, "%llu\n", static_cast<unsigned long long>(output.matches));
+    }
+    if (output.out != stdout)
+    {
+        fclose(output.out);
+    }
+    return output.failed ? 1 : 0;
+}
@@ -0,0 +1,156 @@
+/**
+ * @file ShmDaemon.cpp
+ * @brief rf24log-shmd: formats and writes the records of a RF24LogShmRing
+ * @date Created 19 Oct 2026
+ * @author Brendan Doherty (2bndy5)
+ * @copyright Copyright (C) <br>
+ *     2026    Brendan Doherty (2bndy5) <br>
+ * This General Public License does not permit incorporating your program into
+ * proprietary programs.  If your program is a subroutine library, you may
+ * consider it more useful to permit linking proprietary applications with the
+ * library.  If this is what you want to do, use the GNU Lesser General
+ * Public License instead of this License.
+ *
+ * usage: rf24log-shmd [-o FILE] [-p MICROSECONDS] [-1] [-u] NAME
+ *   -o FILE          append the log to FILE (default: stdout)
+ *   -p MICROSECONDS  how long to sleep when the ring is empty (default: 1000)
+ *   -1               exit once the ring is empty (don't wait for more records)
+ *   -u               remove the ring's name on exit
+ */
+
+#include <csignal>  // signal(), SIGINT, SIGTERM
+#include <cstdio>   // fopen(), fwrite(), fflush(), fprintf()
+#include <cstdlib>  // strtoul()
+#include <unistd.h> // getopt(), usleep()
+#include "RF24LogParts/LineFormatter.h"
+#include "RF24LogParts/ShmRing.h"
+
+/** @brief formats the binary records (the output is done by the daemon) */
+class ShmFormatter : public RF24LogLineFormatter
+{
+protected:
+    void writeLine(const char *, size_t, uint8_t) {}
+};
+
+static volatile sig_atomic_t stopping = 0;
+
+static void onStop(int)
+{
+    stopping = 1;
+}
+
+/** @brief output 1 record; returns false if the slot's contents are malformed */
+static bool output(RF24LogShmSlot *slot, uint32_t slotSize, ShmFormatter *formatter, FILE *out)
+{
+    if (slot->length > slotSize)
+    {
+        return false;
+    }
+    if (slot->type == RF24LOG_SHM_TEXT)
+    {
+        fwrite(slot->data(), 1, slot->length, out);
+        return true;
+    }
+    const RF24LogShmRecord *record = reinterpret_cast<const RF24LogShmRecord *>(slot->data());
+    if (slot->type != RF24LOG_SHM_BINARY
+        || slot->length < sizeof(RF24LogShmRecord)
+        || sizeof(RF24LogShmRecord) + record->vendorLength + record->messageLength + 2 + record->argsSize > slot->length
+        || record->vendorId()[record->vendorLength] != 0
+        || record->message()[record->messageLength] != 0)
+    {
+        return false;
+    }
+    char buffer[RF24LOG_LINE_SIZE];
+    RF24LogArgList args(record->args(), record->argsSize);
+    size_t length = formatter->format(buffer, sizeof(buffer), record->logLevel, record->vendorId(),
+                                      record->message(), &args, record->timestamp);
+    fwrite(buffer, 1, length, out);
+    return true;
+}
+
+int main(int argc, char **argv)
+{
+    const char *outName = nullptr;
+    useconds_t pollInterval = 1000;
+    bool once = false;
+    bool unlinkOnExit = false;
+    int option;
+    while ((option = getopt(argc, argv, "o:p:1u")) != -1)
+    {
+        switch (option)
+        {
+            case 'o': outName = optarg; break;
+            case 'p': pollInterval = static_cast<useconds_t>(strtoul(optarg, nullptr, 10)); break;
+            case '1': once = true; break;
+            case 'u': unlinkOnExit = true; break;
+            default:
+                fprintf(stderr, "usage: %s [-o FILE] [-p MICROSECONDS] [-1] [-u] NAME\n", argv[0]);
+                return 2;
+        }
+    }
+    if (optind != argc - 1)
+    {
+        fprintf(stderr, "usage: %s [-o FILE] [-p MICROSECONDS] [-1] [-u] NAME\n", argv[0]);
+        return 2;
+    }
+    const char *name = argv[optind];
+
+    FILE *out = outName != nullptr ? fopen(outName, "a") : stdout;
+    if (out == nullptr)
+    {
+        perror(outName);
+        return 1;
+    }
+    signal(SIGINT, onStop);
+    signal(SIGTERM, onStop);
+
+    // wait for the application to create the ring
+    RF24LogShmRing ring;
+    while (!ring.attach(name))
+    {
+        if (once || stopping)
+        {
+            fprintf(stderr, "%s: can't open the shared memory %s\n", argv[0], name);
+            return 1;
+        }
+        usleep(100000);
+    }
+
+    ShmFormatter formatter;
+    uint64_t malformed = 0;
+    while (true)
+    {
+        RF24LogShmSlot *slot;
+        while ((slot = ring.front()) != nullptr)
+        {
+            if (!output(slot, ring.slotSize(), &formatter, out))
+            {
+                ++malformed;
+            }
+            ring.pop();
+        }
+        fflush(out);
+        if (once || stopping)
+        {
+            break;
+        }
+        usleep(pollInterval);
+    }
+
+    if (ring.dropped() || ring.lost() || malformed)
+    {
+        fprintf(stderr, "%s: %llu records dropped (ring full), %llu lost (writer died), %llu malformed\n",
+                argv[0], static_cast<unsigned long long>(ring.dropped()),
+                static_cast<unsigned long long>(ring.lost()), static_cast<unsigned long long>(malformed));
+    }
+    ring.close();
+    if (unlinkOnExit)
+    {
+        RF24LogShmRing::unlink(name);
+    }
+    if (out != stdout)
+    {
+        fclose(out);
+    }
+    return 0;
+}
@@ -0,0 +1,217 @@
+/**
+ * @file SocketReceiver.cpp
+ * @brief rf24log-recv: a local collector that writes the records sent by RF24LogSocketSink to a file
+ * @date Created 19 Oct 2026
+ * @author Brendan Doherty (2bndy5)
+ * @copyright Copyright (C) <br>
+ *     2026    Brendan Doherty (2bndy5) <br>
+ * This General Public License does not permit incorporating your program into
+ * proprietary programs.  If your program is a subroutine library, you may
+ * consider it more useful to permit linking proprietary applications with the
+ * library.  If this is what you want to do, use the GNU Lesser General
+ * Public License instead of this License.
+ *
+ * usage: rf24log-recv [-d] [-o FILE] [-n COUNT] PATH
+ *   -d        receive datagrams (default: a length-prefixed stream)
+ *   -o FILE   append the records to FILE (default: stdout)
+ *   -n COUNT  exit after receiving COUNT records
+ */
+
+#include <arpa/inet.h>  // ntohl()
+#include <csignal>      // signal(), SIGINT, SIGTERM
+#include <cstdio>       // fopen(), fwrite(), fflush(), fprintf()
+#include <cstdlib>      // strtoull()
+#include <cstring>      // memcpy(), memmove(), memset(), strncpy()
+#include <poll.h>       // poll()
+#include <sys/socket.h> // socket(), bind(), listen(), accept(), recv()
+#include <sys/un.h>     // struct sockaddr_un
+#include <unistd.h>     // getopt(), close(), unlink()
+#include <vector>
+#include "RF24LogSinks/SocketSink.h" // RF24LOG_FRAME_HEADER_SIZE
+
+/** @brief The largest record accepted (larger frames mean the stream is corrupt) */
+#define MAX_RECORD (1 << 20)
+
+static volatile sig_atomic_t stopping = 0;
+
+static void onStop(int)
+{
+    stopping = 1;
+}
+
+/** @brief A connected RF24LogSocketSink (stream mode) */
+struct Client
+{
+    int fd;
+    std::vector<char> pending;
+};
+
+/** @brief write the complete frames of a client's stream; returns false if the stream is corrupt */
+static bool outputFrames(Client *client, FILE *out, unsigned long long *received)
+{
+    std::vector<char> &pending = client->pending;
+    size_t offset = 0;
+    while (pending.size() - offset >= RF24LOG_FRAME_HEADER_SIZE)
+    {
+        uint32_t length;
+        memcpy(&length, pending.data() + offset, RF24LOG_FRAME_HEADER_SIZE);
+        length = ntohl(length);
+        if (length > MAX_RECORD)
+        {
+            return false;
+        }
+        if (pending.size() - offset - RF24LOG_FRAME_HEADER_SIZE < length)
+        {
+            break;
+        }
+        fwrite(pending.data() + offset + RF24LOG_FRAME_HEADER_SIZE, 1, length, out);
+        offset += RF24LOG_FRAME_HEADER_SIZE + length;
+        ++*received;
+    }
+    pending.erase(pending.begin(), pending.begin() + static_cast<std::ptrdiff_t>(offset));
+    return true;
+}
+
+int main(int argc, char **argv)
+{
+    bool datagrams = false;
+    const char *outName = nullptr;
+    unsigned long long limit = 0;
+    int option;
+    while ((option = getopt(argc, argv, "do:n:")) != -1)
+    {
+        switch (option)
+        {
+            case 'd': datagrams = true; break;
+            case 'o': outName = optarg; break;
+            case 'n': limit = strtoull(optarg, nullptr, 10); break;
+            default:
+                fprintf(stderr, "usage: %s [-d] [-o FILE] [-n COUNT] PATH\n", argv[0]);
+                return 2;
+        }
+    }
+    if (optind != argc - 1)
+    {
+        fprintf(stderr, "usage: %s [-d] [-o FILE] [-n COUNT] PATH\n", argv[0]);
+        return 2;
+    }
+    const char *path = argv[optind];
+
+    FILE *out = outName != nullptr ? fopen(outName, "a") : stdout;
+    if (out == nullptr)
+    {
+        perror(outName);
+        return 1;
+    }
+    signal(SIGINT, onStop);
+    signal(SIGTERM, onStop);
+    signal(SIGPIPE, SIG_IGN);
+
+    int listener = socket(AF_UNIX, datagrams ? SOCK_DGRAM : SOCK_STREAM, 0);
+    struct sockaddr_un address;
+    memset(&address, 0, sizeof(address));
+    address.sun_family = AF_UNIX;
+    strncpy(address.sun_path, path, sizeof(address.sun_path) - 1);
+    unlink(path);
+    if (listener < 0
+        || bind(listener, reinterpret_cast<struct sockaddr *>(&address), sizeof(address)) != 0
+        || (!datagrams && listen(listener, 16) != 0))
+    {
+        perror(path);
+        return 1;
+    }
+    if (datagrams)
+    {
+        // a larger receive buffer absorbs bursts of datagrams
+        int size = 4 << 20;
+        setsockopt(listener, SOL_SOCKET, SO_RCVBUF, &size, sizeof(size));
+    }
+
+    std::vector<Client> clients;
+    std::vector<char> buffer(MAX_RECORD);
+    unsigned long long received = 0;
+    while (!stopping && (limit == 0 || received < limit))
+    {
+        std::vector<struct pollfd> ready;
+        ready.push_back({listener, POLLIN, 0});
+        for (Client &client : clients)
+        {
+            ready.push_back({client.fd, POLLIN, 0});
+        }
+        if (poll(ready.data(), ready.size(), 200) <= 0)
+        {
+            fflush(out);
+            continue;
+        }
+
+        if (ready[0].revents & POLLIN)
+        {
+            if (datagrams)
+            {
+                ssize_t length;
+                while ((length = recv(listener, buffer.data(), buffer.size(), MSG_DONTWAIT)) >= 0)
+                {
+                    fwrite(buffer.data(), 1, static_cast<size_t>(length), out);
+                    if (++received == limit)
+                    {
+                        break;
+                    }
+                }
+            }
+            else
+            {
+                int fd = accept(listener, nullptr, nullptr);
+                if (fd >= 0)
+                {
+                    clients.push_back({fd, std::vector<char>()});
+                }
+            }
+        }
+
+        // the clients added by accept() were not polled yet
+        for (size_t i = 1; i < ready.size(); ++i)
+        {
+            if (!(ready[i].revents & (POLLIN | POLLHUP | POLLERR)))
+            {
+                continue;
+            }
+            Client &client = clients[i - 1];
+            ssize_t length = recv(client.fd, buffer.data(), buffer.size(), 0);
+            if (length > 0)
+            {
+                client.pending.insert(client.pending.end(), buffer.data(), buffer.data() + length);
+            }
+            if (length <= 0 || !outputFrames(&client, out, &received))
+            {
+                if (!client.pending.empty())
+                {
+                    fprintf(stderr, "%s: dropped %zu bytes of an incomplete or corrupt stream\n",
+                            argv[0], client.pending.size());
+                }
+                close(client.fd);
+                client.fd = -1;
+            }
+        }
+        for (size_t i = clients.size(); i-- > 0;)
+        {
+            if (clients[i].fd < 0)
+            {
+                clients.erase(clients.begin() + static_cast<std::ptrdiff_t>(i));
+            }
+        }
+    }
+
+    fflush(out);
+    fprintf(stderr, "%s: received %llu records\n", argv[0], received);
+    for (Client &client : clients)
+    {
+        close(client.fd);
+    }
+    close(listener);
+    unlink(path);
+    if (out != stdout)
+    {
+        fclose(out);
+    }
+    return 0;
+}
@@ -0,0 +1,253 @@
+/**
+ * @file TextLog.h
+ * @brief parsing shared by the command line tools: the lines written by the lib's loggers,
+ * and the levels & times given on the command line
+ * @date Created 19 Oct 2026
+ * @author Brendan Doherty (2bndy5)
+ * @copyright Copyright (C) <br>
+ *     2026    Brendan Doherty (2bndy5) <br>
+ * This General Public License does not permit incorporating your program into
+ * proprietary programs.  If your program is a subroutine library, you may
+ * consider it more useful to permit linking proprietary applications with the
+ * library.  If this is what you want to do, use the GNU Lesser General
+ * Public License instead of this License.
+ */
+
+#ifndef TOOLS_TEXTLOG_H_
+#define TOOLS_TEXTLOG_H_
+
+#include <cstdio>    // sscanf(), snprintf()
+#include <cstdlib>   // strtoul()
+#include <cstring>   // memchr(), memcmp(), strlen()
+#include <ctime>     // mktime()
+#include <string>
+#include <strings.h> // strncasecmp()
+#include "RF24LogBaseHandler.h" // RF24LOG_DELIMITER
+#include "RF24LogLevel.h"
+#include "RF24LogParts/Common.h" // RF24LogTime
+
+/** @brief the fields of a line of text written by the lib's loggers */
+struct TextLogLine
+{
+    /** @brief Does the line start with a timestamp? */
+    bool timed;
+    /** @brief The level (0 if the line has no level description) */
+    uint8_t logLevel;
+    /** @brief The vendorId (not null-terminated) */
+    const char *vendorId;
+    size_t vendorLength;
+    /** @brief The rest of the line (not null-terminated) */
+    const char *message;
+    size_t messageLength;
+};
+
+/** @brief find the end of a header field (the next RF24LOG_DELIMITER) */
+static inline const char *textFieldEnd(const char *field, const char *end)
+{
+    const void *found = memchr(field, RF24LOG_DELIMITER, static_cast<size_t>(end - field));
+    return found != nullptr ? static_cast<const char *>(found) : nullptr;
+}
+
+/**
+ * @brief parse a level description (as printed by RF24LogAbstractStream::appendLogLevel(),
+ * with or without RF24LOG_SHORT_DESC or RF24LOG_TERSE_DESC)
+ */
+static inline bool parseLevelField(const char *field, const char *end, uint8_t *level)
+{
+    static const struct { const char *name; uint8_t level; } names[] = {
+        {"ERROR", RF24LogLevel::ERROR}, {"ERR", RF24LogLevel::ERROR}, {"E", RF24LogLevel::ERROR},
+        {"WARN", RF24LogLevel::WARN}, {"W", RF24LogLevel::WARN},
+        {"INFO", RF24LogLevel::INFO}, {"I", RF24LogLevel::INFO},
+        {"DEBUG", RF24LogLevel::DEBUG}, {"DBG", RF24LogLevel::DEBUG}, {"DB", RF24LogLevel::DEBUG},
+        {"Lvl", 0}, {"L", 0}};
+    while (field < end && *field == ' ')
+    {
+        ++field;
+    }
+    uint8_t base = 0;
+    bool named = false;
+    for (const auto &name : names)
+    {
+        size_t length = strlen(name.name);
+        if (static_cast<size_t>(end - field) >= length && memcmp(field, name.name, length) == 0)
+        {
+            base = name.level;
+            named = base != 0;
+            field += length;
+            break;
+        }
+    }
+    while (field < end && (*field == ' ' || *field == '+'))
+    {
+        ++field;
+    }
+    unsigned number = 0;
+    bool digits = false;
+    while (field < end && *field >= '0' && *field <= '7')
+    {
+        number = number * 8 + static_cast<unsigned>(*field++ - '0');
+        digits = true;
+    }
+    if (field != end || (!named && !digits) || number > 0xFF || (named && number > 7))
+    {
+        return false;
+    }
+    *level = static_cast<uint8_t>(base + number);
+    return true;
+}
+
+/**
+ * @brief split a line of text (without its line break) into its header fields: the
+ * timestamp (the first 19 chars when TextLogLine::timed), the level description and the
+ * vendorId.
+ */
+static inline void parseTextLine(const char *line, size_t length, TextLogLine *parsed)
+{
+    const char *end = line + length;
+    const char *field = line;
+    const char *stop;
+    parsed->timed = length > 19 && line[19] == RF24LOG_DELIMITER && line[4] == '-' && line[10] == ':';
+    if (parsed->timed)
+    {
+        field += 20;
+    }
+    parsed->logLevel = 0; // level 0 messages have no header
+    if ((stop = textFieldEnd(field, end)) != nullptr && parseLevelField(field, stop, &parsed->logLevel))
+    {
+        field = stop + 1;
+    }
+    parsed->vendorId = field;
+    parsed->vendorLength = 0;
+    if ((stop = textFieldEnd(field, end)) != nullptr)
+    {
+        parsed->vendorLength = static_cast<size_t>(stop - field);
+        field = stop + 1;
+    }
+    parsed->message = field;
+    parsed->messageLength = static_cast<size_t>(end - field);
+}
+
+/**
+ * @brief convert a timestamp printed by the lib's loggers (`%F:%H:%M:%S`, local time) back
+ * to a RF24LogTime (see rf24LogNow()); mktime() is only called once per minute of logs.
+ */
+static inline RF24LogTime textTime(const char *text)
+{
+    static thread_local char cachedMinute[16];
+    static thread_local RF24LogTime cachedTime = 0;
+    if (memcmp(text, cachedMinute, sizeof(cachedMinute)) != 0)
+    {
+        struct tm local = {};
+        if (sscanf(text, "%4d-%2d-%2d:%2d:%2d", &local.tm_year, &local.tm_mon, &local.tm_mday,
+                   &local.tm_hour, &local.tm_min) != 5)
+        {
+            return 0;
+        }
+        local.tm_year -= 1900;
+        local.tm_mon -= 1;
+        local.tm_isdst = -1;
+        cachedTime = static_cast<RF24LogTime>(mktime(&local)) * 1000000;
+        memcpy(cachedMinute, text, sizeof(cachedMinute));
+    }
+    return cachedTime + static_cast<RF24LogTime>((text[17] - '0') * 10 + (text[18] - '0')) * 1000000;
+}
+
+/**
+ * @brief parse 1 end of a level range: a level name (`WARN` is a range of its sub-levels,
+ * `WARN+2` is 1 level) or a number (`022`, `0x12`, `18`)
+ */
+static inline bool parseLevel(const char *text, uint8_t *first, uint8_t *last)
+{
+    static const struct { const char *name; uint8_t level; } names[] = {
+        {"ERROR", RF24LogLevel::ERROR}, {"WARN", RF24LogLevel::WARN},
+        {"INFO", RF24LogLevel::INFO}, {"DEBUG", RF24LogLevel::DEBUG}};
+    char *end;
+    unsigned long number = strtoul(text, &end, 0);
+    if (end != text && *end == 0 && number <= 0xFF)
+    {
+        *first = *last = static_cast<uint8_t>(number);
+        return true;
+    }
+    for (const auto &name : names)
+    {
+        size_t length = strlen(name.name);
+        if (strncasecmp(text, name.name, length) != 0)
+        {
+            continue;
+        }
+        if (text[length] == 0)
+        {
+            *first = name.level;
+            *last = static_cast<uint8_t>(name.level + 7);
+            return true;
+        }
+        if (text[length] == '+' && text[length + 1] >= '0' && text[length + 1] <= '7' && text[length + 2] == 0)
+        {
+            *first = *last = static_cast<uint8_t>(name.level + text[length + 1] - '0');
+            return true;
+        }
+    }
+    return false;
+}
+
+/** @brief parse a level range: `LEVEL`, `LEVEL-LEVEL`, `-LEVEL` or `LEVEL-` */
+static inline bool parseLevelRange(const char *text, uint8_t *minLevel, uint8_t *maxLevel)
+{
+    std::string range(text);
+    size_t dash = range.find('-');
+    uint8_t ignored;
+    if (dash == std::string::npos)
+    {
+        return parseLevel(text, minLevel, maxLevel);
+    }
+    std::string low = range.substr(0, dash);
+    std::string high = range.substr(dash + 1);
+    *minLevel = 1;
+    *maxLevel = 0xFF;
+    return (low.empty() || parseLevel(low.c_str(), minLevel, &ignored))
+           && (high.empty() || parseLevel(high.c_str(), &ignored, maxLevel))
+           && *minLevel <= *maxLevel;
+}
+
+/**
+ * @brief parse a local time (`YYYY-MM-DD`, `YYYY-MM-DD HH:MM` or `YYYY-MM-DD HH:MM:SS`, the
+ * separator can also be `T` or `:`); the missing fields are the start (or the end) of the period
+ * @param text The time to parse
+ * @param end Is it the end of a time window?
+ * @param asText Set to the time as the lib's loggers print it (at least 32 bytes)
+ * @param timestamp Set to the time as a RF24LogTime (see rf24LogNow())
+ */
+static inline bool parseTime(const char *text, bool end, char *asText, RF24LogTime *timestamp)
+{
+    struct tm local = {};
+    char separator;
+    int fields = sscanf(text, "%4d-%2d-%2d%c%2d:%2d:%2d", &local.tm_year, &local.tm_mon, &local.tm_mday,
+                        &separator, &local.tm_hour, &local.tm_min, &local.tm_sec);
+    if (fields != 3 && fields != 6 && fields != 7)
+    {
+        return false;
+    }
+    if (fields == 3)
+    {
+        local.tm_hour = end ? 23 : 0;
+        local.tm_min = end ? 59 : 0;
+    }
+    if (fields != 7)
+    {
+        local.tm_sec = end ? 59 : 0;
+    }
+    snprintf(asText, 32, "%04d-%02d-%02d:%02d:%02d:%02d", local.tm_year, local.tm_mon, local.tm_mday,
+             local.tm_hour, local.tm_min, local.tm_sec);
+    local.tm_year -= 1900;
+    local.tm_mon -= 1;
+    local.tm_isdst = -1;
+    time_t seconds = mktime(&local);
+    if (seconds == static_cast<time_t>(-1))
+    {
+        return false;
+    }
+    *timestamp = static_cast<RF24LogTime>(seconds) * 1000000 + (end ? 999999 : 0);
+    return true;
+}
+
+#endif /* TOOLS_TEXTLOG_H_ */